@@ -2935,6 +2935,7 @@ public:
         , domain_ids_(b.max_domains() != 0 ?
                 b.max_domains() :
                 b.domain_ids().size())
+        , spin_duration_(b.spin_duration())
     {
         domain_ids_ = b.domain_ids();
     }
@@ -2952,6 +2953,7 @@ public:
                 b.domain_ids().size());
         domain_ids_ = b.domain_ids();
         data_sharing_listener_thread_ = b.data_sharing_listener_thread();
+        spin_duration_ = b.spin_duration();
 
         return *this;
     }
@@ -2963,6 +2965,7 @@ public:
                shm_directory_ == b.shm_directory_ &&
                domain_ids_ == b.domain_ids_ &&
                data_sharing_listener_thread_ == b.data_sharing_listener_thread_ &&
+               spin_duration_ == b.spin_duration_ &&
                Parameter_t::operator ==(b) &&
                QosPolicy::operator ==(b);
     }
@@ -3170,6 +3173,40 @@ public:
         data_sharing_listener_thread_ = value;
     }
 
+    /**
+     * Getter for the time the DataSharing listener thread polls for new data before blocking
+     *
+     * @return Duration_t reference
+     */
+    fastrtps::Duration_t& spin_duration()
+    {
+        return spin_duration_;
+    }
+
+    /**
+     * Getter for the time the DataSharing listener thread polls for new data before blocking
+     *
+     * @return Duration_t reference
+     */
+    const fastrtps::Duration_t& spin_duration() const
+    {
+        return spin_duration_;
+    }
+
+    /**
+     * Setter for the time the DataSharing listener thread polls for new data before blocking.
+     *
+     * Polling avoids the wake-up latency of the listener thread on the samples arriving while it polls,
+     * at the cost of keeping a core busy. Only used by DataReaders. Zero, the default, disables polling.
+     *
+     * @param value New polling time
+     */
+    void spin_duration(
+            const fastrtps::Duration_t& value)
+    {
+        spin_duration_ = value;
+    }
+
 private:
 
     void setup(
@@ -3201,6 +3238,9 @@ private:
 
     //! Thread settings for the DataSharing listener thread
     rtps::ThreadSettings data_sharing_listener_thread_;
+
+    //! Time the DataSharing listener thread polls for new data before blocking
+    fastrtps::Duration_t spin_duration_ = fastrtps::c_TimeZero;
 };
 
 
@@ -19,8 +19,14 @@
 #ifndef _FASTDDS_RTPS_CACHECHANGE_H_
 #define _FASTDDS_RTPS_CACHECHANGE_H_
 
-#include <cassert>
+#include <algorithm>
 #include <atomic>
+#include <cassert>
+#include <vector>
+
+#if _MSC_VER
+#include <intrin.h>
+#endif // if _MSC_VER
 
 #include <fastdds/rtps/common/ChangeKind_t.hpp>
 #include <fastdds/rtps/common/FragmentNumber.h>
@@ -146,6 +152,7 @@ struct RTPS_DllAPI CacheChange_t
         fragment_size_ = ch_ptr->fragment_size_;
         fragment_count_ = ch_ptr->fragment_count_;
         first_missing_fragment_ = ch_ptr->first_missing_fragment_;
+        missing_fragments_ = ch_ptr->missing_fragments_;
 
         return serializedPayload.copy(&ch_ptr->serializedPayload, !ch_ptr->is_untyped_);
     }
@@ -228,12 +235,11 @@ struct RTPS_DllAPI CacheChange_t
         // Note: Fragment numbers are 1-based but we keep them 0 based.
         frag_sns.base(first_missing_fragment_ + 1);
 
-        // Traverse list of missing fragments, adding them to frag_sns
+        // Traverse the bitmap of missing fragments, adding them to frag_sns until it is full
         uint32_t current_frag = first_missing_fragment_;
-        while (current_frag < fragment_count_)
+        while (current_frag < fragment_count_ && frag_sns.add(current_frag + 1))
         {
-            frag_sns.add(current_frag + 1);
-            current_frag = get_next_missing_fragment(current_frag);
+            current_frag = get_next_missing_fragment(current_frag + 1);
         }
     }
 
@@ -253,6 +259,7 @@ struct RTPS_DllAPI CacheChange_t
         fragment_size_ = fragment_size;
         fragment_count_ = 0;
         first_missing_fragment_ = 0;
+        missing_fragments_.clear();
 
         if (fragment_size > 0)
         {
@@ -261,12 +268,12 @@ struct RTPS_DllAPI CacheChange_t
 
             if (create_fragment_list)
             {
-                // Keep index of next fragment on the payload portion at the beginning of each fragment. Last
-                // fragment will have fragment_count_ as 'next fragment index'
-                size_t offset = 0;
-                for (uint32_t i = 1; i <= fragment_count_; i++, offset += fragment_size_)
+                // Every fragment starts missing. The bits past the last fragment are kept cleared.
+                missing_fragments_.assign((fragment_count_ + 31u) / 32u, ~0u);
+                uint32_t trailing_bits = fragment_count_ & 31u;
+                if (0 != trailing_bits)
                 {
-                    set_next_missing_fragment(i - 1, i);  // index to next fragment in missing list
+                    missing_fragments_.back() = ~0u << (32u - trailing_bits);
                 }
             }
             else
@@ -348,36 +355,55 @@ private:
     // First fragment in missing list
     uint32_t first_missing_fragment_ = 0;
 
+    // Bitmap of the fragments still missing, most significant bit first
+    std::vector<uint32_t> missing_fragments_;
+
     // Pool that created the payload of this cache change
     IPayloadPool* payload_owner_ = nullptr;
 
+    /*!
+     * Find the first missing fragment starting at a given one.
+     * The bitmap of missing fragments is scanned a word at a time.
+     *
+     * @param fragment_index Index (0-based) of the first fragment to check.
+     * @return Index of the first missing fragment not lower than @c fragment_index, or the number of fragments if
+     *         none is missing.
+     */
     uint32_t get_next_missing_fragment(
-            uint32_t fragment_index)
+            uint32_t fragment_index) const
     {
-        uint32_t* ptr = next_fragment_pointer(fragment_index);
-        return *ptr;
-    }
+        uint32_t n_words = static_cast<uint32_t>(missing_fragments_.size());
+        uint32_t word = fragment_index >> 5;
+        if (word >= n_words)
+        {
+            return fragment_count_;
+        }
 
-    void set_next_missing_fragment(
-            uint32_t fragment_index,
-            uint32_t next_fragment_index)
-    {
-        uint32_t* ptr = next_fragment_pointer(fragment_index);
-        *ptr = next_fragment_index;
-    }
+        // Ignore the fragments before fragment_index on its word
+        uint32_t bits = missing_fragments_[word] & (~0u >> (fragment_index & 31u));
+        while (0 == bits)
+        {
+            if (++word == n_words)
+            {
+                return fragment_count_;
+            }
+            bits = missing_fragments_[word];
+        }
 
-    uint32_t* next_fragment_pointer(
-            uint32_t fragment_index)
-    {
-        size_t offset = fragment_size_;
-        offset *= fragment_index;
-        offset = (offset + 3u) & ~3u;
-        return reinterpret_cast<uint32_t*>(&serializedPayload.data[offset]);
+        // The number of leading zeroes gives the index of the first missing fragment on the word
+#if _MSC_VER
+        unsigned long bit;
+        _BitScanReverse(&bit, bits);
+        uint32_t offset = 31u ^ bit;
+#else
+        uint32_t offset = static_cast<uint32_t>(__builtin_clz(bits));
+#endif // if _MSC_VER
+        return (word << 5) + offset;
     }
 
     /*!
      * Mark a set of consecutive fragments as received.
-     * This will remove a set of consecutive fragments from the missing list.
+     * This will remove a set of consecutive fragments from the bitmap of missing fragments.
      * Should be called BEFORE copying the received data into the serialized payload.
      *
      * @param initial_fragment Index (0-based) of first received fragment.
@@ -390,7 +416,8 @@ private:
     {
         bool at_least_one_changed = false;
 
-        if ((fragment_size_ > 0) && (initial_fragment < fragment_count_))
+        if ((fragment_size_ > 0) && (initial_fragment < fragment_count_) &&
+                (initial_fragment >> 5) < missing_fragments_.size())
         {
             uint32_t last_fragment = initial_fragment + num_of_fragments;
             if (last_fragment > fragment_count_)
@@ -398,42 +425,23 @@ private:
                 last_fragment = fragment_count_;
             }
 
-            if (initial_fragment <= first_missing_fragment_)
+            // Clear the bits of the received fragments, a word at a time
+            uint32_t current_frag = initial_fragment;
+            while (current_frag < last_fragment)
             {
-                // Perform first = *first until first >= last_received
-                while (first_missing_fragment_ < last_fragment)
-                {
-                    first_missing_fragment_ = get_next_missing_fragment(first_missing_fragment_);
-                    at_least_one_changed = true;
-                }
+                uint32_t word = current_frag >> 5;
+                uint32_t first_bit = current_frag & 31u;
+                uint32_t num_bits = (std::min)(32u - first_bit, last_fragment - current_frag);
+                uint32_t mask = (32u == num_bits) ? ~0u : (((1u << num_bits) - 1u) << (32u - first_bit - num_bits));
+
+                at_least_one_changed |= (0 != (missing_fragments_[word] & mask));
+                missing_fragments_[word] &= ~mask;
+                current_frag += num_bits;
             }
-            else
+
+            if (at_least_one_changed && initial_fragment <= first_missing_fragment_)
             {
-                // Find prev in missing list
-                uint32_t current_frag = first_missing_fragment_;
-                while (current_frag < initial_fragment)
-                {
-                    uint32_t next_frag = get_next_missing_fragment(current_frag);
-                    if (next_frag >= initial_fragment)
-                    {
-                        // This is the fragment previous to initial_fragment.
-                        // Find future value for next by repeating next = *next until next >= last_fragment.
-                        uint32_t next_missing_fragment = next_frag;
-                        while (next_missing_fragment < last_fragment)
-                        {
-                            next_missing_fragment = get_next_missing_fragment(next_missing_fragment);
-                            at_least_one_changed = true;
-                        }
-
-                        // Update next and finish loop
-                        if (at_least_one_changed)
-                        {
-                            set_next_missing_fragment(current_frag, next_missing_fragment);
-                        }
-                        break;
-                    }
-                    current_frag = next_frag;
-                }
+                first_missing_fragment_ = get_next_missing_fragment(first_missing_fragment_);
             }
         }
 
@@ -0,0 +1,46 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReceivePipelineStatistics.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_COMMON_RECEIVEPIPELINESTATISTICS_HPP_
+#define _FASTDDS_RTPS_COMMON_RECEIVEPIPELINESTATISTICS_HPP_
+
+#include <cstdint>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Counters of the receive pipeline stage, enabled with the property fastdds.receive_pipeline_depth.
+ * All of them are zero when the pipeline is not enabled.
+ */
+struct ReceivePipelineStatistics
+{
+    //! Number of messages waiting to be processed
+    uint32_t queue_depth = 0;
+    //! Highest number of messages that have been waiting to be processed at the same time
+    uint32_t max_queue_depth = 0;
+    //! Number of messages dropped because all the pipeline buffers were waiting to be processed
+    uint64_t dropped = 0;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif /* _FASTDDS_RTPS_COMMON_RECEIVEPIPELINESTATISTICS_HPP_ */
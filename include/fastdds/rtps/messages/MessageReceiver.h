@@ -20,11 +20,12 @@
 #define _FASTDDS_RTPS_MESSAGERECEIVER_H_
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <atomic>
 #include <functional>
+#include <mutex>
 #include <unordered_map>
 
 #include <fastdds/rtps/common/all_common.h>
-#include <fastrtps/utils/shared_mutex.hpp>
 
 namespace eprosima {
 namespace fastrtps {
@@ -59,11 +60,14 @@ public:
      * @param [in] source_locator Locator indicating the sending address.
      * @param [in] reception_locator Locator indicating the listening address.
      * @param [in] msg Pointer to the message
+     * @param [in] reception_timestamp Time at which the message was received by the network stack,
+     * or c_RTPSTimeZero when not captured by the transport.
      */
     void processCDRMsg(
             const Locator_t& source_locator,
             const Locator_t& reception_locator,
-            CDRMessage_t* msg);
+            CDRMessage_t* msg,
+            const Time_t& reception_timestamp = c_RTPSTimeZero);
 
     // Functions to associate/remove associatedendpoints
     void associateEndpoint(
@@ -73,9 +77,64 @@ public:
 
 private:
 
-    mutable eprosima::shared_mutex mtx_;
-    std::vector<RTPSWriter*> associated_writers_;
-    std::unordered_map<EntityId_t, std::vector<RTPSReader*>> associated_readers_;
+    /**
+     * Immutable snapshot of the endpoints associated to the receiver.
+     * Every association or removal publishes a new snapshot, so the processing of the submessages reads it
+     * without locking.
+     */
+    struct EndpointTable
+    {
+        std::vector<RTPSWriter*> writers;
+        std::unordered_map<EntityId_t, std::vector<RTPSReader*>> readers;
+    };
+
+    /**
+     * Marks the calling thread as a reader of the endpoint table while alive.
+     * Snapshots replaced while some thread reads the table are not deleted until all the readers leave.
+     */
+    class EndpointTableReader
+    {
+    public:
+
+        explicit EndpointTableReader(
+                const MessageReceiver& receiver)
+            : receiver_(receiver)
+        {
+            receiver_.endpoint_table_readers_.fetch_add(1);
+        }
+
+        ~EndpointTableReader()
+        {
+            receiver_.endpoint_table_readers_.fetch_sub(1, std::memory_order_release);
+        }
+
+    private:
+
+        const MessageReceiver& receiver_;
+    };
+
+    /**
+     * Current snapshot of the associated endpoints.
+     * @pre The calling thread holds an EndpointTableReader, or update_mtx_.
+     */
+    const EndpointTable& endpoints() const
+    {
+        return *endpoint_table_.load();
+    }
+
+    /**
+     * Publishes a new snapshot of the associated endpoints, and deletes the replaced one once no thread reads it.
+     * @pre The calling thread holds update_mtx_.
+     */
+    void publish_endpoints(
+            EndpointTable* table);
+
+    //! Serializes the updates of the endpoint table
+    std::mutex update_mtx_;
+    //! Current snapshot of the associated endpoints
+    std::atomic<EndpointTable*> endpoint_table_;
+    //! Number of threads reading the endpoint table
+    mutable std::atomic<uint32_t> endpoint_table_readers_;
 
     RTPSParticipantImpl* participant_;
     //!Protocol version of the message
@@ -90,6 +149,8 @@ private:
     bool have_timestamp_;
     //!Timestamp associated with the message
     Time_t timestamp_;
+    //!Time at which the message was received by the network stack
+    Time_t reception_timestamp_;
 
 #if HAVE_SECURITY
     //!Buffer to process the decoded RTPS message
@@ -100,6 +161,9 @@ private:
     SerializedPayload_t crypto_payload_;
 #endif // if HAVE_SECURITY
 
+    // The state above is only used by the thread processing a message, as ReceiverResource serializes the calls
+    // to processCDRMsg, so it is not protected.
+
     //! Function used to process a received message
     std::function<void(
                 const EntityId_t&,
@@ -135,7 +199,7 @@ private:
             SubmessageHeader_t* smh) const;
 
     /**
-     * Find if there is a reader (in associated_readers_) that will accept a msg directed
+     * Find if there is a reader (in the endpoint table) that will accept a msg directed
      * to the given entity ID.
      */
     bool willAReaderAcceptMsgDirectedTo(
@@ -143,7 +207,7 @@ private:
             RTPSReader*& first_reader) const;
 
     /**
-     * Find all readers (in associated_readers_), with the given entity ID, and call the
+     * Find all readers (in the endpoint table), with the given entity ID, and call the
      * callback provided.
      */
     template<typename Functor>
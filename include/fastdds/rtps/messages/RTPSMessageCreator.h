@@ -112,6 +112,8 @@ public:
      * @param[out] msg Pointer to where the message is going to be created and stored.
      * @param[in] guidPrefix Guid Prefix of the RTPSParticipant.
      * @param[in] param Different parameters depending on the message.
+     * @param[out] payload_position When given to a DATA or DATA_FRAG creator, the payload is not copied into the
+     * message. The position where it should go is stored here, and the size of the submessage accounts for it.
      * @return True if correct.
      */
 
@@ -133,7 +135,8 @@ public:
             const EntityId_t& readerId,
             bool expectsInlineQos,
             InlineQosWriter* inlineQos,
-            bool* is_big_submessage);
+            bool* is_big_submessage,
+            uint32_t* payload_position = nullptr);
 
     static bool addMessageDataFrag(
             CDRMessage_t* msg,
@@ -152,7 +155,8 @@ public:
             TopicKind_t topicKind,
             const EntityId_t& readerId,
             bool expectsInlineQos,
-            InlineQosWriter* inlineQos);
+            InlineQosWriter* inlineQos,
+            uint32_t* payload_position = nullptr);
 
     static bool addMessageGap(
             CDRMessage_t* msg,
@@ -24,6 +24,7 @@
 #include <fastdds/rtps/messages/RTPSMessageSenderInterface.hpp>
 #include <fastdds/rtps/messages/RTPSMessageCreator.h>
 #include <fastdds/rtps/common/FragmentNumber.h>
+#include <fastdds/rtps/transport/NetworkBuffer.hpp>
 
 #include <vector>
 #include <chrono>
@@ -259,6 +260,8 @@ private:
 
     static constexpr uint32_t data_frag_header_size_ = 28;
     static constexpr uint32_t max_inline_qos_size_ = 32;
+    //! Maximum number of RTPS messages sent with a single segmented send
+    static constexpr uint32_t max_segments_ = 64;
 
     void reset_to_header();
 
@@ -266,6 +269,23 @@ private:
 
     void send();
 
+    //! Sends the message along with the payload on its own buffer. Should be called with the sender locked.
+    void send_gather();
+
+    /**
+     * Tries to keep a message on the segments buffer, so it is sent together with the next ones.
+     * @param msg Message to keep.
+     * @return true when the message was kept (and maybe sent), false when it should be sent by the caller.
+     */
+    bool add_to_segments(
+            CDRMessage_t* msg);
+
+    //! Sends the messages kept on the segments buffer. Should be called with the sender locked.
+    void send_segments();
+
+    //! Sends the messages kept on the segments buffer, locking the sender.
+    void flush_segments();
+
     void check_and_maybe_flush()
     {
         check_and_maybe_flush(sender_->destination_guid_prefix());
@@ -274,15 +294,40 @@ private:
     void check_and_maybe_flush(
             const GuidPrefix_t& destination_guid_prefix);
 
+    /**
+     * Whether a payload can be sent from its own buffer instead of being copied into the message.
+     * @param payload_size Size of the payload (or of the fragment).
+     * @param is_fragment Whether the payload goes on a DATA_FRAG submessage.
+     */
+    bool can_reference_payload(
+            uint32_t payload_size,
+            bool is_fragment) const;
+
     bool insert_submessage(
-            bool is_big_submessage)
+            bool is_big_submessage,
+            const octet* referenced_payload = nullptr,
+            uint32_t referenced_payload_size = 0,
+            uint32_t referenced_payload_pos = 0)
     {
-        return insert_submessage(sender_->destination_guid_prefix(), is_big_submessage);
+        return insert_submessage(sender_->destination_guid_prefix(), is_big_submessage,
+                       referenced_payload, referenced_payload_size, referenced_payload_pos);
     }
 
+    /**
+     * Appends the submessage being built to the message.
+     * @param destination_guid_prefix Destination of the submessage.
+     * @param is_big_submessage Whether the submessage is bigger than 64KB.
+     * @param referenced_payload Payload not copied into the submessage, or nullptr.
+     * The message is sent right away when given, so the payload is not referenced beyond the call.
+     * @param referenced_payload_size Size of the payload not copied into the submessage.
+     * @param referenced_payload_pos Position of the payload on the submessage.
+     */
     bool insert_submessage(
             const GuidPrefix_t& destination_guid_prefix,
-            bool is_big_submessage);
+            bool is_big_submessage,
+            const octet* referenced_payload = nullptr,
+            uint32_t referenced_payload_size = 0,
+            uint32_t referenced_payload_pos = 0);
 
     bool add_info_dst_in_buffer(
             CDRMessage_t* buffer,
@@ -304,6 +349,29 @@ private:
 
     CDRMessage_t* submessage_msg_ = nullptr;
 
+    CDRMessage_t* segments_msg_ = nullptr;
+
+    //! Maximum size of the segments buffer. 0 when segmented sends are disabled.
+    uint32_t max_segmented_size_ = 0;
+
+    //! Size of the messages kept on the segments buffer
+    uint32_t segment_size_ = 0;
+
+    //! Whether the message being built contains a DATA_FRAG submessage
+    bool full_msg_has_data_frag_ = false;
+
+    //! Payload sent from its own buffer along with the message being built. nullptr when there is none.
+    const octet* referenced_payload_ = nullptr;
+
+    //! Size of the payload sent from its own buffer
+    uint32_t referenced_payload_size_ = 0;
+
+    //! Position of the payload sent from its own buffer on the message being built
+    uint32_t referenced_payload_pos_ = 0;
+
+    //! Slices of the message when it is sent along with a payload on its own buffer
+    std::vector<fastdds::rtps::NetworkBuffer> buffers_;
+
     GuidPrefix_t current_dst_;
 
     RTPSParticipantImpl* participant_ = nullptr;
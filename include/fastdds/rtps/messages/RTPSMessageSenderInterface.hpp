@@ -22,11 +22,13 @@
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <algorithm>
 #include <chrono>
 #include <vector>
 
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/messages/CDRMessage.h>
+#include <fastdds/rtps/transport/NetworkBuffer.hpp>
 
 namespace eprosima {
 namespace fastrtps {
@@ -82,6 +84,50 @@ public:
             CDRMessage_t* message,
             std::chrono::steady_clock::time_point max_blocking_time_point) const = 0;
 
+    /**
+     * Send a message, given as a list of slices, through this interface.
+     *
+     * The default implementation sends the message, or each of its segments, with send(). The slices are copied
+     * into a buffer reused between calls unless the message is given on a single slice.
+     *
+     * @param buffers Slices of the message already serialized.
+     * @param total_bytes Size of the message.
+     * @param segment_size When not zero, the message holds several consecutive RTPS messages of this size (the last
+     * one may be shorter). Such messages are given on a single slice.
+     * @param max_blocking_time_point Future timepoint where blocking send should end.
+     */
+    virtual bool send_gather(
+            const std::vector<fastdds::rtps::NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            uint32_t segment_size,
+            std::chrono::steady_clock::time_point max_blocking_time_point) const
+    {
+        const octet* data = buffers.front().buffer;
+        if (1 < buffers.size())
+        {
+            static thread_local std::vector<octet> flat_message;
+            flat_message.resize(total_bytes);
+            fastdds::rtps::copy_network_buffers(buffers, total_bytes, flat_message.data());
+            data = flat_message.data();
+        }
+
+        if (0 == segment_size)
+        {
+            segment_size = total_bytes;
+        }
+
+        bool ret_val = true;
+        for (uint32_t offset = 0; ret_val && offset < total_bytes; offset += segment_size)
+        {
+            CDRMessage_t segment(0);
+            segment.init(const_cast<octet*>(data) + offset, (std::min)(segment_size, total_bytes - offset));
+            segment.length = segment.max_size;
+            ret_val = send(&segment, max_blocking_time_point);
+        }
+
+        return ret_val;
+    }
+
     /*!
      * Lock the object.
      */
@@ -26,6 +26,7 @@
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
 #include <fastdds/rtps/builtin/data/ContentFilterProperty.hpp>
+#include <fastdds/rtps/common/ReceivePipelineStatistics.hpp>
 #include <fastdds/statistics/IListeners.hpp>
 #include <fastrtps/fastrtps_dll.h>
 #include <fastrtps/qos/ReaderQos.h>
@@ -226,6 +227,14 @@ public:
      */
     uint32_t getMaxDataSize() const;
 
+    /**
+     * Retrieves the counters of the receive pipeline stage, added up over all the receive resources.
+     * The pipeline is enabled with the property fastdds.receive_pipeline_depth.
+     * @return Queue depth and dropped messages of the receive pipeline. The highest queue depth is the one of the
+     * busiest receive resource.
+     */
+    fastdds::rtps::ReceivePipelineStatistics get_receive_pipeline_statistics() const;
+
     ResourceEvent& get_resource_event() const;
 
     /**
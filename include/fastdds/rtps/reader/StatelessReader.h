@@ -27,6 +27,7 @@
 
 #include <mutex>
 #include <map>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -262,7 +263,8 @@ private:
         GUID_t guid;
         GUID_t persistence_guid;
         bool has_manual_topic_liveliness = false;
-        CacheChange_t* fragmented_change = nullptr;
+        //! Changes being reassembled from the fragments of this writer
+        std::vector<CacheChange_t*> fragmented_changes;
         bool is_datasharing = false;
         uint32_t ownership_strength;
     };
@@ -287,6 +289,15 @@ private:
             const GUID_t& writerGUID,
             bool is_payload_pool_lost = false);
 
+    /**
+     * Releases the changes being reassembled from the fragments of a writer.
+     * @param writer Information of the remote writer.
+     * @param release_all Whether every change is released, or only those which will never be notified.
+     */
+    void release_fragmented_changes(
+            RemoteWriterInfo_t& writer,
+            bool release_all);
+
 
     //!List of GUID_t os matched writers.
     //!Is only used in the Discovery, to correctly notify the user using SubscriptionListener::onSubscriptionMatched();
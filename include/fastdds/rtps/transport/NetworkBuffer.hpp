@@ -0,0 +1,88 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file NetworkBuffer.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_TRANSPORT_NETWORKBUFFER_HPP_
+#define _FASTDDS_RTPS_TRANSPORT_NETWORKBUFFER_HPP_
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <fastdds/rtps/common/Types.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * A slice of a message to be sent.
+ * A message can be given to the transports as a list of slices, which are sent one after another as a single
+ * message. This allows sending data without first copying it into a single buffer.
+ *
+ * @ingroup TRANSPORT_MODULE
+ */
+struct NetworkBuffer
+{
+    //! Pointer to the data of the slice
+    const fastrtps::rtps::octet* buffer = nullptr;
+
+    //! Number of bytes of the slice
+    uint32_t size = 0;
+
+    NetworkBuffer() = default;
+
+    NetworkBuffer(
+            const fastrtps::rtps::octet* data,
+            uint32_t data_size)
+        : buffer(data)
+        , size(data_size)
+    {
+    }
+
+};
+
+/**
+ * Copies the slices of a message, one after another, into a buffer.
+ * @param buffers Slices of the message.
+ * @param total_bytes Number of bytes to copy. Should not exceed the sum of the sizes of the slices.
+ * @param destination Buffer where the message is copied. Should have room for @c total_bytes.
+ */
+inline void copy_network_buffers(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        fastrtps::rtps::octet* destination)
+{
+    for (const NetworkBuffer& buffer : buffers)
+    {
+        if (0 == total_bytes)
+        {
+            break;
+        }
+
+        uint32_t size = buffer.size < total_bytes ? buffer.size : total_bytes;
+        memcpy(destination, buffer.buffer, size);
+        destination += size;
+        total_bytes -= size;
+    }
+}
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_RTPS_TRANSPORT_NETWORKBUFFER_HPP_
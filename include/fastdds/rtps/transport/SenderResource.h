@@ -22,6 +22,7 @@
 #include <chrono>
 
 #include <fastdds/rtps/common/Locator.h>
+#include <fastdds/rtps/transport/NetworkBuffer.hpp>
 
 namespace eprosima {
 namespace fastrtps {
@@ -69,6 +70,50 @@ public:
         return returned_value;
     }
 
+    /**
+     * Sends a message, given as a list of slices, to a destination locator, through the channel managed by this
+     * resource. The slices are sent one after another, without being copied into a single buffer first when the
+     * transport allows it.
+     * @param buffers Slices of the message to be sent.
+     * @param total_bytes Length of the message. Sum of the sizes of the slices.
+     * @param segment_size When not zero, the message holds several consecutive RTPS messages of this size (the
+     * last one may be shorter), sent as separate datagrams with a single operation. Such messages are given on a
+     * single slice.
+     * @param destination_locators_begin destination endpoint Locators iterator begin.
+     * @param destination_locators_end destination endpoint Locators iterator end.
+     * @param max_blocking_time_point If transport supports it then it will use it as maximum blocking time.
+     * @return Success of the send operation.
+     * @pre supports_gather_send(segment_size) returns true.
+     */
+    bool send_gather(
+            const std::vector<fastdds::rtps::NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            uint32_t segment_size,
+            LocatorsIterator* destination_locators_begin,
+            LocatorsIterator* destination_locators_end,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point)
+    {
+        bool returned_value = false;
+
+        if (send_gather_lambda_)
+        {
+            returned_value = send_gather_lambda_(buffers, total_bytes, segment_size, destination_locators_begin,
+                            destination_locators_end, max_blocking_time_point);
+        }
+
+        return returned_value;
+    }
+
+    /**
+     * Whether this resource is able to send a message given as a list of slices through send_gather().
+     * @param segment_size Size of the segments of the message, or 0 when it holds a single RTPS message.
+     */
+    bool supports_gather_send(
+            uint32_t segment_size = 0) const
+    {
+        return static_cast<bool>(send_gather_lambda_) && (0 == segment_size || gather_segments_);
+    }
+
     /**
      * Resources can only be transfered through move semantics. Copy, assignment, and
      * construction outside of the factory are forbidden.
@@ -78,6 +123,8 @@ public:
     {
         clean_up.swap(rValueResource.clean_up);
         send_lambda_.swap(rValueResource.send_lambda_);
+        send_gather_lambda_.swap(rValueResource.send_gather_lambda_);
+        gather_segments_ = rValueResource.gather_segments_;
     }
 
     virtual ~SenderResource() = default;
@@ -115,6 +162,15 @@ protected:
                 LocatorsIterator* destination_locators_begin,
                 LocatorsIterator* destination_locators_end,
                 const std::chrono::steady_clock::time_point&)> send_lambda_;
+    std::function<bool(
+                const std::vector<fastdds::rtps::NetworkBuffer>&,
+                uint32_t,
+                uint32_t,
+                LocatorsIterator* destination_locators_begin,
+                LocatorsIterator* destination_locators_end,
+                const std::chrono::steady_clock::time_point&)> send_gather_lambda_;
+    //! Whether send_gather_lambda_ accepts messages made of several segments
+    bool gather_segments_ = false;
 
 private:
 
@@ -53,6 +53,16 @@ namespace rtps {
  *
  * - \c tls_config: Configuration for TLS.
  *
+ * - \c reactor_threads: number of threads reading from all the channels of the transport. When 0, each channel is
+ *   read by its own thread.
+ *
+ * - \c reactor_thread: thread settings of the threads reading from all the channels of the transport.
+ *
+ * - \c send_queue_size: maximum number of bytes queued on each channel waiting for its socket to accept them.
+ *   When 0, sends block until the socket accepts all the bytes.
+ *
+ * - \c connection_streams: number of TCP connections opened to each remote locator.
+ *
  * @ingroup TRANSPORT_MODULE
  */
 struct TCPTransportDescriptor : public SocketTransportDescriptor
@@ -276,6 +286,44 @@ struct TCPTransportDescriptor : public SocketTransportDescriptor
     //! Thread settings for the accept connections thread
     ThreadSettings accept_thread;
 
+    /**
+     * Number of threads reading from all the channels of the transport.
+     *
+     * When greater than 0, the channels do not have a listening thread of their own. Instead, a pool of
+     * reactor_threads threads, along with the accept connections thread, reads from all the channels with
+     * asynchronous operations, so no thread is blocked on a channel. This reduces the number of threads of transports
+     * connected to a lot of peers.
+     * Channels using TLS are always read by their own thread.
+     * Default value is 0, one listening thread per channel.
+     */
+    uint32_t reactor_threads = 0;
+
+    //! Thread settings for the reactor_threads threads reading from all the channels of the transport
+    ThreadSettings reactor_thread;
+
+    /**
+     * Maximum number of bytes queued on each channel waiting for its socket to accept them.
+     *
+     * When greater than 0, sends do not block: the bytes the socket does not accept are queued on the channel
+     * and written as the socket becomes writable. Messages which do not fit on the queue are dropped, so a slow
+     * peer does not hold back the writers sending to other peers.
+     * Channels using TLS always block.
+     * Default value is 0, sends block until the socket accepts all the bytes.
+     */
+    uint32_t send_queue_size = 0;
+
+    /**
+     * Number of TCP connections opened to each remote locator.
+     *
+     * When greater than 1, user writers of big samples (fragmented, or sent in messages of 8KB or more) are spread
+     * over the additional connections, so discovery traffic, the messages of readers and the writers of small
+     * samples, which use the first connection, do not wait behind them. Each writer always uses the connection
+     * chosen on its first sample, so its messages keep their order: while that connection is being established
+     * again, the messages of the writer are dropped, and reliable writers send them again when requested.
+     * Default value is 1, a single connection per remote locator.
+     */
+    uint16_t connection_streams = 1;
+
     //! Add listener port to the listening_ports list
     void add_listener_port(
             uint16_t port)
@@ -143,6 +143,43 @@ public:
             TransportReceiverInterface*,
             uint32_t) = 0;
 
+    /**
+     * Number of receivers that should be attached to the input channel of the given locator.
+     *
+     * Transports able to process the traffic of an input channel in parallel return a value greater than 1.
+     * In that case, OpenInputChannel is expected to be called that many times for the same locator, each call
+     * attaching a different receiver interface which will be fed by its own listening thread.
+     *
+     * @param locator Locator of the input channel.
+     *
+     * @return The number of receivers to attach to the input channel.
+     */
+    virtual uint32_t input_channel_shards(
+            const Locator& locator) const
+    {
+        (void)locator;
+        return 1;
+    }
+
+    /**
+     * Closes the part of an input channel feeding the given receiver, leaving its other shards open.
+     * The whole channel is closed when no other shard remains.
+     *
+     * Transports not opening several receivers per input channel close the whole channel.
+     *
+     * @param locator Locator of the input channel.
+     * @param receiver Receiver interface attached by OpenInputChannel.
+     *
+     * @return true if any part of the channel was closed.
+     */
+    virtual bool close_input_channel_shard(
+            const Locator& locator,
+            TransportReceiverInterface* receiver)
+    {
+        (void)receiver;
+        return CloseInputChannel(locator);
+    }
+
     /**
      * Must close the channel that maps to/from the given locator.
      * IMPORTANT: It MUST be safe to call this method even during a Receive operation on another thread. You must implement
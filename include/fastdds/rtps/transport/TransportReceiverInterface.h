@@ -16,6 +16,7 @@
 #define _FASTDDS_TRANSPORT_RECEIVER_INTERFACE_H
 
 #include <fastdds/rtps/common/Locator.h>
+#include <fastdds/rtps/common/Time_t.h>
 
 namespace eprosima {
 namespace fastdds {
@@ -44,6 +45,27 @@ public:
             const uint32_t size,
             const Locator& local_locator,
             const Locator& remote_locator) = 0;
+
+    /**
+     * Method to be called by the transport when receiving data along with the time at which the network
+     * stack received it.
+     * The default implementation discards the reception time.
+     * @param data Pointer to the received data.
+     * @param size Number of bytes received.
+     * @param local_locator Locator identifying the local endpoint.
+     * @param remote_locator Locator identifying the remote endpoint.
+     * @param reception_timestamp Time at which the data was received by the network stack.
+     */
+    virtual void OnTimestampedDataReceived(
+            const fastrtps::rtps::octet* data,
+            const uint32_t size,
+            const Locator& local_locator,
+            const Locator& remote_locator,
+            const fastrtps::rtps::Time_t& reception_timestamp)
+    {
+        static_cast<void>(reception_timestamp);
+        OnDataReceived(data, size, local_locator, remote_locator);
+    }
 };
 
 } // namespace rtps
@@ -31,6 +31,26 @@ namespace rtps {
  * immediately if the buffer is full, but no error will be returned to the upper layer. This means that the
  * application will behave as if the datagram is sent and lost.
  *
+ * - \c receive_batch_size: maximum number of datagrams retrieved by a single receive operation on each
+ * input channel. Values greater than 1 enable the batched receive mode, only available on Linux.
+ *
+ * - \c segmentation_offload: send several equal-sized RTPS messages with a single system call, letting the kernel
+ * split them into datagrams (UDP GSO), and accept coalesced datagrams on reception (UDP GRO). Only available on Linux.
+ *
+ * - \c receive_shards: number of sockets opened with SO_REUSEPORT on each unicast input port, each one served by its
+ * own listening thread. Values greater than 1 are only honored on Linux.
+ *
+ * - \c zero_copy_send_threshold: minimum size of the datagrams handed to the kernel without copying their contents
+ * (MSG_ZEROCOPY). 0 disables zero-copy sends. Only available on Linux.
+ *
+ * - \c busy_poll_budget_us: time the listening threads poll their socket before blocking on it (us).
+ *
+ * - \c max_connected_sockets: maximum number of sockets connected to the most used unicast destinations on each
+ * output channel. 0 disables connected sockets. Only available on Linux.
+ *
+ * - \c receive_timestamps: take the reception time of the samples from the kernel (SO_TIMESTAMPING) instead of
+ * the time they reach the reader history. Only available on Linux.
+ *
  * @ingroup TRANSPORT_MODULE
  */
 struct UDPTransportDescriptor : public SocketTransportDescriptor
@@ -68,6 +88,96 @@ struct UDPTransportDescriptor : public SocketTransportDescriptor
      * datagram. This may hinder performance on high-frequency writers.
      */
     bool non_blocking_send = false;
+
+    /**
+     * Maximum number of datagrams retrieved from the socket on each receive operation.
+     *
+     * When set to a value greater than 1, each input channel preallocates that number of receive buffers and
+     * retrieves all the datagrams already queued on the socket (up to this limit) with a single system call
+     * (recvmmsg). This reduces the per-datagram overhead when bursts of small messages are received.
+     *
+     * This setting is only honored on Linux. On other platforms, datagrams are always received one by one.
+     */
+    uint32_t receive_batch_size = 1;
+
+    /**
+     * Whether to use UDP generic segmentation offload.
+     *
+     * When set to true, several consecutive RTPS messages of the same size (as the DATA_FRAG messages of a
+     * fragmented sample) are handed to the kernel with a single system call, which splits them into individual
+     * datagrams (UDP_SEGMENT). Input channels also accept datagrams coalesced by the kernel (UDP_GRO), splitting
+     * them back into the original RTPS messages.
+     *
+     * This setting is only honored on Linux. When the system does not support it, messages are sent and received
+     * one by one.
+     */
+    bool segmentation_offload = false;
+
+    /**
+     * Number of sockets opened on each unicast input port.
+     *
+     * When greater than 1, every unicast input channel is opened that many times with SO_REUSEPORT, each socket
+     * having its own listening thread and its own receiver resource. The kernel distributes incoming datagrams
+     * among them hashing the source and destination addresses, so the datagrams coming from the same remote
+     * socket (and therefore those of the same writer) are always processed in order by the same thread.
+     *
+     * This setting is only honored on Linux. The first socket of each port is bound without SO_REUSEPORT, which is
+     * only enabled once the port belongs to the transport, so ports in use by other participants are never shared.
+     */
+    uint32_t receive_shards = 1;
+
+    /**
+     * Minimum size of the datagrams sent without copying their contents into the kernel.
+     *
+     * When different from 0, send operations of at least this number of bytes (including the segmented sends of
+     * \c segmentation_offload) use MSG_ZEROCOPY: the network interface reads the data straight from the message
+     * buffer. The send operation then waits until the kernel notifies it has released the buffer, which may extend
+     * it beyond the maximum blocking time by the transmission time of the data. Each send only waits for its own
+     * notifications, so other sends proceed meanwhile. The wait never exceeds a second: past it, the output socket
+     * is replaced by a new one and later sends go back to copying the data.
+     *
+     * Pinning the buffer pages has a cost of its own, so this only pays off on big datagrams, typically above 10KB.
+     * The data is still copied when the destination is on the same host.
+     *
+     * This setting is only honored on Linux.
+     */
+    uint32_t zero_copy_send_threshold = 0;
+
+    /**
+     * Time the listening threads poll their socket for new datagrams before blocking on it (us).
+     *
+     * Polling avoids the latency of the wake-up of the listening threads at the cost of keeping a core busy
+     * while waiting, so the listening threads should be pinned with the reception thread settings of the
+     * descriptor. On Linux, the budget is also set as SO_BUSY_POLL on the input sockets when allowed, so the
+     * kernel polls the device queue as well. 0 disables polling.
+     */
+    uint32_t busy_poll_budget_us = 0;
+
+    /**
+     * Whether to use the time at which the kernel received the datagrams as reception time of the samples.
+     *
+     * When set to true, input channels request software reception timestamps (SO_TIMESTAMPING) on their sockets
+     * and the time taken by the kernel is stored as reception timestamp of the samples, instead of the time the
+     * samples reach the reader history. Comparing it with the time the samples are delivered to the application
+     * tells apart the time spent on the network from the time spent queued on the socket and being processed.
+     * For fragmented samples, the reception time is that of the datagram carrying the first fragment.
+     *
+     * Datagrams are then received through the batched receive mode. This setting is only honored on Linux.
+     */
+    bool receive_timestamps = false;
+
+    /**
+     * Maximum number of connected sockets on each output channel.
+     *
+     * When different from 0, unicast destinations which are sent to repeatedly get a socket of their own,
+     * connected to them, which saves the kernel the route and neighbour lookups done for each datagram sent
+     * through an unconnected socket. When the limit is reached, the socket of the least recently used destination
+     * is closed. Datagrams sent to several destinations at once keep using the unconnected socket.
+     *
+     * Connected sockets share the port of the output channel through SO_REUSEPORT, so each destination
+     * receives all the datagrams of the channel from the same source port. Only available on Linux.
+     */
+    uint32_t max_connected_sockets = 0;
 };
 
 } // namespace rtps
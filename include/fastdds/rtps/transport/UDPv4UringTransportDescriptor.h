@@ -0,0 +1,80 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTDDS_UDPV4_URING_TRANSPORT_DESCRIPTOR
+#define _FASTDDS_UDPV4_URING_TRANSPORT_DESCRIPTOR
+
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * UDPv4 Transport configuration for the io_uring based implementation.
+ * The kind value for UDPv4UringTransportDescriptor is given by \c eprosima::fastrtps::rtps::LOCATOR_KIND_UDPv4,
+ * so it replaces the builtin UDPv4 transport, which should be disabled when this one is used.
+ *
+ * Datagrams are received with multishot receive operations, the kernel placing them directly on a ring of
+ * preallocated buffers, and sent to all the destinations of a message with a single submission.
+ * When io_uring is not available on the running system, the transport behaves as the default UDPv4 one.
+ *
+ * - \c send_ring_entries: number of entries of the submission queue used to send.
+ *
+ * - \c receive_ring_buffers: number of buffers provided to the kernel by each input channel.
+ *
+ * @ingroup TRANSPORT_MODULE
+ */
+struct UDPv4UringTransportDescriptor : public UDPv4TransportDescriptor
+{
+    //! Destructor
+    virtual ~UDPv4UringTransportDescriptor() = default;
+
+    virtual TransportInterface* create_transport() const override;
+
+    //! Constructor
+    RTPS_DllAPI UDPv4UringTransportDescriptor();
+
+    //! Copy constructor
+    RTPS_DllAPI UDPv4UringTransportDescriptor(
+            const UDPv4UringTransportDescriptor& t) = default;
+
+    //! Copy assignment
+    RTPS_DllAPI UDPv4UringTransportDescriptor& operator =(
+            const UDPv4UringTransportDescriptor& t) = default;
+
+    RTPS_DllAPI bool operator ==(
+            const UDPv4UringTransportDescriptor& t) const;
+
+    /**
+     * Number of entries of the submission queue of each send ring.
+     *
+     * Each destination of a message takes two entries, so this limits the number of destinations handed
+     * to the kernel on each submission. A send ring is created for each thread sending at the same time.
+     */
+    uint32_t send_ring_entries = 256;
+
+    /**
+     * Number of receive buffers provided to the kernel by each input channel.
+     *
+     * It is rounded up to a power of two. Each buffer is able to hold a datagram of \c maxMessageSize bytes.
+     */
+    uint32_t receive_ring_buffers = 64;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_UDPV4_URING_TRANSPORT_DESCRIPTOR
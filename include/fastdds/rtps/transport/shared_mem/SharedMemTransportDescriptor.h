@@ -33,16 +33,30 @@ class TransportInterface;
  *
  * - segment_size_: size of the shared memory segment (in octets).
  *
+ * - max_segment_size_: size the shared memory segment can grow up to (in octets).
+ *
  * - port_queue_capacity_: size of the listening port (in messages).
  *
  * - healthy_check_timeout_ms_: timeout for the health check of ports (ms).
  *
  * - rtps_dump_file_: full path of the protocol dump file.
  *
+ * - busy_poll_budget_us_: time the listening threads poll their port before blocking (us).
+ *
+ * - huge_pages_: whether the shared memory segment is backed with huge pages when they are available.
+ *
+ * - numa_node_: NUMA node the pages of the shared memory segment are placed on.
+ *
  * @ingroup TRANSPORT_MODULE
  */
 struct SharedMemTransportDescriptor : public PortBasedTransportDescriptor
 {
+    //! Value of numa_node leaving the placement of the segment pages to the system
+    static constexpr int32_t numa_node_none = -1;
+
+    //! Value of numa_node placing the segment pages on the NUMA node of the thread creating the transport
+    static constexpr int32_t numa_node_local = -2;
+
     //! Destructor
     virtual ~SharedMemTransportDescriptor() = default;
 
@@ -78,6 +92,26 @@ struct SharedMemTransportDescriptor : public PortBasedTransportDescriptor
         segment_size_ = segment_size;
     }
 
+    //! Return the size the shared memory segment can grow up to (in octets)
+    RTPS_DllAPI uint32_t max_segment_size() const
+    {
+        return max_segment_size_;
+    }
+
+    /**
+     * Set the size the shared memory segment can grow up to (in octets).
+     *
+     * When the segment has no room for a new message, another segment of segment_size is chained to it instead
+     * of recovering buffers still enqueued for readers, until the chain reaches this size. Readers map the chained
+     * segments the first time they receive a message on them. A value not greater than segment_size, as the
+     * default 0, keeps the segment fixed.
+     */
+    RTPS_DllAPI void max_segment_size(
+            uint32_t max_segment_size)
+    {
+        max_segment_size_ = max_segment_size;
+    }
+
     //! Return the maximum size of a single message in the transport (in octets)
     virtual uint32_t max_message_size() const override
     {
@@ -143,6 +177,65 @@ struct SharedMemTransportDescriptor : public PortBasedTransportDescriptor
         dump_thread_ = dump_thread;
     }
 
+    /**
+     * Return the time the listening threads poll their port for new data before blocking (us).
+     * 0 means the threads block as soon as their port is empty.
+     */
+    RTPS_DllAPI uint32_t busy_poll_budget_us() const
+    {
+        return busy_poll_budget_us_;
+    }
+
+    /**
+     * Set the time the listening threads poll their port for new data before blocking (us).
+     *
+     * Polling avoids the latency of the wake-up of the listening threads at the cost of keeping a core busy
+     * while waiting. The listening threads should be pinned with the reception thread settings of the descriptor.
+     */
+    RTPS_DllAPI void busy_poll_budget_us(
+            uint32_t busy_poll_budget_us)
+    {
+        busy_poll_budget_us_ = busy_poll_budget_us;
+    }
+
+    //! Return whether the shared memory segment is backed with huge pages when they are available
+    RTPS_DllAPI bool huge_pages() const
+    {
+        return huge_pages_;
+    }
+
+    /**
+     * Set whether the shared memory segment is backed with huge pages when they are available.
+     *
+     * Huge pages reduce the TLB misses of processes accessing big segments. On Linux they are transparent huge
+     * pages, which the system administrator should enable for shared memory. The segment falls back to default
+     * pages when they are not available.
+     */
+    RTPS_DllAPI void huge_pages(
+            bool huge_pages)
+    {
+        huge_pages_ = huge_pages;
+    }
+
+    //! Return the NUMA node the pages of the shared memory segment are placed on
+    RTPS_DllAPI int32_t numa_node() const
+    {
+        return numa_node_;
+    }
+
+    /**
+     * Set the NUMA node the pages of the shared memory segment are placed on.
+     *
+     * numa_node_local places them on the node of the thread creating the transport, which is the node of the
+     * publishing threads when they are pinned along with it. Pages are placed on other nodes when the chosen one
+     * runs out of memory. numa_node_none, the default, leaves the placement to the system.
+     */
+    RTPS_DllAPI void numa_node(
+            int32_t numa_node)
+    {
+        numa_node_ = numa_node;
+    }
+
     //! Comparison operator
     RTPS_DllAPI bool operator ==(
             const SharedMemTransportDescriptor& t) const;
@@ -150,9 +243,13 @@ struct SharedMemTransportDescriptor : public PortBasedTransportDescriptor
 private:
 
     uint32_t segment_size_;
+    uint32_t max_segment_size_;
     uint32_t port_queue_capacity_;
     uint32_t healthy_check_timeout_ms_;
     std::string rtps_dump_file_;
+    uint32_t busy_poll_budget_us_;
+    bool huge_pages_;
+    int32_t numa_node_;
 
     //! Thread settings for the transport dump thread
     ThreadSettings dump_thread_;
@@ -76,6 +76,21 @@ public:
             CDRMessage_t* message,
             std::chrono::steady_clock::time_point max_blocking_time_point) const override;
 
+    /*!
+     * Send a message, given as a list of slices, through this interface.
+     *
+     * @param buffers Slices of the message already serialized.
+     * @param total_bytes Size of the message.
+     * @param segment_size When not zero, the message holds several consecutive RTPS messages of this size (the last
+     * one may be shorter).
+     * @param max_blocking_time_point Future timepoint where blocking send should end.
+     */
+    bool send_gather(
+            const std::vector<fastdds::rtps::NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            uint32_t segment_size,
+            std::chrono::steady_clock::time_point max_blocking_time_point) const override;
+
     /*!
      * Lock the object.
      *
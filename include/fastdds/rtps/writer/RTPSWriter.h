@@ -520,6 +520,24 @@ public:
             const LocatorSelectorSender& locator_selector,
             std::chrono::steady_clock::time_point& max_blocking_time_point) const;
 
+    /**
+     * Send a message, given as a list of slices, through this interface.
+     *
+     * @param buffers Slices of the message already serialized.
+     * @param total_bytes Size of the message.
+     * @param segment_size When not zero, the message holds several consecutive RTPS messages of this size (the last
+     * one may be shorter).
+     * @param locator_selector RTPSMessageSenderInterface reference uses for selecting locators. The reference has to
+     * be a member of this RTPSWriter object.
+     * @param max_blocking_time_point Future timepoint where blocking send should end.
+     */
+    virtual bool send_gather_nts(
+            const std::vector<fastdds::rtps::NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            uint32_t segment_size,
+            const LocatorSelectorSender& locator_selector,
+            std::chrono::steady_clock::time_point& max_blocking_time_point) const;
+
 protected:
 
     //!Is the data sent directly or announced by HB and THEN sent to the ones who ask for it?.
@@ -60,6 +60,15 @@ extern const char* RECEIVE_BUFFER_SIZE;
 extern const char* SEND_BUFFER_SIZE;
 extern const char* TTL;
 extern const char* NON_BLOCKING_SEND;
+extern const char* SEND_RING_ENTRIES;
+extern const char* RECEIVE_RING_BUFFERS;
+extern const char* RECEIVE_BATCH_SIZE;
+extern const char* SEGMENTATION_OFFLOAD;
+extern const char* RECEIVE_SHARDS;
+extern const char* ZERO_COPY_SEND_THRESHOLD;
+extern const char* BUSY_POLL_BUDGET_US;
+extern const char* RECEIVE_TIMESTAMPS;
+extern const char* MAX_CONNECTED_SOCKETS;
 extern const char* WHITE_LIST;
 extern const char* INTERFACE;
 extern const char* MAX_MESSAGE_SIZE;
@@ -76,11 +85,18 @@ extern const char* CALCULATE_CRC;
 extern const char* CHECK_CRC;
 extern const char* KEEP_ALIVE_THREAD;
 extern const char* ACCEPT_THREAD;
+extern const char* REACTOR_THREADS;
+extern const char* REACTOR_THREAD;
+extern const char* SEND_QUEUE_SIZE;
+extern const char* CONNECTION_STREAMS;
 extern const char* SEGMENT_SIZE;
 extern const char* PORT_QUEUE_CAPACITY;
 extern const char* PORT_OVERFLOW_POLICY;
 extern const char* SEGMENT_OVERFLOW_POLICY;
 extern const char* HEALTHY_CHECK_TIMEOUT_MS;
+extern const char* HUGE_PAGES;
+extern const char* NUMA_NODE;
+extern const char* MAX_SEGMENT_SIZE;
 extern const char* DISCARD;
 extern const char* FAIL;
 extern const char* RTPS_DUMP_FILE;
@@ -175,6 +191,7 @@ extern const char* ENTITY_ID;
 extern const char* MATCHED_SUBSCRIBERS_ALLOCATION;
 extern const char* MATCHED_PUBLISHERS_ALLOCATION;
 extern const char* DATA_SHARING_LISTENER_THREAD;
+extern const char* DATA_SHARING_SPIN_DURATION;
 
 ///
 extern const char* IGN_NON_MATCHING_LOCS;
@@ -199,6 +216,7 @@ extern const char* WAN_ADDRESS;
 extern const char* RESERVED;
 extern const char* UDPv4;
 extern const char* UDPv6;
+extern const char* UDPv4_URING;
 extern const char* TCPv4;
 extern const char* TCPv6;
 extern const char* SHM;
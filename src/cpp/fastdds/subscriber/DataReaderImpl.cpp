@@ -1594,6 +1594,12 @@ bool DataReaderImpl::can_qos_be_updated(
         EPROSIMA_LOG_WARNING(RTPS_QOS_CHECK,
                 "Data sharing configuration cannot be changed after the creation of a DataReader.");
     }
+    if (to.data_sharing().spin_duration() != from.data_sharing().spin_duration())
+    {
+        updatable = false;
+        EPROSIMA_LOG_WARNING(RTPS_QOS_CHECK,
+                "Data sharing configuration cannot be changed after the creation of a DataReader.");
+    }
     if (qos_has_unique_network_request(to) != qos_has_unique_network_request(from))
     {
         updatable = false;
@@ -0,0 +1,185 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DataSharingDispatcher.cpp
+ */
+
+#include <rtps/DataSharing/DataSharingDispatcher.hpp>
+#include <rtps/DataSharing/DataSharingListener.hpp>
+#include <utils/threading.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+std::shared_ptr<DataSharingDispatcher> DataSharingDispatcher::create(
+        const GUID_t& participant_guid,
+        const std::string& datasharing_pools_directory,
+        const fastdds::rtps::ThreadSettings& thr_config)
+{
+    std::shared_ptr<DataSharingNotification> notification =
+            DataSharingNotification::create_notification(participant_guid, datasharing_pools_directory);
+    if (!notification)
+    {
+        return std::shared_ptr<DataSharingDispatcher>(nullptr);
+    }
+
+    return std::make_shared<DataSharingDispatcher>(notification, thr_config);
+}
+
+DataSharingDispatcher::DataSharingDispatcher(
+        std::shared_ptr<DataSharingNotification> notification,
+        const fastdds::rtps::ThreadSettings& thr_config)
+    : notification_(notification)
+    , is_running_(true)
+{
+    dispatching_thread_ = create_thread([this]()
+                    {
+                        run();
+                    }, thr_config, "dds.dsha.disp");
+}
+
+DataSharingDispatcher::~DataSharingDispatcher()
+{
+    is_running_.store(false);
+
+    // Notify the thread and wait for it to finish
+    notification_->notify();
+    dispatching_thread_.join();
+
+    notification_->destroy();
+}
+
+void DataSharingDispatcher::add_listener(
+        DataSharingListener* listener)
+{
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        listeners_.push_back(listener);
+        listeners_changed_ = true;
+    }
+
+    // The listener may have been signaled before being added
+    notify();
+}
+
+void DataSharingDispatcher::remove_listener(
+        DataSharingListener* listener)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    auto it = std::find(listeners_.begin(), listeners_.end(), listener);
+    if (it != listeners_.end())
+    {
+        listeners_.erase(it);
+        listeners_changed_ = true;
+    }
+
+    // A listener removed from its own data processing cannot wait for it
+    if (!dispatching_thread_.is_calling_thread())
+    {
+        processing_cv_.wait(lock, [&]()
+                {
+                    return processing_listener_ != listener;
+                });
+    }
+}
+
+void DataSharingDispatcher::run()
+{
+    // Notifications from writers not aware of the dispatcher are found by a periodic scan
+    const std::chrono::milliseconds scan_period(100);
+
+    std::unique_lock<DataSharingNotification::Segment::mutex> lock(
+        notification_->notification_->notification_mutex, std::defer_lock);
+    while (is_running_.load())
+    {
+        try
+        {
+            lock.lock();
+            notification_->notification_->notification_cv.timed_wait(lock,
+                    std::chrono::steady_clock::now() + scan_period, [&]
+                    {
+                        return !is_running_.load() || notification_->notification_->new_data.load();
+                    });
+
+            lock.unlock();
+        }
+        catch (const boost::interprocess::interprocess_exception& /*e*/)
+        {
+            // Timeout when locking
+            continue;
+        }
+
+        if (!is_running_.load())
+        {
+            // Woke up because dispatcher is stopped
+            return;
+        }
+
+        // Clearing the flag before the scan makes writers signaling during the scan wake the dispatcher again
+        notification_->notification_->new_data.store(false);
+
+        // Readers with data left after their turn are processed again, after the rest of the readers
+        while (dispatch() && is_running_.load())
+        {
+        }
+    }
+}
+
+bool DataSharingDispatcher::dispatch()
+{
+    bool has_pending_data = false;
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    listeners_changed_ = false;
+    for (size_t i = 0; i < listeners_.size() && is_running_.load(); ++i)
+    {
+        DataSharingListener* listener = listeners_[i];
+        if (!listener->has_pending_data())
+        {
+            continue;
+        }
+
+        processing_listener_ = listener;
+        lock.unlock();
+
+        listener->process_new_data();
+        has_pending_data |= listener->is_running_.load() && listener->has_pending_data();
+
+        lock.lock();
+        processing_listener_ = nullptr;
+        processing_cv_.notify_all();
+
+        if (listeners_changed_)
+        {
+            // Indexes may have been shifted, so the scan is restarted.
+            // The listeners already processed are skipped as they have no pending data.
+            listeners_changed_ = false;
+            i = static_cast<size_t>(-1);
+        }
+    }
+
+    return has_pending_data;
+}
+
+}  // namespace rtps
+}  // namespace fastrtps
+}  // namespace eprosima
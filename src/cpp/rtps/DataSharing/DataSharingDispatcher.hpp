@@ -0,0 +1,134 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DataSharingDispatcher.hpp
+ */
+
+#ifndef RTPS_DATASHARING_DATASHARINGDISPATCHER_HPP
+#define RTPS_DATASHARING_DATASHARINGDISPATCHER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+#include <fastdds/rtps/common/Guid.h>
+
+#include <rtps/DataSharing/DataSharingNotification.hpp>
+#include <utils/thread.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class DataSharingListener;
+
+/**
+ * Waits for the data-sharing notifications of several readers on a single thread.
+ *
+ * The readers dispatched by a DataSharingDispatcher do not start a listening thread. Instead, they store the GUID
+ * of the dispatcher notification in their own notification, and the writers opening it signal the reader and then
+ * notify the dispatcher. The dispatcher thread processes the new data of every reader with its notification signaled.
+ *
+ * Notifications from writers not aware of the dispatcher only signal the reader, and they are found
+ * by the periodic scan of the dispatcher thread.
+ */
+class DataSharingDispatcher
+{
+
+public:
+
+    /**
+     * Creates the dispatcher of a participant, and starts its thread.
+     * @param participant_guid GUID of the participant. Its notification is created with this GUID.
+     * @param datasharing_pools_directory Shared memory directory where the notification is created.
+     * @param thr_config Settings of the dispatcher thread.
+     * @return The dispatcher, or nullptr if its notification could not be created.
+     */
+    static std::shared_ptr<DataSharingDispatcher> create(
+            const GUID_t& participant_guid,
+            const std::string& datasharing_pools_directory,
+            const fastdds::rtps::ThreadSettings& thr_config);
+
+    DataSharingDispatcher(
+            std::shared_ptr<DataSharingNotification> notification,
+            const fastdds::rtps::ThreadSettings& thr_config);
+
+    ~DataSharingDispatcher();
+
+    /**
+     * Returns the GUID of the notification of the dispatcher
+     */
+    const GUID_t& guid() const
+    {
+        return notification_->reader();
+    }
+
+    /**
+     * Starts dispatching the notifications of a listener.
+     * @param listener Listener of the reader to dispatch.
+     */
+    void add_listener(
+            DataSharingListener* listener);
+
+    /**
+     * Stops dispatching the notifications of a listener.
+     * When not called from the dispatcher thread, waits until the listener is not being processed.
+     * @param listener Listener of the reader to stop dispatching.
+     */
+    void remove_listener(
+            DataSharingListener* listener);
+
+    /**
+     * Wakes the dispatcher thread
+     */
+    void notify()
+    {
+        notification_->notify();
+    }
+
+private:
+
+    /**
+     * The body for the dispatcher thread
+     */
+    void run();
+
+    /**
+     * Processes the new data of the listeners with their notification signaled, one turn for each listener
+     * @return true if some listener has data left to process
+     */
+    bool dispatch();
+
+    std::shared_ptr<DataSharingNotification> notification_;
+    std::atomic<bool> is_running_;
+    eprosima::thread dispatching_thread_;
+
+    std::mutex mutex_;
+    std::condition_variable processing_cv_;
+    std::vector<DataSharingListener*> listeners_;
+    DataSharingListener* processing_listener_ = nullptr;
+    bool listeners_changed_ = false;
+
+};
+
+}  // namespace rtps
+}  // namespace fastrtps
+}  // namespace eprosima
+
+#endif  // RTPS_DATASHARING_DATASHARINGDISPATCHER_HPP
@@ -17,10 +17,12 @@
  */
 
 #include <rtps/DataSharing/DataSharingListener.hpp>
+#include <rtps/DataSharing/DataSharingDispatcher.hpp>
 #include <fastdds/rtps/reader/RTPSReader.h>
 #include <utils/thread.hpp>
 #include <utils/threading.hpp>
 
+#include <chrono>
 #include <memory>
 #include <mutex>
 
@@ -34,7 +36,9 @@ DataSharingListener::DataSharingListener(
         const std::string& datasharing_pools_directory,
         const fastdds::rtps::ThreadSettings& thr_config,
         ResourceLimitedContainerConfig limits,
-        RTPSReader* reader)
+        RTPSReader* reader,
+        std::shared_ptr<DataSharingDispatcher> dispatcher,
+        std::chrono::nanoseconds spin_duration)
     : notification_(notification)
     , is_running_(false)
     , reader_(reader)
@@ -42,7 +46,14 @@ DataSharingListener::DataSharingListener(
     , writer_pools_changed_(false)
     , datasharing_pools_directory_(datasharing_pools_directory)
     , thread_config_(thr_config)
+    , dispatcher_(dispatcher)
+    , spin_duration_(spin_duration)
 {
+    if (dispatcher_)
+    {
+        // Writers opening the notification from now on will wake the dispatcher
+        notification_->dispatcher(dispatcher_->guid());
+    }
 }
 
 DataSharingListener::~DataSharingListener()
@@ -56,20 +67,24 @@ void DataSharingListener::run()
     std::unique_lock<Segment::mutex> lock(notification_->notification_->notification_mutex, std::defer_lock);
     while (is_running_.load())
     {
-        try
+        // Data arriving while polling is processed without blocking on the condition variable
+        if (!spin_for_data())
         {
-            lock.lock();
-            notification_->notification_->notification_cv.wait(lock, [&]
-                    {
-                        return !is_running_.load() || notification_->notification_->new_data.load();
-                    });
+            try
+            {
+                lock.lock();
+                notification_->notification_->notification_cv.wait(lock, [&]
+                        {
+                            return !is_running_.load() || notification_->notification_->new_data.load();
+                        });
 
-            lock.unlock();
-        }
-        catch (const boost::interprocess::interprocess_exception& /*e*/)
-        {
-            // Timeout when locking
-            continue;
+                lock.unlock();
+            }
+            catch (const boost::interprocess::interprocess_exception& /*e*/)
+            {
+                // Timeout when locking
+                continue;
+            }
         }
 
         if (!is_running_.load())
@@ -84,11 +99,29 @@ void DataSharingListener::run()
 
             // If some writer added new data, there may be something to read.
             // If there were matching/unmatching, we may not have finished our last loop
-        } while (is_running_.load() &&
-        (notification_->notification_->new_data.load() || writer_pools_changed_.load(std::memory_order_relaxed)));
+        } while (is_running_.load() && has_pending_data());
     }
 }
 
+bool DataSharingListener::spin_for_data() const
+{
+    if (spin_duration_ <= std::chrono::nanoseconds::zero())
+    {
+        return false;
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + spin_duration_;
+    do
+    {
+        if (!is_running_.load() || notification_->notification_->new_data.load())
+        {
+            return true;
+        }
+    } while (std::chrono::steady_clock::now() < deadline);
+
+    return false;
+}
+
 void DataSharingListener::start()
 {
     std::lock_guard<std::mutex> guard(mutex_);
@@ -100,6 +133,12 @@ void DataSharingListener::start()
         return;
     }
 
+    if (dispatcher_)
+    {
+        dispatcher_->add_listener(this);
+        return;
+    }
+
     // Initialize the thread
     uint32_t thread_id = reader_->getGuid().entityId.to_uint32() & 0x0000FFFF;
     listening_thread_ = create_thread([this]()
@@ -121,6 +160,12 @@ void DataSharingListener::stop()
         }
     }
 
+    if (dispatcher_)
+    {
+        dispatcher_->remove_listener(this);
+        return;
+    }
+
     // Notify the thread and wait for it to finish
     notification_->notify();
     listening_thread_.join();
@@ -284,6 +329,11 @@ void DataSharingListener::notify(
     {
         process_new_data();
     }
+    else if (dispatcher_)
+    {
+        notification_->signal();
+        dispatcher_->notify();
+    }
     else
     {
         notification_->notify();
@@ -20,6 +20,7 @@
 #define RTPS_DATASHARING_DATASHARINGLISTENER_HPP
 
 #include <atomic>
+#include <chrono>
 #include <map>
 #include <memory>
 
@@ -36,11 +37,14 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+class DataSharingDispatcher;
 class RTPSReader;
 
 class DataSharingListener : public IDataSharingListener
 {
 
+    friend class DataSharingDispatcher;
+
 public:
 
     typedef DataSharingNotification::Notification Notification;
@@ -51,18 +55,20 @@ public:
             const std::string& datasharing_pools_directory,
             const fastdds::rtps::ThreadSettings& thr_config,
             ResourceLimitedContainerConfig limits,
-            RTPSReader* reader);
+            RTPSReader* reader,
+            std::shared_ptr<DataSharingDispatcher> dispatcher = nullptr,
+            std::chrono::nanoseconds spin_duration = std::chrono::nanoseconds::zero());
 
     virtual ~DataSharingListener();
 
     /**
-     * Starts the listening thread.
+     * Starts the listening thread, or the dispatching of the notifications by the dispatcher.
      * @throw std::exception on error
      */
     void start() override;
 
     /**
-     * Stops the listening thread.
+     * Stops the listening thread, or the dispatching of the notifications by the dispatcher.
      * @throw std::exception on error
      */
     void stop() override;
@@ -91,11 +97,26 @@ protected:
      */
     void run();
 
+    /**
+     * Polls the notification for new data, up to the configured spin duration
+     * @return true if new data arrived or the listener was stopped while polling
+     */
+    bool spin_for_data() const;
+
     /**
      * Processes a notification
      */
     void process_new_data();
 
+    /**
+     * Whether there is a notification, or a matching change, not processed yet
+     */
+    bool has_pending_data() const
+    {
+        return notification_->notification_->new_data.load() ||
+               writer_pools_changed_.load(std::memory_order_relaxed);
+    }
+
     struct WriterInfo
     {
         std::shared_ptr<ReaderPool> pool;
@@ -120,6 +141,8 @@ protected:
     std::atomic<bool> writer_pools_changed_;
     std::string datasharing_pools_directory_;
     fastdds::rtps::ThreadSettings thread_config_;
+    std::shared_ptr<DataSharingDispatcher> dispatcher_;
+    std::chrono::nanoseconds spin_duration_;
     mutable std::mutex mutex_;
 
 };
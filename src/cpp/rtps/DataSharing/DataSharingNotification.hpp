@@ -37,6 +37,7 @@ namespace rtps {
 class DataSharingNotification
 {
 
+    friend class DataSharingDispatcher;
     friend class DataSharingListener;
     friend class DataSharingNotifier;
 
@@ -66,6 +67,38 @@ public:
         }
     }
 
+    /**
+     * Signals new data without waking the threads waiting on the notification.
+     * Used when the notifications of the reader are waited by a dispatcher, which is woken apart.
+     */
+    inline void signal()
+    {
+        notification_->new_data.store(true);
+    }
+
+    /**
+     * Sets the dispatcher waiting for the notifications of the reader.
+     * Should be called before any writer opens the notification.
+     * @param dispatcher_guid GUID of the notification of the dispatcher
+     */
+    inline void dispatcher(
+            const GUID_t& dispatcher_guid)
+    {
+        if (dispatcher_)
+        {
+            *dispatcher_ = dispatcher_guid;
+        }
+    }
+
+    /**
+     * Returns the GUID of the notification of the dispatcher waiting for the notifications of the reader,
+     * or c_Guid_Unknown if the reader waits for them itself.
+     */
+    inline const GUID_t& dispatcher() const
+    {
+        return dispatcher_ ? *dispatcher_ : c_Guid_Unknown;
+    }
+
     /**
      * Returns the GUID of the reader listening to the notifications
      */
@@ -147,7 +180,8 @@ protected:
         {
             uint32_t per_allocation_extra_size = T::compute_per_allocation_extra_size(
                 alignof(Notification), DataSharingNotification::domain_name());
-            uint32_t segment_size = static_cast<uint32_t>(sizeof(Notification)) + per_allocation_extra_size;
+            uint32_t segment_size = static_cast<uint32_t>(sizeof(Notification) + sizeof(GUID_t)) +
+                    2 * per_allocation_extra_size;
 
             //Open the segment
             T::remove(segment_name_);
@@ -169,6 +203,7 @@ protected:
             // Alloc and initialize the Node
             notification_ = local_segment->get().template construct<Notification>("notification_node")();
             notification_->new_data.store(false);
+            dispatcher_ = local_segment->get().template construct<GUID_t>("dispatcher_node")();
         }
         catch (std::exception& e)
         {
@@ -218,6 +253,9 @@ protected:
             return false;
         }
 
+        // Notifications created by older versions have no dispatcher
+        dispatcher_ = (local_segment->get().template find<GUID_t>("dispatcher_node")).first;
+
         segment_ = std::move(local_segment);
         return true;
     }
@@ -227,6 +265,7 @@ protected:
 
     std::unique_ptr<Segment> segment_;  //< Shared memory segment
     Notification* notification_;        //< The notification data
+    GUID_t* dispatcher_ = nullptr;      //< The GUID of the dispatcher of the notifications
     bool owned_ = false;                //< Whether the shared segment is owned by this instance
 };
 
@@ -54,6 +54,11 @@ public:
             const GUID_t& reader_guid) override
     {
         shared_notification_ = DataSharingNotification::open_notification(reader_guid, directory_);
+        if (shared_notification_ && c_Guid_Unknown != shared_notification_->dispatcher())
+        {
+            dispatcher_notification_ = DataSharingNotification::open_notification(
+                shared_notification_->dispatcher(), directory_);
+        }
     }
 
     /**
@@ -61,6 +66,7 @@ public:
      */
     void disable() override
     {
+        dispatcher_notification_.reset();
         shared_notification_.reset();
     }
 
@@ -80,13 +86,23 @@ public:
         if (is_enabled())
         {
             EPROSIMA_LOG_INFO(RTPS_WRITER, "Notifying reader " << shared_notification_->reader());
-            shared_notification_->notify();
+            if (dispatcher_notification_)
+            {
+                // The reader notifications are waited by its participant's dispatcher
+                shared_notification_->signal();
+                dispatcher_notification_->notify();
+            }
+            else
+            {
+                shared_notification_->notify();
+            }
         }
     }
 
 protected:
 
     std::shared_ptr<DataSharingNotification> shared_notification_;
+    std::shared_ptr<DataSharingNotification> dispatcher_notification_;
     std::string directory_;
 };
 
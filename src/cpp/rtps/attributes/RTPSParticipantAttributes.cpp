@@ -105,6 +105,7 @@ static std::shared_ptr<fastdds::rtps::TCPv4TransportDescriptor> create_tcpv4_tra
     descriptor->default_reception_threads(att.builtin_transports_reception_threads);
     descriptor->accept_thread = att.builtin_transports_reception_threads;
     descriptor->keep_alive_thread = att.builtin_transports_reception_threads;
+    descriptor->reactor_thread = att.builtin_transports_reception_threads;
     return descriptor;
 }
 
@@ -124,6 +125,7 @@ static std::shared_ptr<fastdds::rtps::TCPv6TransportDescriptor> create_tcpv6_tra
     descriptor->default_reception_threads(att.builtin_transports_reception_threads);
     descriptor->accept_thread = att.builtin_transports_reception_threads;
     descriptor->keep_alive_thread = att.builtin_transports_reception_threads;
+    descriptor->reactor_thread = att.builtin_transports_reception_threads;
     return descriptor;
 }
 
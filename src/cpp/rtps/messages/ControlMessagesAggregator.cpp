@@ -0,0 +1,252 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ControlMessagesAggregator.cpp
+ */
+
+#include <rtps/messages/ControlMessagesAggregator.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#include <fastdds/rtps/common/Types.h>
+#include <fastdds/rtps/messages/CDRMessage.h>
+#include <fastdds/rtps/messages/RTPS_messages.h>
+#include <fastdds/rtps/messages/RTPSMessageCreator.h>
+
+#include <statistics/rtps/messages/RTPSStatisticsMessages.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+//! Size of an INFO_DST submessage
+static constexpr uint32_t info_dst_size = RTPSMESSAGE_SUBMESSAGEHEADER_SIZE + 12u;
+
+//! Bytes of a group kept for the statistics submessage added when it is sent
+#ifdef FASTDDS_STATISTICS
+static constexpr uint32_t reserved_size = fastdds::statistics::rtps::statistics_submessage_length;
+#else
+static constexpr uint32_t reserved_size = 0u;
+#endif // ifdef FASTDDS_STATISTICS
+
+ControlMessagesAggregator::ControlMessagesAggregator(
+        ResourceEvent& event_resource,
+        uint32_t max_message_size,
+        uint32_t period_us,
+        SendFunction send_function)
+    : max_message_size_(max_message_size)
+    , send_function_(std::move(send_function))
+    , flush_event_(event_resource, [this]() -> bool
+            {
+                flush();
+                return false;
+            }, static_cast<double>(period_us) / 1000.0)
+{
+}
+
+ControlMessagesAggregator::~ControlMessagesAggregator()
+{
+    flush_event_.cancel_timer();
+}
+
+void ControlMessagesAggregator::flush()
+{
+    std::vector<std::unique_ptr<Group>> groups;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        groups.swap(groups_);
+        flush_scheduled_ = false;
+    }
+
+    for (std::unique_ptr<Group>& group : groups)
+    {
+        send_group(std::move(group));
+    }
+}
+
+bool ControlMessagesAggregator::is_control_message(
+        const CDRMessage_t* message,
+        bool& starts_with_info_dst,
+        uint32_t& submessages_end)
+{
+    starts_with_info_dst = false;
+    submessages_end = 0;
+
+    bool has_control_submessage = false;
+    uint32_t pos = RTPSMESSAGE_HEADER_SIZE;
+    while (pos < message->length)
+    {
+        if (message->length - pos < RTPSMESSAGE_SUBMESSAGEHEADER_SIZE)
+        {
+            return false;
+        }
+
+        const octet* submessage = &message->buffer[pos];
+        uint16_t size = (submessage[1] & BIT(0)) ?
+                static_cast<uint16_t>(submessage[2] | (submessage[3] << 8)) :
+                static_cast<uint16_t>((submessage[2] << 8) | submessage[3]);
+        uint32_t next_pos = pos + RTPSMESSAGE_SUBMESSAGEHEADER_SIZE + size;
+
+        // A length of zero means the submessage extends to the end of the message
+        if (0 == size || next_pos > message->length)
+        {
+            return false;
+        }
+
+        switch (submessage[0])
+        {
+            case INFO_DST:
+                starts_with_info_dst |= (RTPSMESSAGE_HEADER_SIZE == pos);
+                break;
+
+            case HEARTBEAT:
+            case HEARTBEAT_FRAG:
+            case ACKNACK:
+            case NACK_FRAG:
+                has_control_submessage = true;
+                break;
+
+            case FASTDDS_STATISTICS_NETWORK_SUBMESSAGE:
+                if (next_pos != message->length)
+                {
+                    return false;
+                }
+                submessages_end = pos;
+                return has_control_submessage;
+
+            default:
+                return false;
+        }
+
+        pos = next_pos;
+    }
+
+    submessages_end = pos;
+    return has_control_submessage;
+}
+
+bool ControlMessagesAggregator::add_message(
+        const CDRMessage_t* message,
+        bool starts_with_info_dst,
+        uint32_t submessages_end,
+        const std::vector<Locator_t>& locators)
+{
+    std::unique_ptr<Group> full_group;
+
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        if (max_message_size_ <
+                RTPSMESSAGE_HEADER_SIZE + needed_size(RTPSMESSAGE_HEADER_SIZE, starts_with_info_dst, submessages_end) +
+                reserved_size)
+        {
+            return false;
+        }
+
+        auto it = std::find_if(groups_.begin(), groups_.end(),
+                        [&locators](const std::unique_ptr<Group>& group)
+                        {
+                            return group->locators == locators;
+                        });
+
+        if (it != groups_.end() &&
+                max_message_size_ <
+                (*it)->message.length + needed_size((*it)->message.length, starts_with_info_dst, submessages_end) +
+                reserved_size)
+        {
+            // The group is sent once the lock is released, and a new one is started
+            full_group = std::move(*it);
+            groups_.erase(it);
+            it = groups_.end();
+        }
+
+        if (it == groups_.end())
+        {
+            std::unique_ptr<Group> group = new_group();
+            group->locators = locators;
+            memcpy(group->message.buffer, message->buffer, RTPSMESSAGE_HEADER_SIZE);
+            group->message.pos = RTPSMESSAGE_HEADER_SIZE;
+            group->message.length = RTPSMESSAGE_HEADER_SIZE;
+            groups_.push_back(std::move(group));
+            it = groups_.end() - 1;
+        }
+
+        CDRMessage_t* group_message = &(*it)->message;
+        if (!starts_with_info_dst && RTPSMESSAGE_HEADER_SIZE < group_message->length)
+        {
+            // The submessages were addressed to every participant on their own message
+            RTPSMessageCreator::addSubmessageInfoDST(group_message, c_GuidPrefix_Unknown);
+        }
+        CDRMessage::addData(group_message, &message->buffer[RTPSMESSAGE_HEADER_SIZE],
+                submessages_end - RTPSMESSAGE_HEADER_SIZE);
+
+        if (!flush_scheduled_)
+        {
+            flush_scheduled_ = true;
+            flush_event_.restart_timer();
+        }
+    }
+
+    if (full_group)
+    {
+        send_group(std::move(full_group));
+    }
+
+    return true;
+}
+
+uint32_t ControlMessagesAggregator::needed_size(
+        uint32_t group_length,
+        bool starts_with_info_dst,
+        uint32_t submessages_end)
+{
+    uint32_t size = submessages_end - RTPSMESSAGE_HEADER_SIZE;
+    if (!starts_with_info_dst && RTPSMESSAGE_HEADER_SIZE < group_length)
+    {
+        size += info_dst_size;
+    }
+    return size;
+}
+
+std::unique_ptr<ControlMessagesAggregator::Group> ControlMessagesAggregator::new_group()
+{
+    if (free_groups_.empty())
+    {
+        return std::unique_ptr<Group>(new Group(max_message_size_));
+    }
+
+    std::unique_ptr<Group> group = std::move(free_groups_.back());
+    free_groups_.pop_back();
+    return group;
+}
+
+void ControlMessagesAggregator::send_group(
+        std::unique_ptr<Group>&& group)
+{
+    fastdds::statistics::rtps::add_statistics_submessage(&group->message);
+    send_function_(&group->message, group->locators);
+
+    group->locators.clear();
+    group->message.pos = 0;
+    group->message.length = 0;
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    free_groups_.push_back(std::move(group));
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
@@ -0,0 +1,177 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ControlMessagesAggregator.hpp
+ */
+
+#ifndef RTPS_MESSAGES_CONTROLMESSAGESAGGREGATOR_HPP
+#define RTPS_MESSAGES_CONTROLMESSAGESAGGREGATOR_HPP
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <fastdds/rtps/common/CDRMessage_t.h>
+#include <fastdds/rtps/common/Locator.h>
+#include <fastdds/rtps/resources/ResourceEvent.h>
+#include <fastdds/rtps/resources/TimedEvent.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Packs the control messages sent by the endpoints of a participant into fewer RTPS messages.
+ *
+ * Messages only holding HEARTBEAT, HEARTBEAT_FRAG, ACKNACK and NACK_FRAG submessages (and their INFO_DST) are not
+ * sent right away. They are kept, along with the rest of control messages addressed to the same destination
+ * locators, and the submessages of all of them are sent on a single RTPS message at the end of a short period.
+ * A group is sent earlier if the next message does not fit on it.
+ */
+class ControlMessagesAggregator
+{
+public:
+
+    //! Function sending a message to a list of destination locators
+    using SendFunction = std::function<void (
+                        CDRMessage_t* message,
+                        const std::vector<Locator_t>& locators)>;
+
+    /**
+     * Constructor.
+     * @param event_resource Event resource where the aggregated messages are sent from.
+     * @param max_message_size Maximum size of the aggregated messages.
+     * @param period_us Time a control message can be kept before being sent, in microseconds.
+     * @param send_function Function sending the aggregated messages.
+     */
+    ControlMessagesAggregator(
+            ResourceEvent& event_resource,
+            uint32_t max_message_size,
+            uint32_t period_us,
+            SendFunction send_function);
+
+    ~ControlMessagesAggregator();
+
+    /**
+     * Keeps a message to be sent along with the rest of control messages to the same destination locators.
+     * @param message Message to keep. It should start with the RTPS header.
+     * @param destination_locators_begin Iterator at the first destination locator.
+     * @param destination_locators_end Iterator at the end destination locator.
+     * @return true if the message was kept (and will be sent by the aggregator), false if it is not a control message
+     * and should be sent by the caller.
+     */
+    template<class LocatorIteratorT>
+    bool add(
+            const CDRMessage_t* message,
+            const LocatorIteratorT& destination_locators_begin,
+            const LocatorIteratorT& destination_locators_end)
+    {
+        bool starts_with_info_dst = false;
+        uint32_t submessages_end = 0;
+        if (!is_control_message(message, starts_with_info_dst, submessages_end))
+        {
+            return false;
+        }
+
+        std::vector<Locator_t> locators;
+        for (auto it = destination_locators_begin; it != destination_locators_end; ++it)
+        {
+            locators.push_back(*it);
+        }
+
+        return !locators.empty() && add_message(message, starts_with_info_dst, submessages_end, locators);
+    }
+
+    //! Sends all the kept messages.
+    void flush();
+
+    /**
+     * Checks whether a message only holds control submessages that can be aggregated.
+     * @param message Message to check. It should start with the RTPS header.
+     * @param [out] starts_with_info_dst Whether the first submessage is an INFO_DST.
+     * @param [out] submessages_end Position where the submessages to aggregate end. A trailing statistics
+     * submessage is not aggregated, as the transports fill it for every message sent.
+     * @return true if the message can be aggregated.
+     */
+    static bool is_control_message(
+            const CDRMessage_t* message,
+            bool& starts_with_info_dst,
+            uint32_t& submessages_end);
+
+private:
+
+    //! Submessages to send to the same destination locators
+    struct Group
+    {
+        explicit Group(
+                uint32_t max_message_size)
+            : message(max_message_size)
+        {
+        }
+
+        std::vector<Locator_t> locators;
+        CDRMessage_t message;
+    };
+
+    bool add_message(
+            const CDRMessage_t* message,
+            bool starts_with_info_dst,
+            uint32_t submessages_end,
+            const std::vector<Locator_t>& locators);
+
+    /**
+     * Number of bytes needed on a group to add the submessages of a message.
+     * @param group_length Current length of the group message.
+     * @param starts_with_info_dst Whether the submessages to add start with an INFO_DST.
+     * @param submessages_end Position where the submessages to add end on their message.
+     */
+    static uint32_t needed_size(
+            uint32_t group_length,
+            bool starts_with_info_dst,
+            uint32_t submessages_end);
+
+    //! Returns an empty group, reusing a previous one when possible. Should be called with the mutex locked.
+    std::unique_ptr<Group> new_group();
+
+    //! Sends a group and keeps it for reuse. Should be called with the mutex unlocked.
+    void send_group(
+            std::unique_ptr<Group>&& group);
+
+    uint32_t max_message_size_;
+
+    SendFunction send_function_;
+
+    std::mutex mutex_;
+
+    //! Groups being filled
+    std::vector<std::unique_ptr<Group>> groups_;
+
+    //! Groups already sent, kept for reuse
+    std::vector<std::unique_ptr<Group>> free_groups_;
+
+    //! Whether the flush of the groups being filled is scheduled
+    bool flush_scheduled_ = false;
+
+    //! Sends the groups at the end of the period. Declared last, so it is destroyed first.
+    TimedEvent flush_event_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // RTPS_MESSAGES_CONTROLMESSAGESAGGREGATOR_HPP
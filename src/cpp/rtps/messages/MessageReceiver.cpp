@@ -19,6 +19,7 @@
 
 #include <cassert>
 #include <limits>
+#include <memory>
 #include <thread>
 
 #include <fastdds/rtps/common/EntityId_t.hpp>
@@ -29,7 +30,6 @@
 #include <fastdds/dds/log/Log.hpp>
 #include <fastdds/rtps/reader/RTPSReader.h>
 #include <fastdds/rtps/writer/RTPSWriter.h>
-#include <fastrtps/utils/shared_mutex.hpp>
 
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include <statistics/rtps/StatisticsBase.hpp>
@@ -48,13 +48,16 @@ namespace rtps {
 MessageReceiver::MessageReceiver(
         RTPSParticipantImpl* participant,
         uint32_t rec_buffer_size)
-    : participant_(participant)
+    : endpoint_table_(new EndpointTable())
+    , endpoint_table_readers_(0)
+    , participant_(participant)
     , source_version_(c_ProtocolVersion)
     , source_vendor_id_(c_VendorId_Unknown)
     , source_guid_prefix_(c_GuidPrefix_Unknown)
     , dest_guid_prefix_(c_GuidPrefix_Unknown)
     , have_timestamp_(false)
     , timestamp_(c_TimeInvalid)
+    , reception_timestamp_(c_RTPSTimeZero)
 #if HAVE_SECURITY
     , crypto_msg_(participant->is_secure() ? rec_buffer_size : 0)
     , crypto_submsg_(participant->is_secure() ? rec_buffer_size : 0)
@@ -112,8 +115,9 @@ MessageReceiver::MessageReceiver(
 MessageReceiver::~MessageReceiver()
 {
     EPROSIMA_LOG_INFO(RTPS_MSG_IN, "");
-    assert(associated_writers_.empty());
-    assert(associated_readers_.empty());
+    assert(endpoints().writers.empty());
+    assert(endpoints().readers.empty());
+    delete endpoint_table_.load();
 }
 
  #if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
@@ -242,11 +246,12 @@ void MessageReceiver::process_data_fragment_message_without_security(
 void MessageReceiver::associateEndpoint(
         Endpoint* to_add)
 {
-    std::lock_guard<eprosima::shared_mutex> guard(mtx_);
+    std::lock_guard<std::mutex> guard(update_mtx_);
+    std::unique_ptr<EndpointTable> table(new EndpointTable(endpoints()));
     if (to_add->getAttributes().endpointKind == WRITER)
     {
         const auto writer = dynamic_cast<RTPSWriter*>(to_add);
-        for (const auto& it : associated_writers_)
+        for (const auto& it : table->writers)
         {
             if (it == writer)
             {
@@ -254,19 +259,19 @@ void MessageReceiver::associateEndpoint(
             }
         }
 
-        associated_writers_.push_back(writer);
+        table->writers.push_back(writer);
     }
     else
     {
         const auto reader = dynamic_cast<RTPSReader*>(to_add);
         const auto entityId = reader->getGuid().entityId;
         // search for set of readers by entity ID
-        const auto readers = associated_readers_.find(entityId);
-        if (readers == associated_readers_.end())
+        const auto readers = table->readers.find(entityId);
+        if (readers == table->readers.end())
         {
             auto vec = std::vector<RTPSReader*>();
             vec.push_back(reader);
-            associated_readers_.emplace(entityId, vec);
+            table->readers.emplace(entityId, vec);
         }
         else
         {
@@ -281,29 +286,32 @@ void MessageReceiver::associateEndpoint(
             readers->second.push_back(reader);
         }
     }
+
+    publish_endpoints(table.release());
 }
 
 void MessageReceiver::removeEndpoint(
         Endpoint* to_remove)
 {
-    std::lock_guard<eprosima::shared_mutex> guard(mtx_);
+    std::lock_guard<std::mutex> guard(update_mtx_);
+    std::unique_ptr<EndpointTable> table(new EndpointTable(endpoints()));
 
     if (to_remove->getAttributes().endpointKind == WRITER)
     {
         auto* var = dynamic_cast<RTPSWriter*>(to_remove);
-        for (auto it = associated_writers_.begin(); it != associated_writers_.end(); ++it)
+        for (auto it = table->writers.begin(); it != table->writers.end(); ++it)
         {
             if (*it == var)
             {
-                associated_writers_.erase(it);
+                table->writers.erase(it);
                 break;
             }
         }
     }
     else
     {
-        auto readers = associated_readers_.find(to_remove->getGuid().entityId);
-        if (readers != associated_readers_.end())
+        auto readers = table->readers.find(to_remove->getGuid().entityId);
+        if (readers != table->readers.end())
         {
             auto* var = dynamic_cast<RTPSReader*>(to_remove);
             for (auto it = readers->second.begin(); it != readers->second.end(); ++it)
@@ -313,13 +321,31 @@ void MessageReceiver::removeEndpoint(
                     readers->second.erase(it);
                     if (readers->second.empty())
                     {
-                        associated_readers_.erase(readers);
+                        table->readers.erase(readers);
                     }
                     break;
                 }
             }
         }
     }
+
+    // When this returns, no thread processing a submessage can reach the removed endpoint
+    publish_endpoints(table.release());
+}
+
+void MessageReceiver::publish_endpoints(
+        EndpointTable* table)
+{
+    EndpointTable* old_table = endpoint_table_.exchange(table);
+
+    // Threads entering after the exchange can only load the new table, so the old one is not used
+    // once the threads reading the table at the time of the exchange have left.
+    while (0 != endpoint_table_readers_.load())
+    {
+        std::this_thread::yield();
+    }
+
+    delete old_table;
 }
 
 void MessageReceiver::reset()
@@ -330,12 +356,14 @@ void MessageReceiver::reset()
     dest_guid_prefix_ = c_GuidPrefix_Unknown;
     have_timestamp_ = false;
     timestamp_ = c_TimeInvalid;
+    reception_timestamp_ = c_RTPSTimeZero;
 }
 
 void MessageReceiver::processCDRMsg(
         const Locator_t& source_locator,
         const Locator_t& reception_locator,
-        CDRMessage_t* msg)
+        CDRMessage_t* msg,
+        const Time_t& reception_timestamp)
 {
     if (msg->length < RTPSMESSAGE_HEADER_SIZE)
     {
@@ -358,11 +386,10 @@ void MessageReceiver::processCDRMsg(
     bool ignore_submessages = false;
 
     {
-        std::lock_guard<eprosima::shared_mutex> guard(mtx_);
-
         reset();
 
         dest_guid_prefix_ = participantGuidPrefix;
+        reception_timestamp_ = reception_timestamp;
 
         msg->pos = 0; //Start reading at 0
 
@@ -401,7 +428,7 @@ void MessageReceiver::processCDRMsg(
     }
 
     // Loop until there are no more submessages
-    // Each submessage processing method choses the lock kind required
+    // Each submessage processing method looking for endpoints marks itself as a reader of the endpoint table
     bool valid;
     SubmessageHeader_t submsgh; //Current submessage header
 
@@ -671,7 +698,8 @@ bool MessageReceiver::willAReaderAcceptMsgDirectedTo(
         RTPSReader*& first_reader) const
 {
     first_reader = nullptr;
-    if (associated_readers_.empty())
+    const auto& associated_readers = endpoints().readers;
+    if (associated_readers.empty())
     {
         EPROSIMA_LOG_WARNING(RTPS_MSG_IN, IDSTRING "Data received when NO readers are listening");
         return false;
@@ -679,8 +707,8 @@ bool MessageReceiver::willAReaderAcceptMsgDirectedTo(
 
     if (readerID != c_EntityId_Unknown)
     {
-        const auto readers = associated_readers_.find(readerID);
-        if (readers != associated_readers_.end())
+        const auto readers = associated_readers.find(readerID);
+        if (readers != associated_readers.end())
         {
             first_reader = readers->second.front();
             return true;
@@ -688,7 +716,7 @@ bool MessageReceiver::willAReaderAcceptMsgDirectedTo(
     }
     else
     {
-        for (const auto& readers : associated_readers_)
+        for (const auto& readers : associated_readers)
         {
             for (const auto& it : readers.second)
             {
@@ -710,10 +738,11 @@ void MessageReceiver::findAllReaders(
         const EntityId_t& readerID,
         const Functor& callback) const
 {
+    const auto& associated_readers = endpoints().readers;
     if (readerID != c_EntityId_Unknown)
     {
-        const auto readers = associated_readers_.find(readerID);
-        if (readers != associated_readers_.end())
+        const auto readers = associated_readers.find(readerID);
+        if (readers != associated_readers.end())
         {
             for (const auto& it : readers->second)
             {
@@ -723,7 +752,7 @@ void MessageReceiver::findAllReaders(
     }
     else
     {
-        for (const auto& readers : associated_readers_)
+        for (const auto& readers : associated_readers)
         {
             for (const auto& it : readers.second)
             {
@@ -742,7 +771,7 @@ bool MessageReceiver::proc_Submsg_Data(
         EntityId_t& writerID,
         bool was_decoded) const
 {
-    eprosima::shared_lock<eprosima::shared_mutex> guard(mtx_);
+    EndpointTableReader endpoints_reader(*this);
 
     //READ and PROCESS
     if (smh->submessageLength < RTPSMESSAGE_DATA_MIN_LENGTH)
@@ -893,9 +922,10 @@ bool MessageReceiver::proc_Submsg_Data(
     {
         ch.sourceTimestamp = timestamp_;
     }
+    ch.reader_info.receptionTimestamp = reception_timestamp_;
 
     EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "from Writer " << ch.writerGUID << "; possible RTPSReader entities: " <<
-            associated_readers_.size());
+            endpoints().readers.size());
 
     //Look for the correct reader to add the change
     process_data_message_function_(readerID, ch, was_decoded);
@@ -919,7 +949,7 @@ bool MessageReceiver::proc_Submsg_DataFrag(
         SubmessageHeader_t* smh,
         bool was_decoded) const
 {
-    eprosima::shared_lock<eprosima::shared_mutex> guard(mtx_);
+    EndpointTableReader endpoints_reader(*this);
 
     //READ and PROCESS
     if (smh->submessageLength < RTPSMESSAGE_DATA_MIN_LENGTH)
@@ -1080,9 +1110,10 @@ bool MessageReceiver::proc_Submsg_DataFrag(
     {
         ch.sourceTimestamp = timestamp_;
     }
+    ch.reader_info.receptionTimestamp = reception_timestamp_;
 
     EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "from Writer " << ch.writerGUID << "; possible RTPSReader entities: " <<
-            associated_readers_.size());
+            endpoints().readers.size());
     process_data_fragment_message_function_(readerID, ch, sampleSize, fragmentStartingNum, fragmentsInSubmessage,
             was_decoded);
     ch.serializedPayload.data = nullptr;
@@ -1098,7 +1129,7 @@ bool MessageReceiver::proc_Submsg_Heartbeat(
         SubmessageHeader_t* smh,
         bool was_decoded) const
 {
-    eprosima::shared_lock<eprosima::shared_mutex> guard(mtx_);
+    EndpointTableReader endpoints_reader(*this);
 
     bool endiannessFlag = (smh->flags & BIT(0)) != 0;
     bool finalFlag = (smh->flags & BIT(1)) != 0;
@@ -1168,7 +1199,7 @@ bool MessageReceiver::proc_Submsg_Acknack(
     // Only used when HAVE_SECURITY is defined
     static_cast<void>(was_decoded);
 
-    eprosima::shared_lock<eprosima::shared_mutex> guard(mtx_);
+    EndpointTableReader endpoints_reader(*this);
 
     bool endiannessFlag = (smh->flags & BIT(0)) != 0;
     bool finalFlag = (smh->flags & BIT(1)) != 0;
@@ -1197,7 +1228,8 @@ bool MessageReceiver::proc_Submsg_Acknack(
     }
 
     //Look for the correct writer to use the acknack
-    for (RTPSWriter* it : associated_writers_)
+    const auto& associated_writers = endpoints().writers;
+    for (RTPSWriter* it : associated_writers)
     {
 #if HAVE_SECURITY
         if (was_decoded || !it->getAttributes().security_attributes().is_submessage_protected)
@@ -1215,7 +1247,7 @@ bool MessageReceiver::proc_Submsg_Acknack(
         }
     }
     EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "Acknack msg to UNKNOWN writer (I looked through "
-            << associated_writers_.size() << " writers in this ListenResource)");
+            << associated_writers.size() << " writers in this ListenResource)");
     return false;
 }
 
@@ -1224,7 +1256,7 @@ bool MessageReceiver::proc_Submsg_Gap(
         SubmessageHeader_t* smh,
         bool was_decoded) const
 {
-    eprosima::shared_lock<eprosima::shared_mutex> guard(mtx_);
+    EndpointTableReader endpoints_reader(*this);
 
     bool endiannessFlag = (smh->flags & BIT(0)) != 0;
     //Assign message endianness
@@ -1271,8 +1303,6 @@ bool MessageReceiver::proc_Submsg_InfoTS(
         CDRMessage_t* msg,
         SubmessageHeader_t* smh)
 {
-    std::lock_guard<eprosima::shared_mutex> guard(mtx_);
-
     bool endiannessFlag = (smh->flags & BIT(0)) != 0;
     bool timeFlag = (smh->flags & BIT(1)) != 0;
     //Assign message endianness
@@ -1301,8 +1331,6 @@ bool MessageReceiver::proc_Submsg_InfoDST(
         CDRMessage_t* msg,
         SubmessageHeader_t* smh)
 {
-    std::lock_guard<eprosima::shared_mutex> guard(mtx_);
-
     bool endiannessFlag = (smh->flags & BIT(0)) != 0u;
     //bool timeFlag = smh->flags & BIT(1) ? true : false;
     //Assign message endianness
@@ -1328,8 +1356,6 @@ bool MessageReceiver::proc_Submsg_InfoSRC(
         CDRMessage_t* msg,
         SubmessageHeader_t* smh)
 {
-    std::lock_guard<eprosima::shared_mutex> guard(mtx_);
-
     bool endiannessFlag = (smh->flags & BIT(0)) != 0;
     //bool timeFlag = smh->flags & BIT(1) ? true : false;
     //Assign message endianness
@@ -1363,7 +1389,7 @@ bool MessageReceiver::proc_Submsg_NackFrag(
     // Only used when HAVE_SECURITY is defined
     static_cast<void>(was_decoded);
 
-    eprosima::shared_lock<eprosima::shared_mutex> guard(mtx_);
+    EndpointTableReader endpoints_reader(*this);
 
     bool endiannessFlag = (smh->flags & BIT(0)) != 0;
     //Assign message endianness
@@ -1397,7 +1423,8 @@ bool MessageReceiver::proc_Submsg_NackFrag(
     }
 
     //Look for the correct writer to use the acknack
-    for (RTPSWriter* it : associated_writers_)
+    const auto& associated_writers = endpoints().writers;
+    for (RTPSWriter* it : associated_writers)
     {
 #if HAVE_SECURITY
         if (was_decoded || !it->getAttributes().security_attributes().is_submessage_protected)
@@ -1415,7 +1442,7 @@ bool MessageReceiver::proc_Submsg_NackFrag(
         }
     }
     EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "Acknack msg to UNKNOWN writer (I looked through "
-            << associated_writers_.size() << " writers in this ListenResource)");
+            << associated_writers.size() << " writers in this ListenResource)");
     return false;
 }
 
@@ -1424,8 +1451,6 @@ bool MessageReceiver::proc_Submsg_HeartbeatFrag(
         SubmessageHeader_t* smh,
         bool /*was_decoded*/) const
 {
-    eprosima::shared_lock<eprosima::shared_mutex> guard(mtx_);
-
     bool endiannessFlag = (smh->flags & BIT(0)) != 0;
     //Assign message endianness
     if (endiannessFlag)
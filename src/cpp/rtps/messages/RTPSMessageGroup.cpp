@@ -58,6 +58,9 @@ public:
 
 };
 
+//! Minimum size of a payload for it to be sent from its own buffer instead of being copied into the message
+static constexpr uint32_t min_referenced_payload_size = 16 * 1024;
+
 static bool data_exceeds_limitation(
         uint32_t size_to_add,
         uint32_t limitation,
@@ -76,11 +79,13 @@ static bool data_exceeds_limitation(
 static bool append_message(
         RTPSParticipantImpl* participant,
         CDRMessage_t* full_msg,
-        CDRMessage_t* submsg)
+        CDRMessage_t* submsg,
+        uint32_t referenced_size)
 {
     static_cast<void>(participant);
 
-    uint32_t extra_size = 0;
+    // Keep room for the payload sent from its own buffer
+    uint32_t extra_size = referenced_size;
 
 #if HAVE_SECURITY
     // Avoid full message growing over estimated extra size for RTPS encryption
@@ -92,6 +97,11 @@ static bool append_message(
     extra_size += eprosima::fastdds::statistics::rtps::statistics_submessage_length;
 #endif  // FASTDDS_STATISTICS
 
+    if (full_msg->max_size < extra_size)
+    {
+        return false;
+    }
+
     full_msg->max_size -= extra_size;
     bool ret_val = CDRMessage::appendMsg(full_msg, submsg);
     full_msg->max_size += extra_size;
@@ -213,6 +223,16 @@ RTPSMessageGroup::RTPSMessageGroup(
 
     full_msg_ = &(send_buffer_->rtpsmsg_fullmsg_);
     submessage_msg_ = &(send_buffer_->rtpsmsg_submessage_);
+    segments_msg_ = &(send_buffer_->rtpsmsg_segments_);
+
+    // Consecutive DATA_FRAG messages are sent together when the transports support it.
+    // The segments buffer is only reserved once a DATA_FRAG message is added to it.
+    max_segmented_size_ = participant->get_max_segmented_message_size();
+    segments_msg_->pos = 0;
+    segments_msg_->length = 0;
+
+    // Header, payload and rest of the message
+    buffers_.reserve(3);
 
     // Init RTPS message.
     reset_to_header();
@@ -246,6 +266,7 @@ RTPSMessageGroup::~RTPSMessageGroup() noexcept(false)
     try
     {
         send();
+        flush_segments();
     }
     catch (...)
     {
@@ -267,6 +288,10 @@ void RTPSMessageGroup::reset_to_header()
     CDRMessage::initCDRMsg(full_msg_);
     full_msg_->pos = RTPSMESSAGE_HEADER_SIZE;
     full_msg_->length = RTPSMESSAGE_HEADER_SIZE;
+    full_msg_has_data_frag_ = false;
+    referenced_payload_ = nullptr;
+    referenced_payload_size_ = 0;
+    referenced_payload_pos_ = 0;
 }
 
 void RTPSMessageGroup::flush()
@@ -310,6 +335,20 @@ void RTPSMessageGroup::send()
 
             eprosima::fastdds::statistics::rtps::add_statistics_submessage(msgToSend);
 
+            if (nullptr != referenced_payload_)
+            {
+                send_gather();
+                return;
+            }
+
+            if (add_to_segments(msgToSend))
+            {
+                return;
+            }
+
+            // Keep the order of the messages
+            send_segments();
+
             if (!sender_->send(msgToSend,
                     max_blocking_time_point_))
             {
@@ -320,10 +359,115 @@ void RTPSMessageGroup::send()
     }
 }
 
+void RTPSMessageGroup::send_gather()
+{
+    // Keep the order of the messages
+    send_segments();
+
+    buffers_.clear();
+    buffers_.emplace_back(full_msg_->buffer, referenced_payload_pos_);
+    buffers_.emplace_back(referenced_payload_, referenced_payload_size_);
+    if (referenced_payload_pos_ < full_msg_->length)
+    {
+        buffers_.emplace_back(full_msg_->buffer + referenced_payload_pos_, full_msg_->length - referenced_payload_pos_);
+    }
+    uint32_t total_bytes = full_msg_->length + referenced_payload_size_;
+
+    if (!sender_->send_gather(buffers_, total_bytes, 0, max_blocking_time_point_))
+    {
+        // The payload cannot be referenced after the call, so the message is not kept for a later retry
+        reset_to_header();
+        throw timeout();
+    }
+    current_sent_bytes_ += total_bytes;
+}
+
+bool RTPSMessageGroup::add_to_segments(
+        CDRMessage_t* msg)
+{
+    if (0 == max_segmented_size_ || !full_msg_has_data_frag_ || msg != full_msg_)
+    {
+        return false;
+    }
+
+    if (0 < segments_msg_->length)
+    {
+        uint32_t num_segments = segments_msg_->length / segment_size_;
+        bool fits = (num_segments < max_segments_) && (msg->length <= segment_size_) &&
+                (max_segmented_size_ - segments_msg_->length >= msg->length);
+        if (!fits)
+        {
+            send_segments();
+        }
+    }
+
+    if (0 == segments_msg_->length)
+    {
+        // Only worth it when at least two messages fit on the segments buffer
+        if (msg->length > max_segmented_size_ / 2)
+        {
+            return false;
+        }
+        segment_size_ = msg->length;
+        segments_msg_->reserve(max_segmented_size_);
+    }
+
+    CDRMessage::appendMsg(segments_msg_, msg);
+    current_sent_bytes_ += msg->length;
+
+    // A shorter message can only be the last segment
+    if (msg->length < segment_size_ ||
+            max_segmented_size_ - segments_msg_->length < segment_size_ ||
+            segments_msg_->length / segment_size_ >= max_segments_)
+    {
+        send_segments();
+    }
+
+    return true;
+}
+
+void RTPSMessageGroup::send_segments()
+{
+    if (0 == segments_msg_->length)
+    {
+        return;
+    }
+
+    bool sent = false;
+    if (segments_msg_->length <= segment_size_)
+    {
+        sent = sender_->send(segments_msg_, max_blocking_time_point_);
+    }
+    else
+    {
+        buffers_.clear();
+        buffers_.emplace_back(segments_msg_->buffer, segments_msg_->length);
+        sent = sender_->send_gather(buffers_, segments_msg_->length, segment_size_, max_blocking_time_point_);
+    }
+
+    segments_msg_->pos = 0;
+    segments_msg_->length = 0;
+
+    if (!sent)
+    {
+        throw timeout();
+    }
+}
+
+void RTPSMessageGroup::flush_segments()
+{
+    if (endpoint_ && sender_ && 0 < segments_msg_->length)
+    {
+        std::lock_guard<RTPSMessageSenderInterface> lock(*sender_);
+        send_segments();
+    }
+}
+
 void RTPSMessageGroup::flush_and_reset()
 {
     // Flush
     flush();
+    flush_segments();
 
     current_dst_ = c_GuidPrefix_Unknown;
 }
@@ -343,25 +487,58 @@ void RTPSMessageGroup::check_and_maybe_flush(
     add_info_dst_in_buffer(submessage_msg_, destination_guid_prefix);
 }
 
+bool RTPSMessageGroup::can_reference_payload(
+        uint32_t payload_size,
+        bool is_fragment) const
+{
+#if HAVE_SECURITY
+    // Protected messages and payloads are encoded from a single buffer
+    if (participant_->is_secure())
+    {
+        return false;
+    }
+#endif // if HAVE_SECURITY
+
+    // Messages kept for a segmented send are copied one after another on a single buffer
+    if (is_fragment && 0 < max_segmented_size_)
+    {
+        return false;
+    }
+
+    return min_referenced_payload_size <= payload_size;
+}
+
 bool RTPSMessageGroup::insert_submessage(
         const GuidPrefix_t& destination_guid_prefix,
-        bool is_big_submessage)
+        bool is_big_submessage,
+        const octet* referenced_payload,
+        uint32_t referenced_payload_size,
+        uint32_t referenced_payload_pos)
 {
-    if (!append_message(participant_, full_msg_, submessage_msg_))
+    if (!append_message(participant_, full_msg_, submessage_msg_, referenced_payload_size))
     {
-        // Retry
-        flush_and_reset();
+        // Retry. Messages kept for a segmented send are not flushed, as they can be sent along this one.
+        flush();
+        current_dst_ = c_GuidPrefix_Unknown;
         add_info_dst_in_buffer(full_msg_, destination_guid_prefix);
 
-        if (!append_message(participant_, full_msg_, submessage_msg_))
+        if (!append_message(participant_, full_msg_, submessage_msg_, referenced_payload_size))
         {
             EPROSIMA_LOG_ERROR(RTPS_WRITER, "Cannot add RTPS submesage to the CDRMessage. Buffer too small");
             return false;
         }
     }
 
-    // Messages with a submessage bigger than 64KB cannot have more submessages and should be flushed
-    if (is_big_submessage)
+    if (nullptr != referenced_payload)
+    {
+        referenced_payload_ = referenced_payload;
+        referenced_payload_size_ = referenced_payload_size;
+        referenced_payload_pos_ = full_msg_->length - submessage_msg_->length + referenced_payload_pos;
+    }
+
+    // Messages with a submessage bigger than 64KB cannot have more submessages and should be flushed.
+    // Messages referencing a payload are flushed too, as the payload may not outlive the call.
+    if (is_big_submessage || nullptr != referenced_payload)
     {
         flush();
     }
@@ -496,15 +673,27 @@ bool RTPSMessageGroup::add_data(
     }
 #endif // if HAVE_SECURITY
 
+    // Big payloads are sent from their own buffer instead of being copied into the message
+    const octet* referenced_payload = nullptr;
+    uint32_t referenced_payload_size = 0;
+    uint32_t referenced_payload_pos = 0;
+    bool reference_payload = can_reference_payload(change_to_add.serializedPayload.length, false);
+
     // TODO (Ricardo). Check to create special wrapper.
     bool is_big_submessage;
     if (!RTPSMessageCreator::addSubmessageData(submessage_msg_, &change_to_add, endpoint_->getAttributes().topicKind,
-            readerId, expectsInlineQos, inline_qos, &is_big_submessage))
+            readerId, expectsInlineQos, inline_qos, &is_big_submessage,
+            reference_payload ? &referenced_payload_pos : nullptr))
     {
         EPROSIMA_LOG_ERROR(RTPS_WRITER, "Cannot add DATA submsg to the CDRMessage. Buffer too small");
         change_to_add.serializedPayload.data = nullptr;
         return false;
     }
+    if (reference_payload && 0 < referenced_payload_pos)
+    {
+        referenced_payload = change_to_add.serializedPayload.data;
+        referenced_payload_size = change_to_add.serializedPayload.length;
+    }
     change_to_add.serializedPayload.data = nullptr;
 
 #if HAVE_SECURITY
@@ -533,7 +722,7 @@ bool RTPSMessageGroup::add_data(
     }
 #endif // if HAVE_SECURITY
 
-    return insert_submessage(is_big_submessage);
+    return insert_submessage(is_big_submessage, referenced_payload, referenced_payload_size, referenced_payload_pos);
 }
 
 bool RTPSMessageGroup::add_data_frag(
@@ -600,14 +789,25 @@ bool RTPSMessageGroup::add_data_frag(
     }
 #endif // if HAVE_SECURITY
 
+    // Big fragments are sent from their own buffer instead of being copied into the message
+    const octet* referenced_payload = nullptr;
+    uint32_t referenced_payload_size = 0;
+    uint32_t referenced_payload_pos = 0;
+    bool reference_payload = can_reference_payload(change_to_add.serializedPayload.length, true);
+
     if (!RTPSMessageCreator::addSubmessageDataFrag(submessage_msg_, &change, fragment_number,
             change_to_add.serializedPayload, endpoint_->getAttributes().topicKind, readerId,
-            expectsInlineQos, inline_qos))
+            expectsInlineQos, inline_qos, reference_payload ? &referenced_payload_pos : nullptr))
     {
         EPROSIMA_LOG_ERROR(RTPS_WRITER, "Cannot add DATA_FRAG submsg to the CDRMessage. Buffer too small");
         change_to_add.serializedPayload.data = nullptr;
         return false;
     }
+    if (reference_payload && 0 < referenced_payload_pos)
+    {
+        referenced_payload = change_to_add.serializedPayload.data;
+        referenced_payload_size = change_to_add.serializedPayload.length;
+    }
     change_to_add.serializedPayload.data = nullptr;
 
 #if HAVE_SECURITY
@@ -636,7 +836,13 @@ bool RTPSMessageGroup::add_data_frag(
     }
 #endif // if HAVE_SECURITY
 
-    return insert_submessage(false);
+    if (!insert_submessage(false, referenced_payload, referenced_payload_size, referenced_payload_pos))
+    {
+        return false;
+    }
+
+    full_msg_has_data_frag_ = true;
+    return true;
 }
 
 bool RTPSMessageGroup::add_heartbeat(
@@ -48,6 +48,7 @@ public:
 #if HAVE_SECURITY
         , rtpsmsg_encrypt_(0u)
 #endif
+        , rtpsmsg_segments_(0u)
     {
         rtpsmsg_fullmsg_.reserve(payload);
         rtpsmsg_submessage_.reserve(payload);
@@ -74,6 +75,7 @@ public:
 #if HAVE_SECURITY
         , rtpsmsg_encrypt_(0u)
 #endif
+        , rtpsmsg_segments_(0u)
     {
         rtpsmsg_fullmsg_.init(buffer_ptr, payload);
         buffer_ptr += payload;
@@ -104,6 +106,9 @@ public:
 #if HAVE_SECURITY
     CDRMessage_t rtpsmsg_encrypt_;
 #endif
+
+    //! Consecutive RTPS messages pending to be sent with a single segmented send. Only reserved when used.
+    CDRMessage_t rtpsmsg_segments_;
 };
 
 } // namespace rtps
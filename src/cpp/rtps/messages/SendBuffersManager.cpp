@@ -24,12 +24,23 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+//! Source of the indexes identifying the threads on the per-thread caches
+static std::atomic<size_t> next_thread_index(0);
+
 SendBuffersManager::SendBuffersManager(
         size_t reserved_size,
         bool allow_growing)
     : allow_growing_(allow_growing)
 {
     pool_.reserve(reserved_size);
+
+    for (ThreadCache& cache : thread_caches_)
+    {
+        for (std::atomic<RTPSMessageGroup_t*>& buffer : cache.buffers)
+        {
+            buffer.store(nullptr);
+        }
+    }
 }
 
 void SendBuffersManager::init(
@@ -78,6 +89,12 @@ std::unique_ptr<RTPSMessageGroup_t> SendBuffersManager::get_buffer(
         const RTPSParticipantImpl* participant,
         const std::chrono::steady_clock::time_point& max_blocking_time)
 {
+    RTPSMessageGroup_t* cached_buffer = get_cached_buffer();
+    if (nullptr != cached_buffer)
+    {
+        return std::unique_ptr<RTPSMessageGroup_t>(cached_buffer);
+    }
+
 #if HAVE_STRICT_REALTIME
     std::unique_lock<TimedMutex> lock(mutex_, std::defer_lock);
     if (!lock.try_lock_until(max_blocking_time))
@@ -90,6 +107,12 @@ std::unique_ptr<RTPSMessageGroup_t> SendBuffersManager::get_buffer(
 
     std::unique_ptr<RTPSMessageGroup_t> ret_val;
 
+    // Buffers idle on the caches of other threads are taken back before creating a new one
+    if (pool_.empty())
+    {
+        take_cached_buffers();
+    }
+
     while (pool_.empty())
     {
         if (allow_growing_ || n_created_ < pool_.capacity())
@@ -98,11 +121,19 @@ std::unique_ptr<RTPSMessageGroup_t> SendBuffersManager::get_buffer(
         }
         else
         {
-            EPROSIMA_LOG_INFO(RTPS_PARTICIPANT, "Waiting for send buffer");
-            if (std::cv_status::timeout == available_cv_.wait_until(lock, max_blocking_time))
+            // Threads returning a buffer to their cache while this one waits will wake it up.
+            n_waiting_.fetch_add(1);
+            take_cached_buffers();
+            if (pool_.empty())
             {
-                throw RTPSMessageGroup::timeout();
+                EPROSIMA_LOG_INFO(RTPS_PARTICIPANT, "Waiting for send buffer");
+                if (std::cv_status::timeout == available_cv_.wait_until(lock, max_blocking_time))
+                {
+                    n_waiting_.fetch_sub(1);
+                    throw RTPSMessageGroup::timeout();
+                }
             }
+            n_waiting_.fetch_sub(1);
         }
     }
 
@@ -115,6 +146,19 @@ std::unique_ptr<RTPSMessageGroup_t> SendBuffersManager::get_buffer(
 void SendBuffersManager::return_buffer(
         std::unique_ptr <RTPSMessageGroup_t>&& buffer)
 {
+    if (cache_buffer(buffer.get()))
+    {
+        buffer.release();
+
+        if (0 < n_waiting_.load())
+        {
+            // Waiting threads take the buffer from the cache when woken up
+            std::lock_guard<TimedMutex> guard(mutex_);
+            available_cv_.notify_all();
+        }
+        return;
+    }
+
     std::lock_guard<TimedMutex> guard(mutex_);
     pool_.push_back(std::move(buffer));
     available_cv_.notify_one();
@@ -132,6 +176,61 @@ void SendBuffersManager::add_one_buffer(
     ++n_created_;
 }
 
+SendBuffersManager::ThreadCache& SendBuffersManager::thread_cache()
+{
+    static thread_local size_t thread_index = next_thread_index.fetch_add(1);
+    return thread_caches_[thread_index % num_thread_caches_];
+}
+
+RTPSMessageGroup_t* SendBuffersManager::get_cached_buffer()
+{
+    ThreadCache& cache = thread_cache();
+    for (std::atomic<RTPSMessageGroup_t*>& slot : cache.buffers)
+    {
+        if (nullptr != slot.load(std::memory_order_relaxed))
+        {
+            RTPSMessageGroup_t* buffer = slot.exchange(nullptr);
+            if (nullptr != buffer)
+            {
+                return buffer;
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+bool SendBuffersManager::cache_buffer(
+        RTPSMessageGroup_t* buffer)
+{
+    ThreadCache& cache = thread_cache();
+    for (std::atomic<RTPSMessageGroup_t*>& slot : cache.buffers)
+    {
+        RTPSMessageGroup_t* expected = nullptr;
+        if (slot.compare_exchange_strong(expected, buffer))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void SendBuffersManager::take_cached_buffers()
+{
+    for (ThreadCache& cache : thread_caches_)
+    {
+        for (std::atomic<RTPSMessageGroup_t*>& slot : cache.buffers)
+        {
+            RTPSMessageGroup_t* buffer = slot.exchange(nullptr);
+            if (nullptr != buffer)
+            {
+                pool_.emplace_back(buffer);
+            }
+        }
+    }
+}
+
 } /* namespace rtps */
 } /* namespace fastrtps */
 } /* namespace eprosima */
@@ -25,6 +25,8 @@
 #include <fastrtps/utils/TimedMutex.hpp>
 #include <fastrtps/utils/TimedConditionVariable.hpp>
 
+#include <array>               // std::array
+#include <atomic>              // std::atomic
 #include <vector>              // std::vector
 #include <memory>              // std::unique_ptr
 
@@ -37,6 +39,12 @@ class RTPSParticipantImpl;
 
 /**
  * Manages a pool of send buffers.
+ *
+ * A small cache of buffers is kept for each thread in front of the shared pool, so a thread getting a buffer
+ * it has just returned does not need to lock the pool. Threads are spread over a fixed number of caches, and
+ * the caches are lock-free, so threads sharing a cache are still correct.
+ * Buffers idle on the caches are taken back to the shared pool when it runs out of buffers, before growing it or
+ * waiting for a buffer to be returned.
  * @ingroup WRITER_MODULE
  */
 class SendBuffersManager
@@ -54,6 +62,7 @@ public:
 
     ~SendBuffersManager()
     {
+        take_cached_buffers();
         assert(pool_.size() == n_created_);
     }
 
@@ -84,9 +93,40 @@ public:
 
 private:
 
+    //! Number of caches the threads are spread over
+    static constexpr size_t num_thread_caches_ = 32;
+    //! Number of buffers each cache can keep
+    static constexpr size_t thread_cache_size_ = 2;
+
+    //! Buffers cached for the threads using it. Aligned so caches do not share a cache line.
+    struct alignas(64) ThreadCache
+    {
+        std::atomic<RTPSMessageGroup_t*> buffers[thread_cache_size_];
+    };
+
     void add_one_buffer(
             const RTPSParticipantImpl* participant);
 
+    //! Returns the cache of the calling thread
+    ThreadCache& thread_cache();
+
+    /**
+     * Takes a buffer from the cache of the calling thread.
+     * @return The buffer, or nullptr if the cache is empty.
+     */
+    RTPSMessageGroup_t* get_cached_buffer();
+
+    /**
+     * Keeps a buffer on the cache of the calling thread.
+     * @param buffer Buffer to keep.
+     * @return false if the cache is full.
+     */
+    bool cache_buffer(
+            RTPSMessageGroup_t* buffer);
+
+    //! Moves the buffers of all the caches to the shared pool. Should be called with the mutex locked.
+    void take_cached_buffers();
+
     //!Protects all data
     TimedMutex mutex_;
     //!Send buffers pool
@@ -99,6 +139,10 @@ private:
     bool allow_growing_ = true;
     //!To wait for a buffer to be returned to the pool.
     TimedConditionVariable available_cv_;
+    //!Number of threads waiting for a buffer to be returned to the pool.
+    std::atomic<uint32_t> n_waiting_{0};
+    //!Per-thread caches of buffers.
+    std::array<ThreadCache, num_thread_caches_> thread_caches_;
 };
 
 } /* namespace rtps */
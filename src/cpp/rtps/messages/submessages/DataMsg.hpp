@@ -181,7 +181,8 @@ bool RTPSMessageCreator::addSubmessageData(
         const EntityId_t& readerId,
         bool expectsInlineQos,
         InlineQosWriter* inlineQos,
-        bool* is_big_submessage)
+        bool* is_big_submessage,
+        uint32_t* payload_position)
 {
     octet status = 0;
     octet flags = 0;
@@ -230,9 +231,20 @@ bool RTPSMessageCreator::addSubmessageData(
     }
 
     //Add Serialized Payload
+    uint32_t referenced_size = 0;
     if (dataFlag)
     {
-        added_no_error &= CDRMessage::addData(msg, change->serializedPayload.data, change->serializedPayload.length);
+        if (nullptr != payload_position)
+        {
+            // The payload will be sent from its own buffer, so only its position is kept
+            *payload_position = msg->pos;
+            referenced_size = change->serializedPayload.length;
+        }
+        else
+        {
+            added_no_error &= CDRMessage::addData(msg, change->serializedPayload.data,
+                            change->serializedPayload.length);
+        }
     }
 
     if (keyFlag)
@@ -256,7 +268,7 @@ bool RTPSMessageCreator::addSubmessageData(
     }
 
     // Align submessage to rtps alignment (4).
-    uint32_t align = (4 - msg->pos % 4) & 3;
+    uint32_t align = (4 - (msg->pos + referenced_size) % 4) & 3;
     for (uint32_t count = 0; count < align; ++count)
     {
         added_no_error &= CDRMessage::addOctet(msg, 0);
@@ -268,7 +280,7 @@ bool RTPSMessageCreator::addSubmessageData(
         //submsgElem.length += align;
     }
 
-    uint32_t size32 = msg->pos - position_size_count_size;
+    uint32_t size32 = msg->pos + referenced_size - position_size_count_size;
     if (size32 <= std::numeric_limits<uint16_t>::max())
     {
         submessage_size = static_cast<uint16_t>(size32);
@@ -339,7 +351,8 @@ bool RTPSMessageCreator::addSubmessageDataFrag(
         TopicKind_t topicKind,
         const EntityId_t& readerId,
         bool expectsInlineQos,
-        InlineQosWriter* inlineQos)
+        InlineQosWriter* inlineQos,
+        uint32_t* payload_position)
 {
     octet status = 0;
     octet flags = 0;
@@ -383,9 +396,19 @@ bool RTPSMessageCreator::addSubmessageDataFrag(
     }
 
     //Add Serialized Payload XXX TODO
+    uint32_t referenced_size = 0;
     if (!keyFlag) // keyflag = 0 means that the serializedPayload SubmessageElement contains the serialized Data
     {
-        added_no_error &= CDRMessage::addData(msg, payload.data, payload.length);
+        if (nullptr != payload_position)
+        {
+            // The fragment will be sent from its own buffer, so only its position is kept
+            *payload_position = msg->pos;
+            referenced_size = payload.length;
+        }
+        else
+        {
+            added_no_error &= CDRMessage::addData(msg, payload.data, payload.length);
+        }
     }
     else
     {
@@ -408,7 +431,7 @@ bool RTPSMessageCreator::addSubmessageDataFrag(
 
     // TODO(Ricardo) This should be on cachechange.
     // Align submessage to rtps alignment (4).
-    submessage_size = uint16_t(msg->pos - position_size_count_size);
+    submessage_size = uint16_t(msg->pos + referenced_size - position_size_count_size);
     for (; submessage_size& 3; ++submessage_size)
     {
         added_no_error &= CDRMessage::addOctet(msg, 0);
@@ -14,7 +14,9 @@
 
 #include <rtps/network/NetworkFactory.h>
 
+#include <algorithm>
 #include <limits>
+#include <string>
 #include <utility>
 
 #include <fastdds/rtps/common/Guid.h>
@@ -65,6 +67,21 @@ NetworkFactory::NetworkFactory(
                     " for 'fastdds.shm.enforce_metatraffic'. Using default value: 'none'");
         }
     }
+
+    const std::string* pipeline_depth = nullptr;
+    pipeline_depth = PropertyPolicyHelper::find_property(PParam.properties, "fastdds.receive_pipeline_depth");
+    if (pipeline_depth)
+    {
+        try
+        {
+            receive_pipeline_depth_ = static_cast<uint32_t>(std::stoul(*pipeline_depth));
+        }
+        catch (const std::exception&)
+        {
+            EPROSIMA_LOG_WARNING(RTPS_NETWORK, "Unrecognized value '" << *pipeline_depth << "'" <<
+                    " for 'fastdds.receive_pipeline_depth'. Using default value: '0'");
+        }
+    }
 }
 
 bool NetworkFactory::build_send_resources(
@@ -97,11 +114,18 @@ bool NetworkFactory::BuildReceiverResources(
                     transport->max_recv_buffer_size(),
                     receiver_max_message_size);
 
-                std::shared_ptr<ReceiverResource> newReceiverResource = std::shared_ptr<ReceiverResource>(
-                    new ReceiverResource(*transport, local, max_recv_buffer_size));
-
-                if (newReceiverResource->mValid)
+                // Transports may process an input channel on several threads, each one with its own receiver
+                uint32_t shards = (std::max)(transport->input_channel_shards(local), 1u);
+                for (uint32_t shard = 0; shard < shards; ++shard)
                 {
+                    std::shared_ptr<ReceiverResource> newReceiverResource = std::shared_ptr<ReceiverResource>(
+                        new ReceiverResource(*transport, local, max_recv_buffer_size, receive_pipeline_depth_));
+
+                    if (!newReceiverResource->mValid)
+                    {
+                        break;
+                    }
+
                     returned_resources_list.push_back(newReceiverResource);
                     returnedValue = true;
                 }
@@ -149,6 +173,20 @@ bool NetworkFactory::RegisterTransport(
                 minSendBufferSize_ = minSendBufferSize;
             }
 
+#if defined(FASTDDS_UDP_SEGMENTATION_OFFLOAD)
+            auto udp_descriptor = dynamic_cast<const fastdds::rtps::UDPTransportDescriptor*>(descriptor);
+            if (nullptr != udp_descriptor && udp_descriptor->segmentation_offload)
+            {
+                max_segmented_message_size_ = fastdds::rtps::s_maximumMessageSize;
+            }
+#endif // if defined(FASTDDS_UDP_SEGMENTATION_OFFLOAD)
+
+            // SHM enqueues all the messages of a segmented send on each port at once
+            if (LOCATOR_KIND_SHM == kind)
+            {
+                max_segmented_message_size_ = fastdds::rtps::s_maximumMessageSize;
+            }
+
             if (is_localhost_allowed)
             {
                 network_configuration_ |= kind;
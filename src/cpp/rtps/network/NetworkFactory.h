@@ -162,6 +162,17 @@ public:
         return minSendBufferSize_;
     }
 
+    /**
+     * Maximum size of a buffer holding several consecutive RTPS messages that can be sent with a single
+     * operation by the registered transports.
+     *
+     * @return 0 when no registered transport supports segmented sends.
+     */
+    uint32_t get_max_segmented_message_size() const
+    {
+        return max_segmented_message_size_;
+    }
+
     NetworkConfigSet_t network_configuration() const
     {
         return network_configuration_;
@@ -254,12 +265,17 @@ private:
 
     uint32_t minSendBufferSize_;
 
+    uint32_t max_segmented_message_size_ = 0;
+
     // Whether unicast metatraffic on SHM transport should always be used
     bool enforce_shm_unicast_metatraffic_ = false;
 
     // Whether multicast metatraffic on SHM transport should always be used
     bool enforce_shm_multicast_metatraffic_ = false;
 
+    // Number of buffers of the receive pipeline stage of each receiver resource. 0 disables the pipeline
+    uint32_t receive_pipeline_depth_ = 0;
+
     // Mask using transport kinds to indicate whether the transports allows localhost
     NetworkConfigSet_t network_configuration_;
 
@@ -15,10 +15,15 @@
 #include <rtps/network/ReceiverResource.h>
 
 #include <cassert>
+#include <cstring>
 #include <thread>
 
 #include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/rtps/messages/MessageReceiver.h>
+#include <fastrtps/utils/IPLocator.h>
+
+#include <utils/threading.hpp>
 
 #define IDSTRING "(ID:" << std::this_thread::get_id() << ") " <<
 
@@ -32,7 +37,8 @@ namespace rtps {
 ReceiverResource::ReceiverResource(
         TransportInterface& transport,
         const Locator_t& locator,
-        uint32_t max_recv_buffer_size)
+        uint32_t max_recv_buffer_size,
+        uint32_t pipeline_depth)
     : Cleanup(nullptr)
     , LocatorMapsToManagedChannel(nullptr)
     , mValid(false)
@@ -42,17 +48,35 @@ ReceiverResource::ReceiverResource(
     , max_message_size_(max_recv_buffer_size)
     , active_callbacks_(0)
 {
+    // The pipeline should be ready before the channel starts receiving
+    if (0 < pipeline_depth)
+    {
+        pipeline_ready_.reset(new PipelineQueue(pipeline_depth));
+        pipeline_free_.reset(new PipelineQueue(pipeline_depth));
+        pipeline_pool_.reserve(pipeline_depth);
+        for (uint32_t i = 0; i < pipeline_depth; ++i)
+        {
+            pipeline_pool_.emplace_back(new PipelineEntry(max_message_size_));
+            pipeline_free_->push(pipeline_pool_.back().get());
+        }
+
+        pipeline_port_ = IPLocator::getPhysicalPort(locator);
+        start_pipeline();
+    }
+
     // Internal channel is opened and assigned to this resource.
     mValid = transport.OpenInputChannel(locator, this, max_message_size_);
     if (!mValid)
     {
+        stop_pipeline();
         return; // Invalid resource to be discarded by the factory.
     }
 
-    // Implementation functions are bound to the right transport parameters
-    Cleanup = [&transport, locator]()
+    // Implementation functions are bound to the right transport parameters.
+    // Only the shard of the input channel feeding this receiver is closed.
+    Cleanup = [&transport, locator, this]()
             {
-                transport.CloseInputChannel(locator);
+                transport.close_input_channel_shard(locator, this);
             };
     LocatorMapsToManagedChannel = [&transport, locator](const Locator_t& locatorToCheck) -> bool
             {
@@ -74,6 +98,21 @@ ReceiverResource::ReceiverResource(
     max_message_size_ = rValueResource.max_message_size_;
     active_callbacks_ = rValueResource.active_callbacks_;
     rValueResource.active_callbacks_ = 0;
+
+    // The pipeline thread works on the object it was started for, so it is restarted on the new one
+    if (rValueResource.pipeline_ready_)
+    {
+        rValueResource.stop_pipeline();
+
+        std::lock_guard<std::mutex> guard(rValueResource.pipeline_producer_mtx_);
+        pipeline_pool_.swap(rValueResource.pipeline_pool_);
+        pipeline_ready_.swap(rValueResource.pipeline_ready_);
+        pipeline_free_.swap(rValueResource.pipeline_free_);
+        pipeline_max_depth_.store(rValueResource.pipeline_max_depth_.load());
+        pipeline_dropped_.store(rValueResource.pipeline_dropped_.load());
+        pipeline_port_ = rValueResource.pipeline_port_;
+        start_pipeline();
+    }
 }
 
 bool ReceiverResource::SupportsLocator(
@@ -114,8 +153,33 @@ void ReceiverResource::OnDataReceived(
         const Locator_t& localLocator,
         const Locator_t& remoteLocator)
 {
-    (void)localLocator;
+    OnTimestampedDataReceived(data, size, localLocator, remoteLocator, c_RTPSTimeZero);
+}
 
+void ReceiverResource::OnTimestampedDataReceived(
+        const octet* data,
+        const uint32_t size,
+        const Locator_t& localLocator,
+        const Locator_t& remoteLocator,
+        const Time_t& receptionTimestamp)
+{
+    if (pipeline_ready_)
+    {
+        enqueue(data, size, localLocator, remoteLocator, receptionTimestamp);
+    }
+    else
+    {
+        process(data, size, localLocator, remoteLocator, receptionTimestamp);
+    }
+}
+
+void ReceiverResource::process(
+        const octet* data,
+        const uint32_t size,
+        const Locator_t& localLocator,
+        const Locator_t& remoteLocator,
+        const Time_t& receptionTimestamp)
+{
     std::lock_guard<std::mutex> _(mtx);
 
     MessageReceiver* rcv = receiver;
@@ -132,7 +196,7 @@ void ReceiverResource::OnDataReceived(
         msg.reserved_size = size;
 
         // TODO: Should we unlock in case UnregisterReceiver is called from callback ?
-        rcv->processCDRMsg(remoteLocator, localLocator, &msg);
+        rcv->processCDRMsg(remoteLocator, localLocator, &msg, receptionTimestamp);
 
         // allow disabling
         if (--active_callbacks_ == 0)
@@ -142,6 +206,115 @@ void ReceiverResource::OnDataReceived(
     }
 }
 
+void ReceiverResource::enqueue(
+        const octet* data,
+        const uint32_t size,
+        const Locator_t& localLocator,
+        const Locator_t& remoteLocator,
+        const Time_t& receptionTimestamp)
+{
+    {
+        std::lock_guard<std::mutex> guard(pipeline_producer_mtx_);
+
+        PipelineEntry* entry = nullptr;
+        if (size > max_message_size_ || !pipeline_free_->pop(entry))
+        {
+            ++pipeline_dropped_;
+            EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "Receive pipeline full. Message dropped.");
+            return;
+        }
+
+        memcpy(entry->msg.buffer, data, size);
+        entry->msg.length = size;
+        entry->msg.pos = 0;
+        entry->local = localLocator;
+        entry->remote = remoteLocator;
+        entry->reception_timestamp = receptionTimestamp;
+
+        // Never fails, as the queue is able to hold all the buffers
+        pipeline_ready_->push(entry);
+
+        // Only updated by the transport threads, which are serialized
+        uint32_t depth = static_cast<uint32_t>(pipeline_ready_->size());
+        if (depth > pipeline_max_depth_.load(std::memory_order_relaxed))
+        {
+            pipeline_max_depth_.store(depth, std::memory_order_relaxed);
+        }
+    }
+
+    // Pairs with the fence on run_pipeline, so either the message is seen there or the waiting flag is seen here
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (pipeline_waiting_.load(std::memory_order_relaxed))
+    {
+        std::lock_guard<std::mutex> guard(pipeline_mtx_);
+        pipeline_cv_.notify_one();
+    }
+}
+
+void ReceiverResource::start_pipeline()
+{
+    pipeline_running_ = true;
+    pipeline_thread_ = create_thread([this]()
+                    {
+                        run_pipeline();
+                    }, fastdds::rtps::ThreadSettings{}, "dds.rcvp.%u", pipeline_port_);
+}
+
+void ReceiverResource::run_pipeline()
+{
+    PipelineEntry* entry = nullptr;
+
+    while (true)
+    {
+        if (pipeline_ready_->pop(entry))
+        {
+            process(entry->msg.buffer, entry->msg.length, entry->local, entry->remote, entry->reception_timestamp);
+            pipeline_free_->push(entry);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(pipeline_mtx_);
+        pipeline_waiting_.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (pipeline_ready_->empty())
+        {
+            if (!pipeline_running_)
+            {
+                break;
+            }
+            pipeline_cv_.wait(lock);
+        }
+        pipeline_waiting_.store(false, std::memory_order_relaxed);
+    }
+}
+
+void ReceiverResource::stop_pipeline()
+{
+    {
+        std::lock_guard<std::mutex> guard(pipeline_mtx_);
+        if (!pipeline_running_)
+        {
+            return;
+        }
+        pipeline_running_ = false;
+        pipeline_cv_.notify_one();
+    }
+
+    pipeline_thread_.join();
+}
+
+ReceiverResource::PipelineStatistics ReceiverResource::pipeline_statistics() const
+{
+    PipelineStatistics statistics;
+    if (pipeline_ready_)
+    {
+        statistics.queue_depth = static_cast<uint32_t>(pipeline_ready_->size());
+        statistics.max_queue_depth = pipeline_max_depth_.load(std::memory_order_relaxed);
+        statistics.dropped = pipeline_dropped_.load(std::memory_order_relaxed);
+    }
+    return statistics;
+}
+
 void ReceiverResource::disable()
 {
     if (Cleanup)
@@ -149,6 +322,9 @@ void ReceiverResource::disable()
         Cleanup();
     }
 
+    // Messages already on the pipeline are processed before stopping it
+    stop_pipeline();
+
     // wait until all callbacks are finished
     std::unique_lock<std::mutex> lock(mtx);
     cv_.wait(lock, [this]
@@ -161,6 +337,7 @@ void ReceiverResource::disable()
 
 ReceiverResource::~ReceiverResource()
 {
+    stop_pipeline();
 }
 
 } // namespace rtps
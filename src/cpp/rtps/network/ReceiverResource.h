@@ -15,14 +15,19 @@
 #ifndef _RTPS_NETWORK_RECEIVERRESOURCE_H_
 #define _RTPS_NETWORK_RECEIVERRESOURCE_H_
 
+#include <atomic>
 #include <condition_variable>
 #include <functional>
 #include <memory>
 #include <vector>
 
+#include <fastdds/rtps/common/ReceivePipelineStatistics.hpp>
 #include <fastdds/rtps/messages/MessageReceiver.h>
 #include <fastdds/rtps/transport/TransportInterface.h>
 
+#include <utils/collections/SingleProducerConsumerQueue.hpp>
+#include <utils/thread.hpp>
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
@@ -43,8 +48,13 @@ class ReceiverResource : public fastdds::rtps::TransportReceiverInterface
 
 public:
 
+    //! Counters of the receive pipeline stage.
+    using PipelineStatistics = fastdds::rtps::ReceivePipelineStatistics;
+
     /**
      * Method called by the transport when receiving data.
+     * When the receive pipeline stage is enabled, the data is copied to a pipeline buffer and processed later
+     * on the pipeline thread. Otherwise it is processed on the calling thread.
      * @param data Pointer to the received data.
      * @param size Number of bytes received.
      * @param localLocator Locator identifying the local endpoint.
@@ -56,6 +66,22 @@ public:
             const Locator_t& localLocator,
             const Locator_t& remoteLocator) override;
 
+    /**
+     * Method called by the transport when receiving data along with the time at which the network stack received it.
+     * The reception time is handed to the message receiver, which stores it on the received changes.
+     * @param data Pointer to the received data.
+     * @param size Number of bytes received.
+     * @param localLocator Locator identifying the local endpoint.
+     * @param remoteLocator Locator identifying the remote endpoint.
+     * @param receptionTimestamp Time at which the data was received by the network stack.
+     */
+    void OnTimestampedDataReceived(
+            const octet* data,
+            const uint32_t size,
+            const Locator_t& localLocator,
+            const Locator_t& remoteLocator,
+            const Time_t& receptionTimestamp) override;
+
     /**
      * Reports whether this resource supports the given local locator (i.e., said locator
      * maps to the transport channel managed by this resource).
@@ -87,6 +113,15 @@ public:
         return max_message_size_;
     }
 
+    //! Whether the received messages are processed on a thread of their own.
+    inline bool pipeline_enabled() const
+    {
+        return static_cast<bool>(pipeline_ready_);
+    }
+
+    //! Get the counters of the receive pipeline stage. All of them are zero when the pipeline is not enabled.
+    PipelineStatistics pipeline_statistics() const;
+
     /**
      * Resources can only be transfered through move semantics. Copy, assignment, and
      * construction outside of the factory are forbidden.
@@ -107,7 +142,34 @@ private:
     ReceiverResource(
             fastdds::rtps::TransportInterface&,
             const Locator_t&,
-            uint32_t);
+            uint32_t,
+            uint32_t pipeline_depth = 0);
+
+    //! Processes a message on the calling thread.
+    void process(
+            const octet* data,
+            const uint32_t size,
+            const Locator_t& localLocator,
+            const Locator_t& remoteLocator,
+            const Time_t& receptionTimestamp);
+
+    //! Copies a message to a free pipeline buffer and hands it to the pipeline thread.
+    void enqueue(
+            const octet* data,
+            const uint32_t size,
+            const Locator_t& localLocator,
+            const Locator_t& remoteLocator,
+            const Time_t& receptionTimestamp);
+
+    //! Starts the pipeline thread.
+    void start_pipeline();
+
+    //! Body of the pipeline thread.
+    void run_pipeline();
+
+    //! Stops the pipeline thread once the messages waiting on the pipeline have been processed.
+    void stop_pipeline();
+
     std::function<void()> Cleanup;
     std::function<bool(const Locator_t&)> LocatorMapsToManagedChannel;
     bool mValid; // Post-construction validity check for the NetworkFactory
@@ -117,6 +179,41 @@ private:
     MessageReceiver* receiver;
     uint32_t max_message_size_;
     int active_callbacks_;
+
+    //! Buffer of the receive pipeline stage
+    struct PipelineEntry
+    {
+        explicit PipelineEntry(
+                uint32_t size)
+            : msg(size)
+        {
+        }
+
+        CDRMessage_t msg;
+        Locator_t local;
+        Locator_t remote;
+        Time_t reception_timestamp;
+    };
+
+    using PipelineQueue = fastdds::SingleProducerConsumerQueue<PipelineEntry*>;
+
+    //! Buffers of the receive pipeline stage
+    std::vector<std::unique_ptr<PipelineEntry>> pipeline_pool_;
+    //! Buffers waiting to be processed, from the transport threads to the pipeline thread
+    std::unique_ptr<PipelineQueue> pipeline_ready_;
+    //! Buffers already processed, from the pipeline thread back to the transport threads
+    std::unique_ptr<PipelineQueue> pipeline_free_;
+    //! Serializes the transport threads, as a channel may be served by several of them
+    std::mutex pipeline_producer_mtx_;
+    std::mutex pipeline_mtx_;
+    std::condition_variable pipeline_cv_;
+    std::atomic<bool> pipeline_waiting_{false};
+    bool pipeline_running_ = false;
+    std::atomic<uint32_t> pipeline_max_depth_{0};
+    std::atomic<uint64_t> pipeline_dropped_{0};
+    //! Port of the channel, used to name the pipeline thread
+    uint32_t pipeline_port_ = 0;
+    eprosima::thread pipeline_thread_;
 };
 
 } // namespace rtps
@@ -135,6 +135,11 @@ uint32_t RTPSParticipant::getMaxDataSize() const
     return mp_impl->getMaxDataSize();
 }
 
+fastdds::rtps::ReceivePipelineStatistics RTPSParticipant::get_receive_pipeline_statistics() const
+{
+    return mp_impl->get_receive_pipeline_statistics();
+}
+
 ResourceEvent& RTPSParticipant::get_resource_event() const
 {
     return mp_impl->getEventResource();
@@ -55,6 +55,7 @@
 #include <fastrtps/utils/Semaphore.h>
 #include <fastrtps/xmlparser/XMLProfileManager.h>
 
+#include <rtps/DataSharing/DataSharingDispatcher.hpp>
 #include <rtps/builtin/discovery/participant/PDPServer.hpp>
 #include <rtps/builtin/discovery/participant/PDPClient.h>
 #include <rtps/history/BasicPayloadPool.hpp>
@@ -190,6 +191,7 @@ RTPSParticipantImpl::RTPSParticipantImpl(
 #endif // if FASTDDS_STATISTICS
     , has_shm_transport_(false)
     , match_local_endpoints_(should_match_local_endpoints(PParam))
+    , share_datasharing_listener_(should_share_datasharing_listener(PParam))
 {
     if (c_GuidPrefix_Unknown != persistence_guid)
     {
@@ -412,6 +414,20 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     send_buffers_.reset(new SendBuffersManager(num_send_buffers, allow_growing_buffers));
     send_buffers_->init(this);
 
+    // Create the aggregator of control messages, when enabled
+    uint32_t coalescing_period = control_messages_coalescing_period(m_att);
+    if (0 < coalescing_period)
+    {
+        control_messages_aggregator_.reset(new ControlMessagesAggregator(mp_event_thr, getMaxMessageSize(),
+                coalescing_period, [this](CDRMessage_t* message, const std::vector<Locator_t>& locators)
+                {
+                    std::chrono::steady_clock::time_point max_blocking_time_point =
+                            std::chrono::steady_clock::now() + std::chrono::milliseconds(100);
+                    sendSync(message, m_guid, Locators(locators.begin()), Locators(locators.end()),
+                            max_blocking_time_point);
+                }));
+    }
+
     // Initialize flow controller factory.
     // This must be done after initiate network layer.
     flow_controller_factory_.init(this);
@@ -497,6 +513,12 @@ void RTPSParticipantImpl::disable()
     // stopRTPSParticipantAnnouncement()
     mp_event_thr.stop_thread();
 
+    // Send the control messages still kept, as the event thread will not do it anymore
+    if (control_messages_aggregator_)
+    {
+        control_messages_aggregator_->flush();
+    }
+
     // Disable Retries on Transports
     m_network_Factory.Shutdown();
 
@@ -514,6 +536,9 @@ void RTPSParticipantImpl::disable()
         delete(mp_builtinProtocols);
         mp_builtinProtocols = nullptr;
     }
+
+    // No endpoint is left to send control messages
+    control_messages_aggregator_.reset();
 }
 
 const std::vector<RTPSWriter*>& RTPSParticipantImpl::getAllWriters() const
@@ -2111,11 +2136,40 @@ uint32_t RTPSParticipantImpl::getMaxMessageSize() const
         max_receiver_buffer_size);
 }
 
+uint32_t RTPSParticipantImpl::get_max_segmented_message_size() const
+{
+#if HAVE_SECURITY
+    // Protected RTPS messages are encoded one by one
+    if (security_attributes_.is_rtps_protected)
+    {
+        return 0;
+    }
+#endif // if HAVE_SECURITY
+
+    return m_network_Factory.get_max_segmented_message_size();
+}
+
 uint32_t RTPSParticipantImpl::getMaxDataSize()
 {
     return calculateMaxDataSize(getMaxMessageSize());
 }
 
+fastdds::rtps::ReceivePipelineStatistics RTPSParticipantImpl::get_receive_pipeline_statistics()
+{
+    fastdds::rtps::ReceivePipelineStatistics statistics;
+
+    std::lock_guard<std::mutex> guard(m_receiverResourcelistMutex);
+    for (const ReceiverControlBlock& block : m_receiverResourcelist)
+    {
+        ReceiverResource::PipelineStatistics resource_statistics = block.Receiver->pipeline_statistics();
+        statistics.queue_depth += resource_statistics.queue_depth;
+        statistics.max_queue_depth = (std::max)(statistics.max_queue_depth, resource_statistics.max_queue_depth);
+        statistics.dropped += resource_statistics.dropped;
+    }
+
+    return statistics;
+}
+
 uint32_t RTPSParticipantImpl::calculateMaxDataSize(
         uint32_t length)
 {
@@ -2982,6 +3036,80 @@ bool RTPSParticipantImpl::should_match_local_endpoints(
     return should_match_local_endpoints;
 }
 
+bool RTPSParticipantImpl::should_share_datasharing_listener(
+        const RTPSParticipantAttributes& att)
+{
+    bool should_share_datasharing_listener = false;
+
+    const std::string* shared_datasharing_listener = PropertyPolicyHelper::find_property(att.properties,
+                    "fastdds.shared_datasharing_listener");
+    if (nullptr != shared_datasharing_listener)
+    {
+        if (0 == shared_datasharing_listener->compare("true"))
+        {
+            should_share_datasharing_listener = true;
+        }
+        else if (0 != shared_datasharing_listener->compare("false"))
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PARTICIPANT,
+                    "Unkown value '" << *shared_datasharing_listener <<
+                    "' for property 'fastdds.shared_datasharing_listener'. Setting value to 'false'");
+        }
+    }
+    return should_share_datasharing_listener;
+}
+
+uint32_t RTPSParticipantImpl::control_messages_coalescing_period(
+        const RTPSParticipantAttributes& att)
+{
+    uint32_t coalescing_period = 0;
+
+    const std::string* period = PropertyPolicyHelper::find_property(att.properties,
+                    "fastdds.control_messages_coalescing_period");
+    if (nullptr != period)
+    {
+        try
+        {
+            coalescing_period = static_cast<uint32_t>(std::stoul(*period));
+        }
+        catch (const std::exception&)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PARTICIPANT,
+                    "Unkown value '" << *period <<
+                    "' for property 'fastdds.control_messages_coalescing_period'. Setting value to '0'");
+        }
+    }
+    return coalescing_period;
+}
+
+std::shared_ptr<DataSharingDispatcher> RTPSParticipantImpl::datasharing_dispatcher(
+        const std::string& directory,
+        const fastdds::rtps::ThreadSettings& thr_config)
+{
+    if (!share_datasharing_listener_)
+    {
+        return std::shared_ptr<DataSharingDispatcher>(nullptr);
+    }
+
+    std::lock_guard<std::mutex> guard(datasharing_dispatchers_mutex_);
+
+    std::shared_ptr<DataSharingDispatcher>& dispatcher = datasharing_dispatchers_[directory];
+    if (!dispatcher)
+    {
+        // The notification of the dispatcher is named after the participant, so it does not clash with any reader
+        dispatcher = DataSharingDispatcher::create(m_guid, directory, thr_config);
+        if (!dispatcher)
+        {
+            EPROSIMA_LOG_WARNING(RTPS_PARTICIPANT,
+                    "Cannot create the data-sharing dispatcher. Readers will start their own listening thread.");
+            datasharing_dispatchers_.erase(directory);
+            return std::shared_ptr<DataSharingDispatcher>(nullptr);
+        }
+    }
+
+    return dispatcher;
+}
+
 } /* namespace rtps */
 } /* namespace fastrtps */
 } /* namespace eprosima */
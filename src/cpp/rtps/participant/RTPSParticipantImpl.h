@@ -20,11 +20,13 @@
 #define _RTPS_PARTICIPANT_RTPSPARTICIPANTIMPL_H_
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <list>
+#include <map>
 #include <mutex>
 #include <set>
 #include <sys/types.h>
@@ -50,6 +52,7 @@
 #include <fastrtps/utils/shared_mutex.hpp>
 
 #include "../flowcontrol/FlowControllerFactory.hpp"
+#include <rtps/messages/ControlMessagesAggregator.hpp>
 #include <rtps/messages/RTPSMessageGroup_t.hpp>
 #include <rtps/messages/SendBuffersManager.hpp>
 #include <rtps/network/NetworkFactory.h>
@@ -110,6 +113,7 @@ class WriterAttributes;
 class WriterHistory;
 class WriterListener;
 class RTPSReader;
+class DataSharingDispatcher;
 class ReaderAttributes;
 class ReaderHistory;
 class ReaderListener;
@@ -287,6 +291,13 @@ public:
             const LocatorIteratorT& destination_locators_end,
             std::chrono::steady_clock::time_point& max_blocking_time_point)
     {
+        // Control messages from the endpoints are sent later, along with the rest of them to the same destinations
+        if (sender_guid != m_guid && control_messages_aggregator_ &&
+                control_messages_aggregator_->add(msg, destination_locators_begin, destination_locators_end))
+        {
+            return true;
+        }
+
         bool ret_code = false;
 #if HAVE_STRICT_REALTIME
         std::unique_lock<std::timed_mutex> lock(m_send_resources_mutex_, std::defer_lock);
@@ -324,6 +335,97 @@ public:
         return ret_code;
     }
 
+    /**
+     * Send a message, given as a list of slices, to several locations
+     * @param buffers Slices of the message to send.
+     * @param total_bytes Size of the message.
+     * @param segment_size When not zero, the message holds several consecutive RTPS messages of this size (the last
+     * one may be shorter). Such messages are given on a single slice.
+     * @param sender_guid GUID of the producer of the message.
+     * @param destination_locators_begin Iterator at the first destination locator.
+     * @param destination_locators_end Iterator at the end destination locator.
+     * @param max_blocking_time_point execution time limit timepoint.
+     * @return true if at least one locator has been sent.
+     */
+    template<class LocatorIteratorT>
+    bool sendSync(
+            const std::vector<fastdds::rtps::NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            uint32_t segment_size,
+            const GUID_t& sender_guid,
+            const LocatorIteratorT& destination_locators_begin,
+            const LocatorIteratorT& destination_locators_end,
+            std::chrono::steady_clock::time_point& max_blocking_time_point)
+    {
+        if (segment_size >= total_bytes)
+        {
+            segment_size = 0;
+        }
+        uint32_t step = (0 == segment_size) ? total_bytes : segment_size;
+
+        bool ret_code = false;
+#if HAVE_STRICT_REALTIME
+        std::unique_lock<std::timed_mutex> lock(m_send_resources_mutex_, std::defer_lock);
+        if (lock.try_lock_until(max_blocking_time_point))
+#else
+        std::unique_lock<std::timed_mutex> lock(m_send_resources_mutex_);
+#endif // if HAVE_STRICT_REALTIME
+        {
+            ret_code = true;
+
+            // Resources not able to send the slices get them copied, once, on a buffer reused between calls
+            const octet* flat_message = (1 == buffers.size()) ? buffers.front().buffer : nullptr;
+
+            for (auto& send_resource : send_resource_list_)
+            {
+                if (send_resource->supports_gather_send(segment_size))
+                {
+                    LocatorIteratorT locators_begin = destination_locators_begin;
+                    LocatorIteratorT locators_end = destination_locators_end;
+                    send_resource->send_gather(buffers, total_bytes, segment_size, &locators_begin, &locators_end,
+                            max_blocking_time_point);
+                    continue;
+                }
+
+                if (nullptr == flat_message)
+                {
+                    flat_send_buffer_.resize(total_bytes);
+                    fastdds::rtps::copy_network_buffers(buffers, total_bytes, flat_send_buffer_.data());
+                    flat_message = flat_send_buffer_.data();
+                }
+
+                // Segments are sent one by one
+                for (uint32_t offset = 0; offset < total_bytes; offset += step)
+                {
+                    LocatorIteratorT locators_begin = destination_locators_begin;
+                    LocatorIteratorT locators_end = destination_locators_end;
+                    send_resource->send(flat_message + offset, (std::min)(step, total_bytes - offset),
+                            &locators_begin, &locators_end, max_blocking_time_point);
+                }
+            }
+
+            lock.unlock();
+
+            // notify statistics module
+            for (uint32_t offset = 0; offset < total_bytes; offset += step)
+            {
+                on_rtps_send(
+                    sender_guid,
+                    destination_locators_begin,
+                    destination_locators_end,
+                    (std::min)(step, total_bytes - offset));
+            }
+
+            // checkout if sender is a discovery endpoint
+            on_discovery_packet(
+                sender_guid,
+                destination_locators_begin,
+                destination_locators_end);
+        }
+
+        return ret_code;
+    }
+
     //!Get the participant Mutex
     std::recursive_mutex* getParticipantMutex() const
     {
@@ -374,8 +476,19 @@ public:
 
     uint32_t getMaxMessageSize() const;
 
+    /**
+     * Maximum size of a buffer holding several consecutive RTPS messages that can be handed to sendSync
+     * as a segmented message.
+     *
+     * @return 0 when segmented messages are not supported.
+     */
+    uint32_t get_max_segmented_message_size() const;
+
     uint32_t getMaxDataSize();
 
+    //! Counters of the receive pipeline stage, added up over all the receive resources.
+    fastdds::rtps::ReceivePipelineStatistics get_receive_pipeline_statistics();
+
     uint32_t calculateMaxDataSize(
             uint32_t length);
 
@@ -580,6 +693,8 @@ private:
     std::function<bool(const std::string&)> type_check_fn_;
     //!Pool of send buffers
     std::unique_ptr<SendBuffersManager> send_buffers_;
+    //!Aggregator of the control messages sent by the endpoints. Only created when coalescing is enabled.
+    std::unique_ptr<ControlMessagesAggregator> control_messages_aggregator_;
 
     /**
      * Client override flag: SIMPLE participant that has been overriden with the environment variable and transformed
@@ -606,6 +721,9 @@ private:
     std::timed_mutex m_send_resources_mutex_;
     fastdds::rtps::SendResourceList send_resource_list_;
 
+    //! Messages given as slices, copied for the resources not able to send them. Protected by the mutex above.
+    std::vector<octet> flat_send_buffer_;
+
     //!Participant Listener
     RTPSParticipantListener* mp_participantListener;
     //!Pointer to the user participant
@@ -781,6 +899,20 @@ private:
     bool should_match_local_endpoints(
             const RTPSParticipantAttributes& att);
 
+    //! Whether the data-sharing readers are dispatched by a participant-wide thread, instead of one thread each
+    bool share_datasharing_listener_ = false;
+
+    //! Data-sharing dispatchers, one for each shared memory directory
+    std::map<std::string, std::shared_ptr<DataSharingDispatcher>> datasharing_dispatchers_;
+    std::mutex datasharing_dispatchers_mutex_;
+
+    bool should_share_datasharing_listener(
+            const RTPSParticipantAttributes& att);
+
+    //! Period during which the control messages of the endpoints are coalesced, in microseconds. Zero if disabled.
+    uint32_t control_messages_coalescing_period(
+            const RTPSParticipantAttributes& att);
+
 public:
 
     const RTPSParticipantAttributes& getRTPSParticipantAttributes() const
@@ -1266,6 +1398,17 @@ public:
         return match_local_endpoints_;
     }
 
+    /**
+     * Get the dispatcher of the data-sharing notifications of the readers using a shared memory directory,
+     * creating it when needed.
+     * @param directory Shared memory directory of the reader.
+     * @param thr_config Settings of the dispatcher thread, used when the dispatcher is created.
+     * @return The dispatcher, or nullptr if the reader should start its own listening thread.
+     */
+    std::shared_ptr<DataSharingDispatcher> datasharing_dispatcher(
+            const std::string& directory,
+            const fastdds::rtps::ThreadSettings& thr_config);
+
 };
 } // namespace rtps
 } /* namespace rtps */
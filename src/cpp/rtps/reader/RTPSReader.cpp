@@ -132,7 +132,11 @@ void RTPSReader::init(
                         att.endpoint.data_sharing_configuration().shm_directory(),
                         att.data_sharing_listener_thread,
                         att.matched_writers_allocation,
-                        this));
+                        this,
+                        mp_RTPSParticipant->datasharing_dispatcher(
+                            att.endpoint.data_sharing_configuration().shm_directory(),
+                            att.data_sharing_listener_thread),
+                        std::chrono::nanoseconds(att.endpoint.data_sharing_configuration().spin_duration().to_ns())));
 
             // We can start the listener here, as no writer can be matched already,
             // so no notification will occur until the non-virtual instance is constructed.
@@ -1067,7 +1067,11 @@ bool StatefulReader::change_received(
                 {
                     if (mp_history->received_change(a_change, 0))
                     {
-                        Time_t::now(a_change->reader_info.receptionTimestamp);
+                        // Keep the reception time captured by the transport, if any
+                        if (c_RTPSTimeZero == a_change->reader_info.receptionTimestamp)
+                        {
+                            Time_t::now(a_change->reader_info.receptionTimestamp);
+                        }
 
                         // If we use the real a_change->sequenceNumber no DATA(p) with a lower one will ever be received.
                         // That happens because the WriterProxy created when the listener matches the PDP endpoints is
@@ -1140,7 +1144,11 @@ bool StatefulReader::change_received(
             }
         }
 
-        Time_t::now(a_change->reader_info.receptionTimestamp);
+        // Keep the reception time captured by the transport, if any
+        if (c_RTPSTimeZero == a_change->reader_info.receptionTimestamp)
+        {
+            Time_t::now(a_change->reader_info.receptionTimestamp);
+        }
 
         // WARNING! This method could destroy a_change
         NotifyChanges(prox);
@@ -17,6 +17,7 @@
  *
  */
 
+#include <algorithm>
 #include <cassert>
 #include <mutex>
 #include <thread>
@@ -39,6 +40,24 @@
 
 using namespace eprosima::fastrtps::rtps;
 
+//! Maximum number of samples being reassembled at the same time by a reader, from all its writers
+static constexpr size_t max_fragmented_changes = 4;
+
+/**
+ * Finds the oldest change being reassembled from the fragments of a writer.
+ * @param fragmented_changes Changes being reassembled from the fragments of the writer. Should not be empty.
+ * @return Iterator to the change with the lowest sequence number.
+ */
+static std::vector<CacheChange_t*>::iterator oldest_fragmented_change(
+        std::vector<CacheChange_t*>& fragmented_changes)
+{
+    return std::min_element(fragmented_changes.begin(), fragmented_changes.end(),
+                   [](const CacheChange_t* a, const CacheChange_t* b)
+                   {
+                       return a->sequenceNumber < b->sequenceNumber;
+                   });
+}
+
 StatelessReader::~StatelessReader()
 {
     EPROSIMA_LOG_INFO(RTPS_READER, "Removing reader " << m_guid);
@@ -49,6 +68,12 @@ StatelessReader::~StatelessReader()
     {
         datasharing_listener_->stop();
     }
+
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    for (RemoteWriterInfo_t& writer : matched_writers_)
+    {
+        release_fragmented_changes(writer, true);
+    }
 }
 
 StatelessReader::StatelessReader(
@@ -257,6 +282,7 @@ bool StatelessReader::matched_writer_remove(
                     remove_changes_from(writer_guid, true);
                 }
 
+                release_fragmented_changes(*it, true);
                 remove_persistence_guid(it->guid, it->persistence_guid, removed_by_lease);
                 matched_writers_.erase(it);
                 if (nullptr != mp_listener)
@@ -338,7 +364,11 @@ bool StatelessReader::change_received(
             auto guid = change->writerGUID;
             auto seq = change->sequenceNumber;
 
-            Time_t::now(change->reader_info.receptionTimestamp);
+            // Keep the reception time captured by the transport, if any
+            if (c_RTPSTimeZero == change->reader_info.receptionTimestamp)
+            {
+                Time_t::now(change->reader_info.receptionTimestamp);
+            }
             SequenceNumber_t previous_seq{ 0, 0 };
             if (update_notified)
             {
@@ -684,13 +714,6 @@ bool StatelessReader::processDataFragMsg(
                         IDSTRING "Trying to add fragment " << incomingChange->sequenceNumber.to64long() <<
                         " TO reader: " << m_guid);
 
-                // Early return if we already know about a greater sequence number
-                CacheChange_t* work_change = writer.fragmented_change;
-                if (work_change != nullptr && work_change->sequenceNumber > incomingChange->sequenceNumber)
-                {
-                    return true;
-                }
-
                 bool will_never_be_accepted = false;
                 if (!mp_history->can_change_be_added_nts(writer_guid, sampleSize, 0, will_never_be_accepted))
                 {
@@ -703,12 +726,52 @@ bool StatelessReader::processDataFragMsg(
 
                 CacheChange_t* change_to_add = incomingChange;
 
-                // Check if pending fragmented change should be dropped
-                if (work_change != nullptr)
+                // Look for the change being reassembled for this sequence number
+                std::vector<CacheChange_t*>& fragmented_changes = writer.fragmented_changes;
+                auto work_it = std::find_if(fragmented_changes.begin(), fragmented_changes.end(),
+                                [change_to_add](const CacheChange_t* change)
+                                {
+                                    return change->sequenceNumber == change_to_add->sequenceNumber;
+                                });
+                CacheChange_t* work_change = (fragmented_changes.end() != work_it) ? *work_it : nullptr;
+
+                if (work_change == nullptr)
                 {
-                    if (work_change->sequenceNumber < change_to_add->sequenceNumber)
+                    // Changes which will never be notified are not kept
+                    release_fragmented_changes(writer, false);
+
+                    // The limit of changes being reassembled is shared by all the writers
+                    size_t total_fragmented_changes = 0;
+                    for (const RemoteWriterInfo_t& matched_writer : matched_writers_)
+                    {
+                        total_fragmented_changes += matched_writer.fragmented_changes.size();
+                    }
+
+                    if (total_fragmented_changes >= max_fragmented_changes && fragmented_changes.empty())
+                    {
+                        // Make room by dropping the oldest change of the writer with most changes pending
+                        auto busiest_it = std::max_element(matched_writers_.begin(), matched_writers_.end(),
+                                        [](const RemoteWriterInfo_t& a, const RemoteWriterInfo_t& b)
+                                        {
+                                            return a.fragmented_changes.size() < b.fragmented_changes.size();
+                                        });
+                        auto dropped_it = oldest_fragmented_change(busiest_it->fragmented_changes);
+                        releaseCache(*dropped_it);
+                        busiest_it->fragmented_changes.erase(dropped_it);
+                    }
+                    else if (total_fragmented_changes >= max_fragmented_changes)
                     {
-                        // Pending change should be dropped. Check if it can be reused
+                        // Drop the oldest pending change of this writer, unless the incoming one is older
+                        auto oldest_it = oldest_fragmented_change(fragmented_changes);
+                        if ((*oldest_it)->sequenceNumber > change_to_add->sequenceNumber)
+                        {
+                            return true;
+                        }
+
+                        work_change = *oldest_it;
+                        fragmented_changes.erase(oldest_it);
+
+                        // Check if it can be reused
                         if (sampleSize <= work_change->serializedPayload.max_size)
                         {
                             // Sample fits inside pending change. Reuse it.
@@ -723,25 +786,31 @@ bool StatelessReader::processDataFragMsg(
                             work_change = nullptr;
                         }
                     }
-                }
 
-                // Check if a new change should be reserved
-                if (work_change == nullptr)
-                {
-                    if (reserveCache(&work_change, sampleSize))
+                    // Check if a new change should be reserved.
+                    // The payload is reserved with its final size, so every fragment is copied straight into it.
+                    if (work_change == nullptr)
                     {
-                        if (work_change->serializedPayload.max_size < sampleSize)
+                        if (reserveCache(&work_change, sampleSize))
                         {
-                            releaseCache(work_change);
-                            work_change = nullptr;
-                        }
-                        else
-                        {
-                            work_change->copy_not_memcpy(change_to_add);
-                            work_change->serializedPayload.length = sampleSize;
-                            work_change->setFragmentSize(change_to_add->getFragmentSize(), true);
+                            if (work_change->serializedPayload.max_size < sampleSize)
+                            {
+                                releaseCache(work_change);
+                                work_change = nullptr;
+                            }
+                            else
+                            {
+                                work_change->copy_not_memcpy(change_to_add);
+                                work_change->serializedPayload.length = sampleSize;
+                                work_change->setFragmentSize(change_to_add->getFragmentSize(), true);
+                            }
                         }
                     }
+
+                    if (work_change != nullptr)
+                    {
+                        fragmented_changes.push_back(work_change);
+                    }
                 }
 
                 // Process fragment and set change_completed if it is fully reassembled
@@ -752,12 +821,11 @@ bool StatelessReader::processDataFragMsg(
                             fragmentsInSubmessage))
                     {
                         change_completed = work_change;
-                        work_change = nullptr;
+                        fragmented_changes.erase(
+                            std::find(fragmented_changes.begin(), fragmented_changes.end(), work_change));
                     }
                 }
 
-                writer.fragmented_change = work_change;
-
                 // If the change was completed, process it.
                 if (change_completed != nullptr)
                 {
@@ -834,6 +902,25 @@ bool StatelessReader::acceptMsgFrom(
                    });
 }
 
+void StatelessReader::release_fragmented_changes(
+        RemoteWriterInfo_t& writer,
+        bool release_all)
+{
+    auto it = writer.fragmented_changes.begin();
+    while (it != writer.fragmented_changes.end())
+    {
+        if (release_all || thereIsUpperRecordOf(writer.guid, (*it)->sequenceNumber))
+        {
+            releaseCache(*it);
+            it = writer.fragmented_changes.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
 bool StatelessReader::thereIsUpperRecordOf(
         const GUID_t& guid,
         const SequenceNumber_t& seq)
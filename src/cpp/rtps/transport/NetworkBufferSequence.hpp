@@ -0,0 +1,120 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _RTPS_TRANSPORT_NETWORKBUFFERSEQUENCE_HPP_
+#define _RTPS_TRANSPORT_NETWORKBUFFERSEQUENCE_HPP_
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include <asio.hpp>
+
+#include <fastdds/rtps/transport/NetworkBuffer.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Sequence of asio buffers, usable as an asio ConstBufferSequence, pointing to the slices of a message.
+ *
+ * Messages are made of a few slices, which are kept on the object itself, so handing a message to asio does not
+ * allocate memory. Only messages with more than fixed_capacity slices use memory from the heap.
+ */
+class NetworkBufferSequence
+{
+public:
+
+    using value_type = asio::const_buffer;
+    using const_iterator = const asio::const_buffer*;
+
+    //! Number of slices stored without allocating memory
+    static constexpr size_t fixed_capacity = 8;
+
+    NetworkBufferSequence() = default;
+
+    explicit NetworkBufferSequence(
+            const std::vector<NetworkBuffer>& buffers)
+    {
+        reserve(buffers.size());
+        for (const NetworkBuffer& buffer : buffers)
+        {
+            push_back(asio::buffer(buffer.buffer, buffer.size));
+        }
+    }
+
+    void reserve(
+            size_t size)
+    {
+        if (size > fixed_capacity)
+        {
+            extra_buffers_.reserve(size);
+        }
+    }
+
+    void push_back(
+            const asio::const_buffer& buffer)
+    {
+        if (size_ < fixed_capacity)
+        {
+            fixed_buffers_[size_] = buffer;
+        }
+        else
+        {
+            // Slices move to the heap once, when the fixed storage runs out
+            if (extra_buffers_.empty())
+            {
+                extra_buffers_.assign(fixed_buffers_.begin(), fixed_buffers_.end());
+            }
+            extra_buffers_.push_back(buffer);
+        }
+        ++size_;
+    }
+
+    const_iterator begin() const
+    {
+        return size_ > fixed_capacity ? extra_buffers_.data() : fixed_buffers_.data();
+    }
+
+    const_iterator end() const
+    {
+        return begin() + size_;
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+    const asio::const_buffer& operator [](
+            size_t index) const
+    {
+        return begin()[index];
+    }
+
+private:
+
+    std::array<asio::const_buffer, fixed_capacity> fixed_buffers_;
+
+    std::vector<asio::const_buffer> extra_buffers_;
+
+    size_t size_ = 0;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _RTPS_TRANSPORT_NETWORKBUFFERSEQUENCE_HPP_
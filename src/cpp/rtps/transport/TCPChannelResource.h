@@ -15,11 +15,14 @@
 #ifndef _FASTDDS_TCP_CHANNEL_RESOURCE_BASE_
 #define _FASTDDS_TCP_CHANNEL_RESOURCE_BASE_
 
+#include <vector>
+
 #include <asio.hpp>
 #include <fastdds/rtps/transport/TCPTransportDescriptor.h>
 #include <fastdds/rtps/transport/TransportReceiverInterface.h>
 #include <fastdds/rtps/common/Locator.h>
 #include <rtps/transport/ChannelResource.h>
+#include <rtps/transport/NetworkBufferSequence.hpp>
 #include <rtps/transport/tcp/RTCPMessageManager.h>
 
 
@@ -123,12 +126,34 @@ public:
             std::size_t size,
             asio::error_code& ec) = 0;
 
+    /**
+     * Sends a header followed by a list of buffers, which are written to the socket without being flattened.
+     *
+     * @param header Pointer to the TCP header, or nullptr when there is none.
+     * @param header_size Size of the TCP header.
+     * @param buffers Buffers to send after the header.
+     * @param total_bytes Total size of the buffers.
+     * @param [out] ec Error of the send operation.
+     * @return Number of bytes sent or queued to be sent, header included.
+     */
     virtual size_t send(
+            const fastrtps::rtps::octet* header,
+            size_t header_size,
+            const NetworkBufferSequence& buffers,
+            size_t total_bytes,
+            asio::error_code& ec) = 0;
+
+    size_t send(
             const fastrtps::rtps::octet* header,
             size_t header_size,
             const fastrtps::rtps::octet* buffer,
             size_t size,
-            asio::error_code& ec) = 0;
+            asio::error_code& ec)
+    {
+        NetworkBufferSequence buffers;
+        buffers.push_back(asio::buffer(buffer, size));
+        return send(header, header_size, buffers, size, ec);
+    }
 
     virtual asio::ip::tcp::endpoint remote_endpoint() const = 0;
 
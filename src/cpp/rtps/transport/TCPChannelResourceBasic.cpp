@@ -17,7 +17,14 @@
 #include <future>
 #include <array>
 
+#if !defined(_WIN32)
+#include <cerrno>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#endif // if !defined(_WIN32)
+
 #include <asio.hpp>
+#include <fastdds/dds/log/Log.hpp>
 #include <fastrtps/utils/IPLocator.h>
 #include <rtps/transport/TCPTransportInterface.h>
 
@@ -38,6 +45,7 @@ TCPChannelResourceBasic::TCPChannelResourceBasic(
         uint32_t maxMsgSize)
     : TCPChannelResource(parent, locator, maxMsgSize)
     , service_(service)
+    , outbound_(std::make_shared<OutboundQueue>())
 {
 }
 
@@ -49,6 +57,7 @@ TCPChannelResourceBasic::TCPChannelResourceBasic(
     : TCPChannelResource(parent, maxMsgSize)
     , service_(service)
     , socket_(socket)
+    , outbound_(std::make_shared<OutboundQueue>())
 {
 }
 
@@ -142,31 +151,201 @@ uint32_t TCPChannelResourceBasic::read(
 size_t TCPChannelResourceBasic::send(
         const octet* header,
         size_t header_size,
-        const octet* data,
-        size_t size,
+        const NetworkBufferSequence& data,
+        size_t total_bytes,
         asio::error_code& ec)
 {
     size_t bytes_sent = 0;
 
     if (eConnecting < connection_status_)
     {
-        std::lock_guard<std::mutex> send_guard(send_mutex_);
+        NetworkBufferSequence buffers;
+        buffers.reserve(data.size() + 1);
         if (header_size > 0)
         {
-            std::array<asio::const_buffer, 2> buffers;
-            buffers[0] = asio::buffer(header, header_size);
-            buffers[1] = asio::buffer(data, size);
-            bytes_sent = asio::write(*socket_.get(), buffers, ec);
+            buffers.push_back(asio::buffer(header, header_size));
         }
-        else
+        for (const asio::const_buffer& buffer : data)
+        {
+            buffers.push_back(buffer);
+        }
+
+#if ASIO_VERSION >= 101100
+        if (0 < send_queue_size_)
         {
-            bytes_sent = asio::write(*socket_.get(), asio::buffer(data, size), ec);
+            return send_or_queue(buffers, header_size + total_bytes, ec);
         }
+#else
+        static_cast<void>(total_bytes);
+#endif // if ASIO_VERSION >= 101100
+
+        std::lock_guard<std::mutex> send_guard(send_mutex_);
+        bytes_sent = asio::write(*socket_.get(), buffers, ec);
     }
 
     return bytes_sent;
 }
 
+#if ASIO_VERSION >= 101100
+size_t TCPChannelResourceBasic::send_or_queue(
+        const NetworkBufferSequence& buffers,
+        size_t size,
+        asio::error_code& ec)
+{
+    std::shared_ptr<asio::ip::tcp::socket> socket = socket_;
+    std::lock_guard<std::mutex> guard(outbound_->mutex);
+
+    // Bytes queued for a previous connection are not sent on the new one
+    if (outbound_->socket != socket)
+    {
+        outbound_->clear();
+        outbound_->socket = socket;
+    }
+
+    // The stream cannot interleave messages, so nothing is written while there are bytes queued
+    size_t written = 0;
+    if (0 == outbound_->size())
+    {
+        written = write_some_nonblocking(*socket, buffers, ec);
+        if (ec)
+        {
+            if (asio::error::would_block != ec)
+            {
+                return written;
+            }
+            ec.clear();
+        }
+
+        if (written == size)
+        {
+            return size;
+        }
+    }
+    else if (outbound_->size() + size > send_queue_size_)
+    {
+        // A slow peer makes its own messages be dropped, without blocking the writer
+        ec = asio::error::would_block;
+        return 0;
+    }
+
+    // The part of the message not accepted by the socket is queued, even if it exceeds the limit,
+    // as the rest of the message has already been written.
+    size_t skip = written;
+    for (const asio::const_buffer& buffer : buffers)
+    {
+        const octet* begin = static_cast<const octet*>(buffer.data());
+        size_t length = buffer.size();
+        if (skip >= length)
+        {
+            skip -= length;
+            continue;
+        }
+        outbound_->bytes.insert(outbound_->bytes.end(), begin + skip, begin + length);
+        skip = 0;
+    }
+
+    if (!outbound_->flushing)
+    {
+        outbound_->flushing = true;
+        flush(outbound_, socket);
+    }
+
+    return size;
+}
+
+size_t TCPChannelResourceBasic::write_some_nonblocking(
+        asio::ip::tcp::socket& socket,
+        const NetworkBufferSequence& buffers,
+        asio::error_code& ec)
+{
+#if !defined(_WIN32)
+    // Messages made of a few slices do not allocate memory
+    std::array<struct iovec, NetworkBufferSequence::fixed_capacity> fixed_iov;
+    std::vector<struct iovec> extra_iov;
+    struct iovec* iov = fixed_iov.data();
+    if (buffers.size() > fixed_iov.size())
+    {
+        extra_iov.resize(buffers.size());
+        iov = extra_iov.data();
+    }
+
+    for (size_t i = 0; i < buffers.size(); ++i)
+    {
+        iov[i].iov_base = const_cast<void*>(buffers[i].data());
+        iov[i].iov_len = buffers[i].size();
+    }
+
+    struct msghdr msg = {};
+    msg.msg_iov = iov;
+    msg.msg_iovlen = buffers.size();
+
+    int flags = MSG_DONTWAIT;
+#if defined(MSG_NOSIGNAL)
+    flags |= MSG_NOSIGNAL;
+#endif // if defined(MSG_NOSIGNAL)
+
+    ssize_t ret = ::sendmsg(socket.native_handle(), &msg, flags);
+    if (0 > ret)
+    {
+        if (EAGAIN == errno || EWOULDBLOCK == errno)
+        {
+            ec = asio::error::would_block;
+        }
+        else
+        {
+            ec = asio::error_code(errno, asio::error::get_system_category());
+        }
+        return 0;
+    }
+    return static_cast<size_t>(ret);
+#else
+    // Without a portable non-blocking send, the bytes are written blocking
+    return asio::write(socket, buffers, ec);
+#endif // if !defined(_WIN32)
+}
+
+void TCPChannelResourceBasic::flush(
+        std::shared_ptr<OutboundQueue> queue,
+        std::shared_ptr<asio::ip::tcp::socket> socket)
+{
+    socket->async_wait(asio::ip::tcp::socket::wait_write,
+            [queue, socket](const asio::error_code& wait_ec)
+            {
+                std::lock_guard<std::mutex> guard(queue->mutex);
+                if (queue->socket != socket)
+                {
+                    return;
+                }
+
+                if (wait_ec)
+                {
+                    queue->clear();
+                    return;
+                }
+
+                asio::error_code ec;
+                NetworkBufferSequence pending;
+                pending.push_back(asio::buffer(queue->bytes.data() + queue->head, queue->size()));
+                queue->head += write_some_nonblocking(*socket, pending, ec);
+
+                if (ec && asio::error::would_block != ec)
+                {
+                    EPROSIMA_LOG_WARNING(RTCP, "Error sending queued TCP data: " << ec.message());
+                    queue->clear();
+                }
+                else if (0 == queue->size())
+                {
+                    queue->clear();
+                }
+                else
+                {
+                    flush(queue, socket);
+                }
+            });
+}
+
+#endif // if ASIO_VERSION >= 101100
+
 asio::ip::tcp::endpoint TCPChannelResourceBasic::remote_endpoint() const
 {
     return socket_->remote_endpoint();
@@ -184,6 +363,9 @@ void TCPChannelResourceBasic::set_options(
     socket_->set_option(socket_base::receive_buffer_size(options->receiveBufferSize));
     socket_->set_option(socket_base::send_buffer_size(options->sendBufferSize));
     socket_->set_option(ip::tcp::no_delay(options->enable_tcp_nodelay));
+#if ASIO_VERSION >= 101100
+    send_queue_size_ = options->send_queue_size;
+#endif // if ASIO_VERSION >= 101100
 }
 
 void TCPChannelResourceBasic::cancel()
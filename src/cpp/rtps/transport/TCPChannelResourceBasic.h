@@ -16,6 +16,8 @@
 #define _FASTDDS_TCP_CHANNEL_RESOURCE_BASIC_
 
 #include <mutex>
+#include <vector>
+
 #include <asio.hpp>
 #include <rtps/transport/TCPChannelResource.h>
 
@@ -25,11 +27,49 @@ namespace rtps {
 
 class TCPChannelResourceBasic : public TCPChannelResource
 {
+    /**
+     * Bytes accepted for sending but not yet written to a socket.
+     * Shared with the operations waiting for the socket to become writable, which may outlive the channel.
+     */
+    struct OutboundQueue
+    {
+        std::mutex mutex;
+
+        //! Socket the bytes are written to
+        std::shared_ptr<asio::ip::tcp::socket> socket;
+
+        std::vector<fastrtps::rtps::octet> bytes;
+
+        //! Position of the first byte not yet written
+        size_t head = 0;
+
+        //! Whether a wait for the socket to become writable is in progress
+        bool flushing = false;
+
+        size_t size() const
+        {
+            return bytes.size() - head;
+        }
+
+        void clear()
+        {
+            bytes.clear();
+            head = 0;
+            flushing = false;
+        }
+
+    };
+
     asio::io_service& service_;
 
     std::mutex send_mutex_;
     std::shared_ptr<asio::ip::tcp::socket> socket_;
 
+    //! Maximum number of bytes on outbound_. When 0, sends block until all the bytes are written.
+    uint32_t send_queue_size_ = 0;
+
+    std::shared_ptr<OutboundQueue> outbound_;
+
 public:
 
     // Constructor called when trying to connect to a remote server
@@ -58,11 +98,13 @@ public:
             std::size_t size,
             asio::error_code& ec) override;
 
+    using TCPChannelResource::send;
+
     size_t send(
             const fastrtps::rtps::octet* header,
             size_t header_size,
-            const fastrtps::rtps::octet* data,
-            size_t size,
+            const NetworkBufferSequence& buffers,
+            size_t total_bytes,
             asio::error_code& ec) override;
 
     asio::ip::tcp::endpoint remote_endpoint() const override;
@@ -83,6 +125,28 @@ public:
 
 private:
 
+#if ASIO_VERSION >= 101100
+    /**
+     * Writes the buffers without blocking, queuing the bytes the socket does not accept.
+     * Messages are dropped when the queue does not have room for them.
+     */
+    size_t send_or_queue(
+            const NetworkBufferSequence& buffers,
+            size_t size,
+            asio::error_code& ec);
+
+    //! Writes to the socket the bytes it accepts without blocking.
+    static size_t write_some_nonblocking(
+            asio::ip::tcp::socket& socket,
+            const NetworkBufferSequence& buffers,
+            asio::error_code& ec);
+
+    //! Writes the queued bytes as the socket becomes writable.
+    static void flush(
+            std::shared_ptr<OutboundQueue> queue,
+            std::shared_ptr<asio::ip::tcp::socket> socket);
+#endif // if ASIO_VERSION >= 101100
+
     TCPChannelResourceBasic(
             const TCPChannelResourceBasic&) = delete;
     TCPChannelResourceBasic& operator =(
@@ -202,20 +202,24 @@ uint32_t TCPChannelResourceSecure::read(
 size_t TCPChannelResourceSecure::send(
         const octet* header,
         size_t header_size,
-        const octet* data,
-        size_t size,
+        const NetworkBufferSequence& data,
+        size_t,
         asio::error_code& ec)
 {
     size_t bytes_sent = 0;
 
     if (eConnecting < connection_status_)
     {
-        std::vector<asio::const_buffer> buffers;
+        NetworkBufferSequence buffers;
+        buffers.reserve(data.size() + 1);
         if (header_size > 0)
         {
             buffers.push_back(asio::buffer(header, header_size));
         }
-        buffers.push_back(asio::buffer(data, size));
+        for (const asio::const_buffer& buffer : data)
+        {
+            buffers.push_back(buffer);
+        }
 
         // Work around meanwhile
         std::promise<size_t> write_bytes_promise;
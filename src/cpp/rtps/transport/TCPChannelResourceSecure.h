@@ -58,11 +58,13 @@ public:
             std::size_t size,
             asio::error_code& ec) override;
 
+    using TCPChannelResource::send;
+
     size_t send(
             const fastrtps::rtps::octet* header,
             size_t header_size,
-            const fastrtps::rtps::octet* data,
-            size_t size,
+            const NetworkBufferSequence& buffers,
+            size_t total_bytes,
             asio::error_code& ec) override;
 
     asio::ip::tcp::endpoint remote_endpoint() const override;
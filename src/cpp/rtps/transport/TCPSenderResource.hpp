@@ -52,6 +52,18 @@ public:
                     return transport.send(data, dataSize, channel_, destination_locators_begin,
                                    destination_locators_end);
                 };
+
+        send_gather_lambda_ = [this, &transport](
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            uint32_t,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end,
+            const std::chrono::steady_clock::time_point&) -> bool
+                {
+                    return transport.send(buffers, total_bytes, channel_, destination_locators_begin,
+                                   destination_locators_end);
+                };
     }
 
     virtual ~TCPSenderResource()
@@ -18,6 +18,7 @@
 #include <cassert>
 #include <chrono>
 #include <cstring>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -44,6 +45,7 @@
 #include <fastdds/rtps/common/LocatorSelectorEntry.hpp>
 #include <fastdds/rtps/common/PortParameters.h>
 #include <fastdds/rtps/common/Types.h>
+#include <fastdds/rtps/messages/RTPS_messages.h>
 #include <fastdds/rtps/transport/SenderResource.h>
 #include <fastdds/rtps/transport/SocketTransportDescriptor.h>
 #include <fastdds/rtps/transport/TCPTransportDescriptor.h>
@@ -91,6 +93,20 @@ FASTDDS_TODO_BEFORE(3, 0,
         "Eliminate s_default_tcp_negotitation_timeout, variable used to initialize deprecate attribute.")
 static const int s_default_tcp_negotitation_timeout = 5000; // 5 Seconds
 
+/**
+ * Number of bytes to discard from the beginning of a header for the RTCP synchronization word to be found.
+ * @return 0 when the header starts with the synchronization word.
+ */
+static size_t rtcp_sync_skip(
+        const TCPHeader& tcp_header)
+{
+    return                                        // Text   Next possible match   Skip to next match
+        (tcp_header.rtcp[0] != 'R') ? 1 :         // X---   XRTCP                 1
+        (tcp_header.rtcp[1] != 'T') ? 1 :         // RX--   RRTCP                 1
+        (tcp_header.rtcp[2] != 'C') ? 2 :         // RTX-   RTRTCP                2
+        (tcp_header.rtcp[3] != 'P') ? 3 : 0;      // RTCX   RTCRTCP               3
+}
+
 TCPTransportDescriptor::TCPTransportDescriptor()
     : SocketTransportDescriptor(s_maximumMessageSize, s_maximumInitialPeersRange)
     , keep_alive_frequency_ms(s_default_keep_alive_frequency)
@@ -125,6 +141,10 @@ TCPTransportDescriptor::TCPTransportDescriptor(
     , tls_config(t.tls_config)
     , keep_alive_thread(t.keep_alive_thread)
     , accept_thread(t.accept_thread)
+    , reactor_threads(t.reactor_threads)
+    , reactor_thread(t.reactor_thread)
+    , send_queue_size(t.send_queue_size)
+    , connection_streams(t.connection_streams)
 {
 }
 
@@ -152,6 +172,10 @@ TCPTransportDescriptor& TCPTransportDescriptor::operator =(
     tls_config = t.tls_config;
     keep_alive_thread = t.keep_alive_thread;
     accept_thread = t.accept_thread;
+    reactor_threads = t.reactor_threads;
+    reactor_thread = t.reactor_thread;
+    send_queue_size = t.send_queue_size;
+    connection_streams = t.connection_streams;
     return *this;
 }
 
@@ -173,6 +197,10 @@ bool TCPTransportDescriptor::operator ==(
            this->tls_config == t.tls_config &&
            this->keep_alive_thread == t.keep_alive_thread &&
            this->accept_thread == t.accept_thread &&
+           this->reactor_threads == t.reactor_threads &&
+           this->reactor_thread == t.reactor_thread &&
+           this->send_queue_size == t.send_queue_size &&
+           this->connection_streams == t.connection_streams &&
            SocketTransportDescriptor::operator ==(t));
 }
 
@@ -216,6 +244,11 @@ void TCPTransportInterface::clean()
             {
                 channels.push_back(channel.second);
             }
+
+            for (auto& streams : stream_channel_resources_)
+            {
+                channels.insert(channels.end(), streams.second.begin(), streams.second.end());
+            }
         }
 
         for (auto& channel : channels)
@@ -257,6 +290,15 @@ void TCPTransportInterface::clean()
         io_service_.stop();
         io_service_thread_.join();
     }
+
+    for (auto& reactor_thread : reactor_threads_)
+    {
+        if (reactor_thread.joinable())
+        {
+            reactor_thread.join();
+        }
+    }
+    reactor_threads_.clear();
 }
 
 void TCPTransportInterface::bind_socket(
@@ -268,6 +310,40 @@ void TCPTransportInterface::bind_socket(
     auto it_remove = std::find(unbound_channel_resources_.begin(), unbound_channel_resources_.end(), channel);
     assert(it_remove != unbound_channel_resources_.end());
     unbound_channel_resources_.erase(it_remove);
+
+    // A peer may open several connections to this locator. The last one bound is used as the main connection,
+    // and the previous ones are kept as additional streams while they are established.
+    auto existing = channel_resources_.find(channel->locator());
+    if (existing != channel_resources_.end() && existing->second != channel)
+    {
+        std::vector<std::shared_ptr<TCPChannelResource>>& streams = stream_channel_resources_[channel->locator()];
+        streams.erase(std::remove_if(streams.begin(), streams.end(),
+                [](const std::shared_ptr<TCPChannelResource>& stream)
+                {
+                    return !stream->connection_established();
+                }), streams.end());
+        if (existing->second->connection_established())
+        {
+            streams.push_back(existing->second);
+        }
+
+        // Writers whose stream has been dropped choose their connection again
+        auto writers = writer_stream_channel_resources_.find(channel->locator());
+        if (writers != writer_stream_channel_resources_.end())
+        {
+            for (auto writer = writers->second.begin(); writer != writers->second.end();)
+            {
+                if (writer->second && !writer->second->connection_established())
+                {
+                    writer = writers->second.erase(writer);
+                }
+                else
+                {
+                    ++writer;
+                }
+            }
+        }
+    }
     channel_resources_[channel->locator()] = channel;
 
 }
@@ -287,13 +363,15 @@ bool TCPTransportInterface::check_crc(
 
 void TCPTransportInterface::calculate_crc(
         TCPHeader& header,
-        const octet* data,
-        uint32_t size) const
+        const std::vector<NetworkBuffer>& buffers) const
 {
     uint32_t crc(0);
-    for (uint32_t i = 0; i < size; ++i)
+    for (const NetworkBuffer& buffer : buffers)
     {
-        crc = RTCPMessageManager::addToCRC(crc, data[i]);
+        for (uint32_t i = 0; i < buffer.size; ++i)
+        {
+            crc = RTCPMessageManager::addToCRC(crc, buffer.buffer[i]);
+        }
     }
     header.crc = crc;
 }
@@ -380,15 +458,15 @@ uint16_t TCPTransportInterface::create_acceptor_socket(
 
 void TCPTransportInterface::fill_rtcp_header(
         TCPHeader& header,
-        const octet* send_buffer,
-        uint32_t send_buffer_size,
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
         uint16_t logical_port) const
 {
-    header.length = send_buffer_size + static_cast<uint32_t>(TCPHeader::size());
+    header.length = total_bytes + static_cast<uint32_t>(TCPHeader::size());
     header.logical_port = logical_port;
     if (configuration()->calculate_crc)
     {
-        calculate_crc(header, send_buffer, send_buffer_size);
+        calculate_crc(header, buffers);
     }
 }
 
@@ -487,6 +565,16 @@ bool TCPTransportInterface::init(
             };
     io_service_thread_ = create_thread(ioServiceFunction, configuration()->accept_thread, "dds.tcp_accept");
 
+    // Reads on the channels are handled by io_service_, so its handlers are spread over these threads too
+    if (0 < configuration()->reactor_threads && !configuration()->apply_security)
+    {
+        for (uint32_t i = 0; i < configuration()->reactor_threads; ++i)
+        {
+            reactor_threads_.push_back(create_thread(ioServiceFunction, configuration()->reactor_thread,
+                    "dds.tcp_rx.%u", i));
+        }
+    }
+
     if (0 < configuration()->keep_alive_frequency_ms)
     {
         auto ioServiceTimersFunction = [&]()
@@ -655,6 +743,195 @@ bool TCPTransportInterface::CloseInputChannel(
     return bClosed;
 }
 
+std::shared_ptr<TCPChannelResource> TCPTransportInterface::create_output_channel(
+        const Locator& physical_locator)
+{
+    return std::shared_ptr<TCPChannelResource>(
+#if TLS_FOUND
+        (configuration()->apply_security) ?
+        static_cast<TCPChannelResource*>(
+            new TCPChannelResourceSecure(this, io_service_, ssl_context_,
+            physical_locator, configuration()->maxMessageSize)) :
+#endif // if TLS_FOUND
+        static_cast<TCPChannelResource*>(
+            new TCPChannelResourceBasic(this, io_service_, physical_locator,
+            configuration()->maxMessageSize))
+        );
+}
+
+bool TCPTransportInterface::is_stream(
+        const Locator& physical_locator,
+        const std::shared_ptr<TCPChannelResource>& channel) const
+{
+    std::lock_guard<std::mutex> scopedLock(sockets_map_mutex_);
+    auto streams = stream_channel_resources_.find(physical_locator);
+    return streams != stream_channel_resources_.end() &&
+           std::find(streams->second.begin(), streams->second.end(), channel) != streams->second.end();
+}
+
+/**
+ * Entity id of the user writer sending an RTPS message, taken from its first DATA, DATA_FRAG, GAP, HEARTBEAT or
+ * HEARTBEAT_FRAG submessage, and whether the message carries DATA or DATA_FRAG submessages.
+ * Returns false for messages of readers and builtin writers, and for those without any of these submessages.
+ */
+static bool user_writer_id(
+        const octet* buffer,
+        uint32_t size,
+        uint32_t& writer_id,
+        bool& has_data,
+        bool& has_fragments)
+{
+    constexpr uint32_t rtps_header_size = 20;
+    constexpr uint32_t submessage_header_size = 4;
+    constexpr octet builtin_entity_kind = 0xC0;
+
+    bool found = false;
+    has_data = false;
+    has_fragments = false;
+
+    uint32_t pos = rtps_header_size;
+    while (pos + submessage_header_size <= size)
+    {
+        octet id = buffer[pos];
+        bool little_endian = 0 != (buffer[pos + 1] & 0x01);
+        uint16_t length = little_endian ?
+                static_cast<uint16_t>(buffer[pos + 2] | (buffer[pos + 3] << 8)) :
+                static_cast<uint16_t>((buffer[pos + 2] << 8) | buffer[pos + 3]);
+
+        // DATA and DATA_FRAG have extraFlags and octetsToInlineQos before the readerId
+        uint32_t writer_id_offset = 0;
+        switch (id)
+        {
+            case fastrtps::rtps::DATA:
+                has_data = true;
+                writer_id_offset = submessage_header_size + 8;
+                break;
+            case fastrtps::rtps::DATA_FRAG:
+                has_fragments = true;
+                writer_id_offset = submessage_header_size + 8;
+                break;
+            case fastrtps::rtps::GAP:
+            case fastrtps::rtps::HEARTBEAT:
+            case fastrtps::rtps::HEARTBEAT_FRAG:
+                writer_id_offset = submessage_header_size + 4;
+                break;
+            case fastrtps::rtps::ACKNACK:
+            case fastrtps::rtps::NACK_FRAG:
+                return false;
+            default:
+                break;
+        }
+
+        if (0 != writer_id_offset && !found)
+        {
+            if (pos + writer_id_offset + sizeof(uint32_t) > size)
+            {
+                return false;
+            }
+
+            // The entity kind is the last octet of the entity id
+            const octet* entity_id = &buffer[pos + writer_id_offset];
+            if (builtin_entity_kind == (entity_id[3] & builtin_entity_kind))
+            {
+                return false;
+            }
+            memcpy(&writer_id, entity_id, sizeof(writer_id));
+            found = true;
+        }
+
+        if (0 == length)
+        {
+            break;
+        }
+        pos += submessage_header_size + length;
+    }
+
+    return found;
+}
+
+std::shared_ptr<TCPChannelResource> TCPTransportInterface::select_stream(
+        const std::shared_ptr<TCPChannelResource>& channel,
+        uint16_t logical_port,
+        const octet* send_buffer,
+        uint32_t send_buffer_size,
+        uint32_t message_size)
+{
+    uint32_t writer_id = 0;
+    bool has_data = false;
+    bool has_fragments = false;
+    if (!user_writer_id(send_buffer, send_buffer_size, writer_id, has_data, has_fragments))
+    {
+        return nullptr;
+    }
+
+    const std::pair<uint32_t, uint16_t> writer_key(writer_id, logical_port);
+    std::shared_ptr<TCPChannelResource> stream;
+    {
+        std::lock_guard<std::mutex> scopedLock(sockets_map_mutex_);
+        auto streams = stream_channel_resources_.find(channel->locator());
+        if (streams == stream_channel_resources_.end() || streams->second.empty())
+        {
+            return nullptr;
+        }
+
+        auto& writers = writer_stream_channel_resources_[channel->locator()];
+        auto writer = writers.find(writer_key);
+        if (writer != writers.end())
+        {
+            return writer->second;
+        }
+
+        // The traffic class of a writer is unknown until it sends its first sample
+        if (!has_data && !has_fragments)
+        {
+            return nullptr;
+        }
+
+        // Writers of small samples share the main connection with discovery traffic. Writers of big samples are
+        // spread over the additional connections, each one going to the connection with less of them.
+        if (has_fragments || message_size >= stream_bulk_message_size)
+        {
+            size_t stream_writers = (std::numeric_limits<size_t>::max)();
+            for (const std::shared_ptr<TCPChannelResource>& candidate : streams->second)
+            {
+                size_t candidate_writers = 0;
+                for (const auto& entry : writers)
+                {
+                    candidate_writers += entry.second == candidate ? 1 : 0;
+                }
+                if (candidate_writers < stream_writers)
+                {
+                    stream_writers = candidate_writers;
+                    stream = candidate;
+                }
+            }
+        }
+
+        writers.emplace(writer_key, stream);
+    }
+
+    // The connection of a writer is chosen on its first sample and never changes, so all its messages keep their
+    // order. While that connection is not ready, the messages of the writer are dropped by send.
+    if (stream)
+    {
+        if (stream->connection_established())
+        {
+            if (!stream->is_logical_port_added(logical_port))
+            {
+                stream->add_logical_port(logical_port, rtcp_message_manager_.get());
+            }
+        }
+        else if (TCPChannelResource::TCPConnectionType::TCP_CONNECT_TYPE == stream->tcp_connection_type() &&
+                TCPChannelResource::eConnectionStatus::eDisconnected == stream->connection_status())
+        {
+            stream->set_all_ports_pending();
+            stream->connect(stream);
+        }
+    }
+
+    return stream;
+}
+
 void TCPTransportInterface::close_tcp_socket(
         std::shared_ptr<TCPChannelResource>& channel)
 {
@@ -695,7 +972,8 @@ bool TCPTransportInterface::OpenOutputChannel(
                 // If the channel exists, check if the channel reference in the sender resource needs to be updated with
                 // the found channel
                 if (existing_channel != channel_resources_.end() &&
-                        existing_channel->second != tcp_sender_resource->channel())
+                        existing_channel->second != tcp_sender_resource->channel() &&
+                        !is_stream(physical_locator, tcp_sender_resource->channel()))
                 {
                     // Disconnect the old channel
                     tcp_sender_resource->channel()->disconnect();
@@ -751,20 +1029,18 @@ bool TCPTransportInterface::OpenOutputChannel(
                     << IPLocator::getPhysicalPort(locator) << "; logical: "
                     << IPLocator::getLogicalPort(locator) << ") @ " << IPLocator::to_string(locator));
 
-            channel.reset(
-#if TLS_FOUND
-                (configuration()->apply_security) ?
-                static_cast<TCPChannelResource*>(
-                    new TCPChannelResourceSecure(this, io_service_, ssl_context_,
-                    physical_locator, configuration()->maxMessageSize)) :
-#endif // if TLS_FOUND
-                static_cast<TCPChannelResource*>(
-                    new TCPChannelResourceBasic(this, io_service_, physical_locator,
-                    configuration()->maxMessageSize))
-                );
-
+            channel = create_output_channel(physical_locator);
             channel_resources_[physical_locator] = channel;
             channel->connect(channel_resources_[physical_locator]);
+
+            // Additional connections only carry data, so they are opened with the logical port already pending
+            std::vector<std::shared_ptr<TCPChannelResource>>& streams = stream_channel_resources_[physical_locator];
+            for (uint16_t i = 1; i < configuration()->connection_streams; ++i)
+            {
+                streams.push_back(create_output_channel(physical_locator));
+                streams.back()->add_logical_port(logical_port, rtcp_message_manager_.get());
+                streams.back()->connect(streams.back());
+            }
         }
 
         statistics_info_.add_entry(locator);
@@ -866,6 +1142,16 @@ void TCPTransportInterface::create_listening_thread(
 {
     std::weak_ptr<TCPChannelResource> channel_weak_ptr = channel;
     std::weak_ptr<RTCPMessageManager> rtcp_manager_weak_ptr = rtcp_message_manager_;
+
+    if (!reactor_threads_.empty())
+    {
+        io_service_.post([this, channel_weak_ptr, rtcp_manager_weak_ptr]()
+                {
+                    perform_reactor_listen_operation(channel_weak_ptr, rtcp_manager_weak_ptr);
+                });
+        return;
+    }
+
     auto fn = [this, channel_weak_ptr, rtcp_manager_weak_ptr]()
             {
                 perform_listen_operation(channel_weak_ptr, rtcp_manager_weak_ptr);
@@ -880,7 +1166,41 @@ void TCPTransportInterface::perform_listen_operation(
         std::weak_ptr<RTCPMessageManager> rtcp_manager)
 {
     Locator remote_locator;
-    uint16_t logicalPort(0);
+    std::shared_ptr<TCPChannelResource> channel = start_listen_operation(channel_weak, rtcp_manager, remote_locator);
+    if (!channel)
+    {
+        return;
+    }
+
+    while (TCPChannelResource::eConnectionStatus::eConnecting < channel->connection_status())
+    {
+        // Blocking receive.
+        receive_and_dispatch(rtcp_manager, channel, remote_locator);
+    }
+
+    EPROSIMA_LOG_INFO(RTCP, "End PerformListenOperation " << channel->locator());
+}
+
+void TCPTransportInterface::perform_reactor_listen_operation(
+        std::weak_ptr<TCPChannelResource> channel_weak,
+        std::weak_ptr<RTCPMessageManager> rtcp_manager)
+{
+    std::shared_ptr<ReactorReadState> state = std::make_shared<ReactorReadState>();
+    state->channel = start_listen_operation(channel_weak, rtcp_manager, state->remote_locator);
+    if (state->channel)
+    {
+        // The reactor is only used when TLS is disabled, so all the channels are basic ones
+        state->socket = std::static_pointer_cast<TCPChannelResourceBasic>(state->channel)->socket();
+        state->rtcp_manager = rtcp_manager;
+        reactor_read_header(state, 0, 4);
+    }
+}
+
+std::shared_ptr<TCPChannelResource> TCPTransportInterface::start_listen_operation(
+        std::weak_ptr<TCPChannelResource> channel_weak,
+        std::weak_ptr<RTCPMessageManager> rtcp_manager,
+        Locator& remote_locator)
+{
     std::shared_ptr<RTCPMessageManager> rtcp_message_manager;
     std::shared_ptr<TCPChannelResource> channel;
     rtcp_message_manager = rtcp_manager.lock();
@@ -889,12 +1209,16 @@ void TCPTransportInterface::perform_listen_operation(
     if (rtcp_message_manager)
     {
         channel = channel_weak.lock();
-        endpoint_to_locator(channel->remote_endpoint(), remote_locator);
 
         if (channel)
         {
-            uint32_t port = channel->local_endpoint().port();
-            set_name_to_current_thread("dds.tcp.%u", port);
+            endpoint_to_locator(channel->remote_endpoint(), remote_locator);
+
+            if (reactor_threads_.empty())
+            {
+                uint32_t port = channel->local_endpoint().port();
+                set_name_to_current_thread("dds.tcp.%u", port);
+            }
 
             if (channel->tcp_connection_type() == TCPChannelResource::TCPConnectionType::TCP_CONNECT_TYPE)
             {
@@ -910,48 +1234,184 @@ void TCPTransportInterface::perform_listen_operation(
         rtcp_message_manager.reset();
         rtcp_message_manager_cv_.notify_one();
     }
+
+    return channel;
+}
+
+void TCPTransportInterface::receive_and_dispatch(
+        std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+        std::shared_ptr<TCPChannelResource>& channel,
+        Locator& remote_locator)
+{
+    CDRMessage_t& msg = channel->message_buffer();
+    fastrtps::rtps::CDRMessage::initCDRMsg(&msg);
+    if (!Receive(rtcp_manager, channel, msg.buffer, msg.max_size, msg.length, msg.msg_endian, remote_locator))
+    {
+        return;
+    }
+
+    if (TCPChannelResource::eConnectionStatus::eConnecting < channel->connection_status())
+    {
+        dispatch_message(channel, msg, remote_locator);
+    }
+}
+
+void TCPTransportInterface::dispatch_message(
+        std::shared_ptr<TCPChannelResource>& channel,
+        CDRMessage_t& msg,
+        const Locator& remote_locator)
+{
+    // Processes the data through the CDR Message interface.
+    uint16_t logicalPort = IPLocator::getLogicalPort(remote_locator);
+    std::unique_lock<std::mutex> scopedLock(sockets_map_mutex_);
+    auto it = receiver_resources_.find(logicalPort);
+    //TransportReceiverInterface* receiver = channel->GetMessageReceiver(logicalPort);
+    if (it != receiver_resources_.end())
+    {
+        TransportReceiverInterface* receiver = it->second.first;
+        ReceiverInUseCV* receiver_in_use = it->second.second;
+        receiver_in_use->in_use = true;
+        scopedLock.unlock();
+        receiver->OnDataReceived(msg.buffer, msg.length, channel->locator(), remote_locator);
+        scopedLock.lock();
+        receiver_in_use->in_use = false;
+        receiver_in_use->cv.notify_one();
+    }
     else
     {
+        EPROSIMA_LOG_WARNING(RTCP,
+                "Received Message, but no TransportReceiverInterface attached: " << logicalPort);
+    }
+}
+
+void TCPTransportInterface::reactor_read_header(
+        const std::shared_ptr<ReactorReadState>& state,
+        size_t read_pos,
+        size_t bytes_needed)
+{
+    if (TCPChannelResource::eConnectionStatus::eConnecting >= state->channel->connection_status())
+    {
+        EPROSIMA_LOG_INFO(RTCP, "End PerformListenOperation " << state->channel->locator());
         return;
     }
 
-    while (channel && TCPChannelResource::eConnectionStatus::eConnecting < channel->connection_status())
+    octet* header = state->tcp_header.address();
+    if (0 == read_pos)
     {
-        // Blocking receive.
-        CDRMessage_t& msg = channel->message_buffer();
-        fastrtps::rtps::CDRMessage::initCDRMsg(&msg);
-        if (!Receive(rtcp_manager, channel, msg.buffer, msg.max_size, msg.length, msg.msg_endian, remote_locator))
-        {
-            continue;
-        }
+        memset(header, 0, sizeof(TCPHeader));
+    }
 
-        if (TCPChannelResource::eConnectionStatus::eConnecting < channel->connection_status())
-        {
-            // Processes the data through the CDR Message interface.
-            logicalPort = IPLocator::getLogicalPort(remote_locator);
-            std::unique_lock<std::mutex> scopedLock(sockets_map_mutex_);
-            auto it = receiver_resources_.find(logicalPort);
-            //TransportReceiverInterface* receiver = channel->GetMessageReceiver(logicalPort);
-            if (it != receiver_resources_.end())
-            {
-                TransportReceiverInterface* receiver = it->second.first;
-                ReceiverInUseCV* receiver_in_use = it->second.second;
-                receiver_in_use->in_use = true;
-                scopedLock.unlock();
-                receiver->OnDataReceived(msg.buffer, msg.length, channel->locator(), remote_locator);
-                scopedLock.lock();
-                receiver_in_use->in_use = false;
-                receiver_in_use->cv.notify_one();
-            }
-            else
+    asio::async_read(*state->socket, asio::buffer(&header[read_pos], bytes_needed),
+            [this, state, read_pos, bytes_needed](const asio::error_code& ec, std::size_t)
             {
-                EPROSIMA_LOG_WARNING(RTCP,
-                        "Received Message, but no TransportReceiverInterface attached: " << logicalPort);
-            }
+                if (!reactor_read_succeeded(state, ec))
+                {
+                    return;
+                }
+
+                if (TCPHeader::size() == read_pos + bytes_needed)
+                {
+                    reactor_read_body(state);
+                    return;
+                }
+
+                // Wait for sync
+                octet* header = state->tcp_header.address();
+                size_t skip = rtcp_sync_skip(state->tcp_header);
+                if (0 < skip)
+                {
+                    memmove(header, &header[skip], 4 - skip);
+                    reactor_read_header(state, 4 - skip, skip);
+                }
+                else
+                {
+                    reactor_read_header(state, 4, TCPHeader::size() - 4);
+                }
+            });
+}
+
+void TCPTransportInterface::reactor_read_body(
+        const std::shared_ptr<ReactorReadState>& state)
+{
+    CDRMessage_t& msg = state->channel->message_buffer();
+    fastrtps::rtps::CDRMessage::initCDRMsg(&msg);
+    state->tcp_header.valid_endianness(msg.msg_endian);
+
+    size_t body_size = state->tcp_header.length - static_cast<uint32_t>(TCPHeader::size());
+    if (body_size > msg.max_size)
+    {
+        EPROSIMA_LOG_ERROR(RTCP_MSG_IN, "Size of incoming TCP message is bigger than buffer capacity: "
+                << static_cast<uint32_t>(body_size) << " vs. " << msg.max_size << ". "
+                << "The full message will be dropped.");
+        reactor_discard_body(state, body_size);
+        return;
+    }
+
+    EPROSIMA_LOG_INFO(RTCP_MSG_IN, "Received RTCP MSG. Logical Port " << state->tcp_header.logical_port);
+    asio::async_read(*state->socket, asio::buffer(msg.buffer, body_size),
+            [this, state](const asio::error_code& ec, std::size_t bytes_read)
+            {
+                if (!reactor_read_succeeded(state, ec))
+                {
+                    return;
+                }
+
+                CDRMessage_t& msg = state->channel->message_buffer();
+                msg.length = static_cast<uint32_t>(bytes_read);
+                if (0 < msg.length &&
+                        process_received_body(state->rtcp_manager, state->channel, state->tcp_header, msg.buffer,
+                        msg.length, msg.msg_endian, state->remote_locator) &&
+                        TCPChannelResource::eConnectionStatus::eConnecting < state->channel->connection_status())
+                {
+                    dispatch_message(state->channel, msg, state->remote_locator);
+                }
+
+                reactor_read_header(state, 0, 4);
+            });
+}
+
+void TCPTransportInterface::reactor_discard_body(
+        const std::shared_ptr<ReactorReadState>& state,
+        size_t bytes_left)
+{
+    if (0 == bytes_left)
+    {
+        reactor_read_header(state, 0, 4);
+        return;
+    }
+
+    CDRMessage_t& msg = state->channel->message_buffer();
+    size_t read_block = (std::min)(bytes_left, static_cast<size_t>(msg.max_size));
+    asio::async_read(*state->socket, asio::buffer(msg.buffer, read_block),
+            [this, state, bytes_left, read_block](const asio::error_code& ec, std::size_t)
+            {
+                if (reactor_read_succeeded(state, ec))
+                {
+                    reactor_discard_body(state, bytes_left - read_block);
+                }
+            });
+}
+
+bool TCPTransportInterface::reactor_read_succeeded(
+        const std::shared_ptr<ReactorReadState>& state,
+        const asio::error_code& ec)
+{
+    if (asio::error::operation_aborted == ec)
+    {
+        return false;
+    }
+
+    if (ec)
+    {
+        if (asio::error::eof != ec)
+        {
+            EPROSIMA_LOG_WARNING(RTCP, "Error reading from TCP channel: " << ec.message());
         }
+        close_tcp_socket(state->channel);
+        return false;
     }
 
-    EPROSIMA_LOG_INFO(RTCP, "End PerformListenOperation " << channel->locator());
+    return TCPChannelResource::eConnectionStatus::eConnecting < state->channel->connection_status();
 }
 
 bool TCPTransportInterface::read_body(
@@ -1002,11 +1462,7 @@ bool receive_header(
             bytes_needed -= bytes_read;
             if (0 == bytes_needed)
             {
-                size_t skip =                                 // Text   Next possible match   Skip to next match
-                        (tcp_header.rtcp[0] != 'R') ? 1 :     // X---   XRTCP                 1
-                        (tcp_header.rtcp[1] != 'T') ? 1 :     // RX--   RRTCP                 1
-                        (tcp_header.rtcp[2] != 'C') ? 2 :     // RTX-   RTRTCP                2
-                        (tcp_header.rtcp[3] != 'P') ? 3 : 0;  // RTCX   RTCRTCP               3
+                size_t skip = rtcp_sync_skip(tcp_header);
 
                 if (skip)
                 {
@@ -1126,54 +1582,8 @@ bool TCPTransportInterface::Receive(
                 success = read_body(receive_buffer, receive_buffer_capacity, &receive_buffer_size,
                                 channel, body_size);
 
-                if (success)
-                {
-                    if (configuration()->check_crc
-                            && !check_crc(tcp_header, receive_buffer, receive_buffer_size))
-                    {
-                        EPROSIMA_LOG_WARNING(RTCP_MSG_IN, "Bad TCP header CRC");
-                    }
-
-                    if (tcp_header.logical_port == 0)
-                    {
-                        std::shared_ptr<RTCPMessageManager> rtcp_message_manager;
-                        if (TCPChannelResource::eConnectionStatus::eDisconnected != channel->connection_status())
-
-                        {
-                            std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
-                            rtcp_message_manager = rtcp_manager.lock();
-                        }
-
-                        if (rtcp_message_manager)
-                        {
-                            // The channel is not going to be deleted because we lock it for reading.
-                            ResponseCode responseCode = rtcp_message_manager->processRTCPMessage(
-                                channel, receive_buffer, body_size, msg_endian);
-
-                            if (responseCode != RETCODE_OK)
-                            {
-                                close_tcp_socket(channel);
-                            }
-                            success = false;
-
-                            std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
-                            rtcp_message_manager.reset();
-                            rtcp_message_manager_cv_.notify_one();
-                        }
-                        else
-                        {
-                            success = false;
-                            close_tcp_socket(channel);
-                        }
-
-                    }
-                    else
-                    {
-                        IPLocator::setLogicalPort(remote_locator, tcp_header.logical_port);
-                        EPROSIMA_LOG_INFO(RTCP_MSG_IN, "[RECEIVE] From: " << remote_locator \
-                                                                          << " - " << receive_buffer_size << " bytes.");
-                    }
-                }
+                success = success && process_received_body(rtcp_manager, channel, tcp_header, receive_buffer,
+                                receive_buffer_size, msg_endian, remote_locator);
                 // Error message already shown by read_body method.
             }
         }
@@ -1204,6 +1614,59 @@ bool TCPTransportInterface::Receive(
     return success;
 }
 
+bool TCPTransportInterface::process_received_body(
+        std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+        std::shared_ptr<TCPChannelResource>& channel,
+        const TCPHeader& tcp_header,
+        octet* receive_buffer,
+        uint32_t receive_buffer_size,
+        fastrtps::rtps::Endianness_t msg_endian,
+        Locator& remote_locator)
+{
+    if (configuration()->check_crc
+            && !check_crc(tcp_header, receive_buffer, receive_buffer_size))
+    {
+        EPROSIMA_LOG_WARNING(RTCP_MSG_IN, "Bad TCP header CRC");
+    }
+
+    if (tcp_header.logical_port == 0)
+    {
+        std::shared_ptr<RTCPMessageManager> rtcp_message_manager;
+        if (TCPChannelResource::eConnectionStatus::eDisconnected != channel->connection_status())
+        {
+            std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
+            rtcp_message_manager = rtcp_manager.lock();
+        }
+
+        if (rtcp_message_manager)
+        {
+            // The channel is not going to be deleted because we lock it for reading.
+            ResponseCode responseCode = rtcp_message_manager->processRTCPMessage(
+                channel, receive_buffer, receive_buffer_size, msg_endian);
+
+            if (responseCode != RETCODE_OK)
+            {
+                close_tcp_socket(channel);
+            }
+
+            std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
+            rtcp_message_manager.reset();
+            rtcp_message_manager_cv_.notify_one();
+        }
+        else
+        {
+            close_tcp_socket(channel);
+        }
+
+        return false;
+    }
+
+    IPLocator::setLogicalPort(remote_locator, tcp_header.logical_port);
+    EPROSIMA_LOG_INFO(RTCP_MSG_IN, "[RECEIVE] From: " << remote_locator \
+                                                      << " - " << receive_buffer_size << " bytes.");
+    return true;
+}
+
 bool TCPTransportInterface::send(
         const octet* send_buffer,
         uint32_t send_buffer_size,
@@ -1213,13 +1676,42 @@ bool TCPTransportInterface::send(
 {
     fastrtps::rtps::LocatorsIterator& it = *destination_locators_begin;
 
+    bool ret = true;
+    std::vector<NetworkBuffer> buffers;
+
+    while (it != *destination_locators_end)
+    {
+        if (IsLocatorSupported(*it))
+        {
+            if (buffers.empty())
+            {
+                buffers.emplace_back(send_buffer, send_buffer_size);
+            }
+            ret &= send(buffers, send_buffer_size, channel, *it);
+        }
+
+        ++it;
+    }
+
+    return ret;
+}
+
+bool TCPTransportInterface::send(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        std::shared_ptr<TCPChannelResource>& channel,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end)
+{
+    fastrtps::rtps::LocatorsIterator& it = *destination_locators_begin;
+
     bool ret = true;
 
     while (it != *destination_locators_end)
     {
         if (IsLocatorSupported(*it))
         {
-            ret &= send(send_buffer, send_buffer_size, channel, *it);
+            ret &= send(buffers, total_bytes, channel, *it);
         }
 
         ++it;
@@ -1229,8 +1721,8 @@ bool TCPTransportInterface::send(
 }
 
 bool TCPTransportInterface::send(
-        const octet* send_buffer,
-        uint32_t send_buffer_size,
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
         std::shared_ptr<TCPChannelResource>& channel,
         const Locator& remote_locator)
 {
@@ -1257,7 +1749,7 @@ bool TCPTransportInterface::send(
         }
     }
 
-    if (locator_mismatch || send_buffer_size > configuration()->sendBufferSize)
+    if (locator_mismatch || total_bytes > configuration()->sendBufferSize || buffers.empty())
     {
         //std::cout << "ChannelLocator: " << IPLocator::to_string(channel->locator()) << std::endl;
         //std::cout << "RemoteLocator: " << IPLocator::to_string(remote_locator) << std::endl;
@@ -1283,27 +1775,62 @@ bool TCPTransportInterface::send(
     {
         uint16_t logical_port = IPLocator::getLogicalPort(remote_locator);
 
+        // Messages of user writers go through the connection chosen for the writer
+        TCPChannelResource* target = channel.get();
+        std::shared_ptr<TCPChannelResource> stream;
+        if (1 < configuration()->connection_streams)
+        {
+            // The first slice holds the headers of the first submessages
+            stream = select_stream(channel, logical_port, buffers.front().buffer, buffers.front().size,
+                            total_bytes);
+        }
+
+        if (stream)
+        {
+            if (stream->connection_established() && stream->is_logical_port_opened(logical_port))
+            {
+                target = stream.get();
+            }
+            else
+            {
+                if (TCPChannelResource::TCPConnectionType::TCP_CONNECT_TYPE == stream->tcp_connection_type() &&
+                        TCPChannelResource::eConnectionStatus::eDisconnected == stream->connection_status())
+                {
+                    stream->set_all_ports_pending();
+                    stream->connect(stream);
+                }
+
+                // Sending through another connection would reorder the messages of the writer, so the message is
+                // dropped until its connection is ready again. Reliable writers send it again when asked to.
+                EPROSIMA_LOG_INFO(RTCP, "Connection of the writer to " << IPLocator::to_string(remote_locator)
+                                                                       << " not ready. Message dropped.");
+                return false;
+            }
+        }
+
         if (channel->is_logical_port_added(logical_port))
         {
             if (channel->is_logical_port_opened(logical_port))
             {
                 TCPHeader tcp_header;
-                statistics_info_.set_statistics_message_data(remote_locator, send_buffer, send_buffer_size);
-                fill_rtcp_header(tcp_header, send_buffer, send_buffer_size, logical_port);
+                statistics_info_.set_statistics_message_data(remote_locator, buffers, total_bytes);
+                fill_rtcp_header(tcp_header, buffers, total_bytes, logical_port);
+
+                NetworkBufferSequence asio_buffers(buffers);
 
                 {
                     asio::error_code ec;
-                    size_t sent = channel->send(
+                    size_t sent = target->send(
                         (octet*)&tcp_header,
                         static_cast<uint32_t>(TCPHeader::size()),
-                        send_buffer,
-                        send_buffer_size,
+                        asio_buffers,
+                        total_bytes,
                         ec);
 
-                    if (sent != static_cast<uint32_t>(TCPHeader::size() + send_buffer_size) || ec)
+                    if (sent != static_cast<uint32_t>(TCPHeader::size() + total_bytes) || ec)
                     {
                         EPROSIMA_LOG_WARNING(DEBUG, "Failed to send RTCP message (" << sent << " of " <<
-                                TCPHeader::size() + send_buffer_size << " b): " << ec.message());
+                                TCPHeader::size() + total_bytes << " b): " << ec.message());
                         success = false;
                     }
                     else
@@ -23,6 +23,7 @@
 #include <asio.hpp>
 #include <asio/steady_timer.hpp>
 
+#include <fastdds/rtps/transport/NetworkBuffer.hpp>
 #include <fastdds/rtps/transport/TCPTransportDescriptor.h>
 #include <fastdds/rtps/transport/TransportInterface.h>
 #include <fastrtps/utils/IPFinder.h>
@@ -87,6 +88,8 @@ protected:
 #endif // if TLS_FOUND
     eprosima::thread io_service_thread_;
     eprosima::thread io_service_timers_thread_;
+    //! Threads reading from the channels along with io_service_thread_ when reactor_threads is set
+    std::vector<eprosima::thread> reactor_threads_;
     std::shared_ptr<RTCPMessageManager> rtcp_message_manager_;
     std::mutex rtcp_message_manager_mutex_;
     std::condition_variable rtcp_message_manager_cv_;
@@ -95,6 +98,11 @@ protected:
 
     std::map<Locator, std::shared_ptr<TCPChannelResource>> channel_resources_; // The key is the "Physical locator"
     std::vector<std::shared_ptr<TCPChannelResource>> unbound_channel_resources_;
+    // Additional connections to the same remote locator as the one on channel_resources_
+    std::map<Locator, std::vector<std::shared_ptr<TCPChannelResource>>> stream_channel_resources_;
+    // Connection chosen for each user writer and logical port on the additional connections, nullptr for the main one
+    std::map<Locator, std::map<std::pair<uint32_t, uint16_t>, std::shared_ptr<TCPChannelResource>>>
+    writer_stream_channel_resources_;
     // The key is the logical port
     std::map<uint16_t, std::pair<TransportReceiverInterface*, ReceiverInUseCV*>> receiver_resources_;
 
@@ -128,13 +136,12 @@ protected:
 
     void calculate_crc(
             TCPHeader& header,
-            const fastrtps::rtps::octet* data,
-            uint32_t size) const;
+            const std::vector<NetworkBuffer>& buffers) const;
 
     void fill_rtcp_header(
             TCPHeader& header,
-            const fastrtps::rtps::octet* send_buffer,
-            uint32_t send_buffer_size,
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
             uint16_t logical_port) const;
 
     //! Closes the given p_channel_resource and unbind it from every resource.
@@ -157,6 +164,71 @@ protected:
             std::weak_ptr<TCPChannelResource> channel,
             std::weak_ptr<RTCPMessageManager> rtcp_manager);
 
+    /**
+     * Starts reading from a channel on the reactor threads, which read with asynchronous operations instead of
+     * blocking on it.
+     */
+    void perform_reactor_listen_operation(
+            std::weak_ptr<TCPChannelResource> channel,
+            std::weak_ptr<RTCPMessageManager> rtcp_manager);
+
+    /**
+     * Performs the RTCP connection steps preceding the reception on a channel.
+     * @param [out] remote_locator Locator of the remote endpoint of the channel.
+     * @return The channel, or nullptr if it should not be read.
+     */
+    std::shared_ptr<TCPChannelResource> start_listen_operation(
+            std::weak_ptr<TCPChannelResource> channel_weak,
+            std::weak_ptr<RTCPMessageManager> rtcp_manager,
+            Locator& remote_locator);
+
+    //! Blocking receive of a message from a channel, delivering it to the receiver of its logical port.
+    void receive_and_dispatch(
+            std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+            std::shared_ptr<TCPChannelResource>& channel,
+            Locator& remote_locator);
+
+    //! Delivers a received message to the receiver of the logical port of remote_locator.
+    void dispatch_message(
+            std::shared_ptr<TCPChannelResource>& channel,
+            fastrtps::rtps::CDRMessage_t& msg,
+            const Locator& remote_locator);
+
+    //! State of the asynchronous reads performed by the reactor threads on a channel.
+    struct ReactorReadState
+    {
+        std::shared_ptr<TCPChannelResource> channel;
+        std::shared_ptr<asio::ip::tcp::socket> socket;
+        std::weak_ptr<RTCPMessageManager> rtcp_manager;
+        Locator remote_locator;
+        TCPHeader tcp_header;
+    };
+
+    /**
+     * Reads on the reactor the next bytes of the header of a message.
+     * While the first bytes do not match the RTCP synchronization word, they are read again one by one.
+     * @param read_pos Position on the header where the bytes are written.
+     * @param bytes_needed Number of bytes to read.
+     */
+    void reactor_read_header(
+            const std::shared_ptr<ReactorReadState>& state,
+            size_t read_pos,
+            size_t bytes_needed);
+
+    //! Reads on the reactor the body of the message whose header has been read.
+    void reactor_read_body(
+            const std::shared_ptr<ReactorReadState>& state);
+
+    //! Reads on the reactor the remaining bytes of a message not fitting on the reception buffer.
+    void reactor_discard_body(
+            const std::shared_ptr<ReactorReadState>& state,
+            size_t bytes_left);
+
+    //! Checks the result of a read on the reactor, closing the channel on errors.
+    bool reactor_read_succeeded(
+            const std::shared_ptr<ReactorReadState>& state,
+            const asio::error_code& ec);
+
     bool read_body(
             fastrtps::rtps::octet* receive_buffer,
             uint32_t receive_buffer_capacity,
@@ -164,6 +236,20 @@ protected:
             std::shared_ptr<TCPChannelResource>& channel,
             std::size_t body_size);
 
+    /**
+     * Handles a message whose body has been completely read.
+     * Control messages are processed right away, and the logical port of other messages is set on remote_locator.
+     * @return true when the message has to be delivered to the receiver of its logical port.
+     */
+    bool process_received_body(
+            std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+            std::shared_ptr<TCPChannelResource>& channel,
+            const TCPHeader& tcp_header,
+            fastrtps::rtps::octet* receive_buffer,
+            uint32_t receive_buffer_size,
+            fastrtps::rtps::Endianness_t msg_endian,
+            Locator& remote_locator);
+
     virtual void set_receive_buffer_size(
             uint32_t size) = 0;
     virtual void set_send_buffer_size(
@@ -193,17 +279,47 @@ protected:
     std::string get_password() const;
 
     /**
-     * Send a buffer to a destination
+     * Send a message, given as a list of slices, to a destination
      */
     bool send(
-            const fastrtps::rtps::octet* send_buffer,
-            uint32_t send_buffer_size,
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
             std::shared_ptr<TCPChannelResource>& channel,
             const Locator& remote_locator);
 
     void create_listening_thread(
             const std::shared_ptr<TCPChannelResource>& channel);
 
+    //! Creates a channel connecting to the given physical locator.
+    std::shared_ptr<TCPChannelResource> create_output_channel(
+            const Locator& physical_locator);
+
+    //! Whether the channel is an additional connection to the given physical locator.
+    bool is_stream(
+            const Locator& physical_locator,
+            const std::shared_ptr<TCPChannelResource>& channel) const;
+
+    /**
+     * Selects the additional connection a message is sent through, based on its writer.
+     * All the messages of a user writer to a logical port go through the same connection, chosen on its first
+     * sample: writers of fragmented samples or of messages of at least stream_bulk_message_size bytes get the
+     * additional connection with less writers, and the rest stay on the main connection. Messages of readers,
+     * builtin writers and writers that have not sent any sample yet go through the main connection.
+     * @param send_buffer First slice of the message, holding the headers of its first submessages.
+     * @param send_buffer_size Size of the first slice.
+     * @param message_size Size of the whole message.
+     * @return The connection, or nullptr when the message goes through the main connection.
+     */
+    std::shared_ptr<TCPChannelResource> select_stream(
+            const std::shared_ptr<TCPChannelResource>& channel,
+            uint16_t logical_port,
+            const fastrtps::rtps::octet* send_buffer,
+            uint32_t send_buffer_size,
+            uint32_t message_size);
+
+    //! Size from which the messages of a writer make it use an additional connection
+    static constexpr uint32_t stream_bulk_message_size = 8192;
+
 public:
 
     friend class RTCPMessageManager;
@@ -354,6 +470,24 @@ public:
             fastrtps::rtps::LocatorsIterator* destination_locators_begin,
             fastrtps::rtps::LocatorsIterator* destination_locators_end);
 
+    /**
+     * Blocking Send of a message, given as a list of slices, through the specified channel.
+     * The slices are written to the socket without being copied into a single buffer first.
+     * @param buffers Slices of the message to send.
+     * @param total_bytes Size of the message. Sum of the sizes of the slices.
+     * @param channel channel we're sending from.
+     * @param destination_locators_begin pointer to destination locators iterator begin, the iterator can be advanced inside this fuction
+     * so should not be reuse.
+     * @param destination_locators_end pointer to destination locators iterator end, the iterator can be advanced inside this fuction
+     * so should not be reuse.
+     */
+    bool send(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            std::shared_ptr<TCPChannelResource>& channel,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end);
+
     /**
      * Performs the locator selection algorithm for this transport.
      *
@@ -14,6 +14,20 @@
 
 #include <rtps/transport/UDPChannelResource.h>
 
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/socket.h>
+#include <time.h>
+#endif // if defined(__linux__)
+
+#if defined(FASTDDS_UDP_RECEIVE_TIMESTAMPS)
+#include <linux/net_tstamp.h>
+#endif // if defined(FASTDDS_UDP_RECEIVE_TIMESTAMPS)
+
 #include <asio.hpp>
 
 #include <fastdds/rtps/attributes/ThreadSettings.hpp>
@@ -36,7 +50,100 @@ UDPChannelResource::UDPChannelResource(
         const Locator& locator,
         const std::string& sInterface,
         TransportReceiverInterface* receiver,
-        const ThreadSettings& thread_config)
+        const ThreadSettings& thread_config,
+        uint32_t receive_batch_size,
+        bool segmentation_offload,
+        uint32_t busy_poll_budget_us,
+        bool receive_timestamps)
+    : UDPChannelResource(transport, socket, maxMsgSize, sInterface, receiver)
+{
+    busy_poll_budget_ = std::chrono::microseconds(busy_poll_budget_us);
+#if defined(__linux__) && defined(SO_BUSY_POLL)
+    if (0 < busy_poll_budget_us)
+    {
+        // Lets the kernel poll the device queue on blocking receives. Raising it over net.core.busy_read requires
+        // CAP_NET_ADMIN, the socket being polled from user space only otherwise.
+        int budget = static_cast<int>(busy_poll_budget_us);
+        if (0 != setsockopt(socket()->native_handle(), SOL_SOCKET, SO_BUSY_POLL, &budget, sizeof(budget)))
+        {
+            EPROSIMA_LOG_INFO(RTPS_MSG_IN, "SO_BUSY_POLL not set on " << interface_ << ":" << locator.port
+                                                                      << ": " << strerror(errno));
+        }
+    }
+#endif // if defined(__linux__) && defined(SO_BUSY_POLL)
+
+#if defined(FASTDDS_UDP_SEGMENTATION_OFFLOAD)
+    if (segmentation_offload)
+    {
+        int enable = 1;
+        if (0 == setsockopt(socket()->native_handle(), SOL_UDP, UDP_GRO, &enable, sizeof(enable)))
+        {
+            gro_enabled_ = true;
+        }
+        else
+        {
+            EPROSIMA_LOG_WARNING(RTPS_MSG_IN, "UDP_GRO not supported on " << interface_ << ":" << locator.port
+                                                                        << ". Receiving datagrams one by one.");
+        }
+    }
+#else
+    static_cast<void>(segmentation_offload);
+#endif // if defined(FASTDDS_UDP_SEGMENTATION_OFFLOAD)
+
+#if defined(FASTDDS_UDP_RECEIVE_TIMESTAMPS)
+    if (receive_timestamps)
+    {
+        int flags = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+        if (0 == setsockopt(socket()->native_handle(), SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)))
+        {
+            timestamps_enabled_ = true;
+        }
+        else
+        {
+            EPROSIMA_LOG_WARNING(RTPS_MSG_IN, "SO_TIMESTAMPING not supported on " << interface_ << ":" << locator.port
+                                                                                << ". Reception times are taken by the readers.");
+        }
+    }
+#else
+    static_cast<void>(receive_timestamps);
+#endif // if defined(FASTDDS_UDP_RECEIVE_TIMESTAMPS)
+
+#if defined(__linux__)
+    if (receive_batch_size > 1 || gro_enabled_ || timestamps_enabled_)
+    {
+        // Coalesced datagrams may be as big as the biggest datagram
+        uint32_t buffer_size = gro_enabled_ ? (std::max)(maxMsgSize, 65535u) : maxMsgSize;
+        receive_batch_size = (std::max)(receive_batch_size, 1u);
+        batch_buffers_.reserve(receive_batch_size);
+        for (uint32_t i = 0; i < receive_batch_size; ++i)
+        {
+            batch_buffers_.emplace_back(buffer_size);
+        }
+    }
+#else
+    static_cast<void>(receive_batch_size);
+#endif // if defined(__linux__)
+
+    auto fn = [this, locator]()
+            {
+#if defined(__linux__)
+                if (!batch_buffers_.empty())
+                {
+                    perform_batch_listen_operation(locator);
+                    return;
+                }
+#endif // if defined(__linux__)
+                perform_listen_operation(locator);
+            };
+    thread(create_thread(fn, thread_config, "dds.udp.%u", locator.port));
+}
+
+UDPChannelResource::UDPChannelResource(
+        UDPTransportInterface* transport,
+        eProsimaUDPSocket& socket,
+        uint32_t maxMsgSize,
+        const std::string& sInterface,
+        TransportReceiverInterface* receiver)
     : ChannelResource(maxMsgSize)
     , message_receiver_(receiver)
     , socket_(moveSocket(socket))
@@ -44,11 +151,6 @@ UDPChannelResource::UDPChannelResource(
     , interface_(sInterface)
     , transport_(transport)
 {
-    auto fn = [this, locator]()
-            {
-                perform_listen_operation(locator);
-            };
-    thread(create_thread(fn, thread_config, "dds.udp.%u", locator.port));
 }
 
 UDPChannelResource::~UDPChannelResource()
@@ -66,6 +168,8 @@ void UDPChannelResource::perform_listen_operation(
 
     while (alive())
     {
+        busy_poll();
+
         // Blocking receive.
         auto& msg = message_buffer();
         if (!Receive(msg.buffer, msg.max_size, msg.length, remote_locator))
@@ -87,6 +191,154 @@ void UDPChannelResource::perform_listen_operation(
     message_receiver(nullptr);
 }
 
+#if defined(__linux__)
+void UDPChannelResource::perform_batch_listen_operation(
+        Locator input_locator)
+{
+    const size_t batch_size = batch_buffers_.size();
+    std::vector<struct mmsghdr> headers(batch_size);
+    std::vector<struct iovec> iovecs(batch_size);
+    std::vector<struct sockaddr_storage> addresses(batch_size);
+    size_t control_size = 0;
+#if defined(FASTDDS_UDP_SEGMENTATION_OFFLOAD)
+    if (gro_enabled_)
+    {
+        control_size += CMSG_SPACE(sizeof(int));
+    }
+#endif // if defined(FASTDDS_UDP_SEGMENTATION_OFFLOAD)
+#if defined(FASTDDS_UDP_RECEIVE_TIMESTAMPS)
+    if (timestamps_enabled_)
+    {
+        // Software, legacy and hardware timestamps
+        control_size += CMSG_SPACE(3 * sizeof(struct timespec));
+    }
+#endif // if defined(FASTDDS_UDP_RECEIVE_TIMESTAMPS)
+    std::vector<char> controls(batch_size * control_size);
+    Locator remote_locator;
+
+    while (alive())
+    {
+        for (size_t i = 0; i < batch_size; ++i)
+        {
+            iovecs[i].iov_base = batch_buffers_[i].buffer;
+            iovecs[i].iov_len = batch_buffers_[i].max_size;
+            headers[i].msg_hdr.msg_name = &addresses[i];
+            headers[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
+            headers[i].msg_hdr.msg_iov = &iovecs[i];
+            headers[i].msg_hdr.msg_iovlen = 1;
+            headers[i].msg_hdr.msg_control = 0 < control_size ? &controls[i * control_size] : nullptr;
+            headers[i].msg_hdr.msg_controllen = control_size;
+            headers[i].msg_hdr.msg_flags = 0;
+            headers[i].msg_len = 0;
+        }
+
+        busy_poll();
+
+        // Blocks until the first datagram is available, then takes whatever is already queued.
+        int received = recvmmsg(socket()->native_handle(), headers.data(), static_cast<unsigned int>(batch_size),
+                        MSG_WAITFORONE, nullptr);
+        if (received <= 0)
+        {
+            if (received < 0 && errno != EINTR && alive())
+            {
+                EPROSIMA_LOG_WARNING(RTPS_MSG_OUT, "Error receiving data: " << strerror(errno) << " - "
+                                                                            << message_receiver()
+                                                                            << " (" << this << ")");
+            }
+            continue;
+        }
+
+        for (int i = 0; i < received && alive(); ++i)
+        {
+            auto& msg = batch_buffers_[i];
+            msg.length = headers[i].msg_len;
+            if (0 == msg.length)
+            {
+                continue;
+            }
+
+            // This is not necessary anymore but it's left here for back compatibility with versions older than 1.8.1
+            if (msg.length == 13 && memcmp(msg.buffer, "EPRORTPSCLOSE", 13) == 0)
+            {
+                continue;
+            }
+
+            asio::ip::udp::endpoint sender_endpoint;
+            if (headers[i].msg_hdr.msg_namelen > sender_endpoint.capacity())
+            {
+                continue;
+            }
+            memcpy(sender_endpoint.data(), &addresses[i], headers[i].msg_hdr.msg_namelen);
+            sender_endpoint.resize(headers[i].msg_hdr.msg_namelen);
+            transport_->endpoint_to_locator(sender_endpoint, remote_locator);
+
+            // Datagrams coalesced by the kernel are reported with the size of the original ones
+            uint32_t segment_size = msg.length;
+            // Zero when the time is not taken by the kernel
+            fastrtps::rtps::Time_t reception_timestamp;
+            for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&headers[i].msg_hdr); nullptr != cmsg;
+                    cmsg = CMSG_NXTHDR(&headers[i].msg_hdr, cmsg))
+            {
+#if defined(FASTDDS_UDP_SEGMENTATION_OFFLOAD)
+                if (SOL_UDP == cmsg->cmsg_level && UDP_GRO == cmsg->cmsg_type)
+                {
+                    int gso_size = 0;
+                    memcpy(&gso_size, CMSG_DATA(cmsg), sizeof(gso_size));
+                    if (0 < gso_size)
+                    {
+                        segment_size = static_cast<uint32_t>(gso_size);
+                    }
+                }
+#endif // if defined(FASTDDS_UDP_SEGMENTATION_OFFLOAD)
+#if defined(FASTDDS_UDP_RECEIVE_TIMESTAMPS)
+                if (SOL_SOCKET == cmsg->cmsg_level && SO_TIMESTAMPING == cmsg->cmsg_type)
+                {
+                    // The software timestamp comes first
+                    struct timespec stamps[3];
+                    memcpy(stamps, CMSG_DATA(cmsg), sizeof(stamps));
+                    reception_timestamp.from_ns(static_cast<int64_t>(stamps[0].tv_sec) * 1000000000LL +
+                            stamps[0].tv_nsec);
+                }
+#endif // if defined(FASTDDS_UDP_RECEIVE_TIMESTAMPS)
+            }
+
+            for (uint32_t offset = 0; offset < msg.length && alive(); offset += segment_size)
+            {
+                uint32_t length = (std::min)(segment_size, msg.length - offset);
+
+                // Processes the data through the CDR Message interface.
+                if (message_receiver() != nullptr)
+                {
+                    message_receiver()->OnTimestampedDataReceived(msg.buffer + offset, length, input_locator,
+                            remote_locator, reception_timestamp);
+                }
+                else if (alive())
+                {
+                    EPROSIMA_LOG_WARNING(RTPS_MSG_IN, "Received Message, but no receiver attached");
+                }
+            }
+        }
+    }
+
+    message_receiver(nullptr);
+}
+
+#endif // if defined(__linux__)
+
+void UDPChannelResource::busy_poll()
+{
+    if (0 == busy_poll_budget_.count())
+    {
+        return;
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + busy_poll_budget_;
+    asio::error_code ec;
+    while (alive() && 0 == socket()->available(ec) && !ec && std::chrono::steady_clock::now() < deadline)
+    {
+    }
+}
+
 bool UDPChannelResource::Receive(
         octet* receive_buffer,
         uint32_t receive_buffer_capacity,
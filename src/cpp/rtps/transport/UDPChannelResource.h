@@ -15,8 +15,22 @@
 #ifndef _FASTDDS_UDP_CHANNEL_RESOURCE_INFO_
 #define _FASTDDS_UDP_CHANNEL_RESOURCE_INFO_
 
+#include <chrono>
+#include <vector>
+
 #include <asio.hpp>
 
+#if defined(__linux__)
+#include <netinet/udp.h>
+#include <sys/socket.h>
+#if defined(UDP_SEGMENT) && defined(UDP_GRO)
+#define FASTDDS_UDP_SEGMENTATION_OFFLOAD 1
+#endif // if defined(UDP_SEGMENT) && defined(UDP_GRO)
+#if defined(SO_TIMESTAMPING)
+#define FASTDDS_UDP_RECEIVE_TIMESTAMPS 1
+#endif // if defined(SO_TIMESTAMPING)
+#endif // if defined(__linux__)
+
 #include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/rtps/common/Locator.h>
 
@@ -114,7 +128,11 @@ public:
             const Locator& locator,
             const std::string& sInterface,
             TransportReceiverInterface* receiver,
-            const ThreadSettings& thread_config);
+            const ThreadSettings& thread_config,
+            uint32_t receive_batch_size = 1,
+            bool segmentation_offload = false,
+            uint32_t busy_poll_budget_us = 0,
+            bool receive_timestamps = false);
 
     virtual ~UDPChannelResource() override;
 
@@ -177,10 +195,20 @@ public:
         ChannelResource::disable();
     }
 
-    void release();
+    virtual void release();
 
 protected:
 
+    /**
+     * Constructor for derived channels, which are in charge of starting their own listening thread.
+     */
+    UDPChannelResource(
+            UDPTransportInterface* transport,
+            eProsimaUDPSocket& socket,
+            uint32_t maxMsgSize,
+            const std::string& sInterface,
+            TransportReceiverInterface* receiver);
+
     /**
      * Function to be called from a new thread, which takes cares of performing a blocking receive
      * operation on the ReceiveResource
@@ -203,6 +231,25 @@ protected:
             uint32_t& receive_buffer_size,
             Locator& remote_locator);
 
+#if defined(__linux__)
+    /**
+     * Function to be called from the listening thread when the batched receive mode, the generic receive
+     * offload or the kernel reception timestamps are enabled.
+     * Each iteration retrieves up to receive_batch_size_ datagrams with a single system call. Datagrams coalesced
+     * by the kernel are split back into the original messages, and the reception time taken by the kernel is
+     * handed to the message receiver along with them.
+     * @param input_locator - Locator that triggered the creation of the resource
+     */
+    void perform_batch_listen_operation(
+            Locator input_locator);
+#endif // if defined(__linux__)
+
+    /**
+     * Polls the socket until a datagram is available, the channel is disabled or the busy-poll budget expires.
+     * Does nothing when busy polling is not enabled.
+     */
+    void busy_poll();
+
 private:
 
     TransportReceiverInterface* message_receiver_; //Associated Readers/Writers inside of MessageReceiver
@@ -210,6 +257,14 @@ private:
     bool only_multicast_purpose_;
     std::string interface_;
     UDPTransportInterface* transport_;
+    //! Ring of preallocated buffers used on the batched receive mode
+    std::vector<fastrtps::rtps::CDRMessage_t> batch_buffers_;
+    //! Whether the socket may return several datagrams coalesced by the kernel (UDP_GRO)
+    bool gro_enabled_ = false;
+    //! Whether the socket reports the time at which the kernel received each datagram (SO_TIMESTAMPING)
+    bool timestamps_enabled_ = false;
+    //! Time polling the socket before blocking on it
+    std::chrono::microseconds busy_poll_budget_ {0};
 
     UDPChannelResource(
             const UDPChannelResource&) = delete;
@@ -0,0 +1,272 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _RTPS_TRANSPORT_UDPCONNECTEDSOCKETCACHE_HPP_
+#define _RTPS_TRANSPORT_UDPCONNECTEDSOCKETCACHE_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <asio.hpp>
+
+#include <rtps/transport/UDPChannelResource.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Cache of UDP sockets connected to the most used unicast destinations of an output channel.
+ *
+ * Sending through a connected socket saves the route and neighbour lookups the kernel performs for each datagram
+ * sent through an unconnected one. Destinations are given a connected socket once they have been used
+ * promotion_threshold times. When the cache is full, the socket which has gone unused for the most promotions is
+ * closed.
+ *
+ * The connected sockets are looked up on an immutable snapshot, so sends to destinations with a connected socket
+ * never lock. Sockets are shared with the send operations using them, so evicting a socket never interrupts a send.
+ */
+class UDPConnectedSocketCache
+{
+public:
+
+    using SocketPtr = std::shared_ptr<eProsimaUDPSocket>;
+
+    //! Function opening a socket connected to the given destination. Returns nullptr on failure.
+    using SocketFactory = std::function<SocketPtr(const asio::ip::udp::endpoint&)>;
+
+    //! Number of uses of a destination before it gets a connected socket
+    static constexpr uint32_t promotion_threshold = 16;
+
+    /**
+     * @param max_sockets Maximum number of connected sockets kept open.
+     * @param factory Function used to open the connected sockets.
+     */
+    UDPConnectedSocketCache(
+            uint32_t max_sockets,
+            SocketFactory factory)
+        : max_sockets_(max_sockets)
+        , factory_(std::move(factory))
+        , table_(new SocketTable())
+        , table_readers_(0)
+        , use_clock_(0)
+    {
+    }
+
+    ~UDPConnectedSocketCache()
+    {
+        delete table_.load();
+    }
+
+    /**
+     * Get the socket connected to a destination, accounting a use of the destination.
+     *
+     * @param destination Unicast endpoint a datagram is about to be sent to.
+     * @return The connected socket, or nullptr when the datagram should be sent through the unconnected socket.
+     */
+    SocketPtr get(
+            const asio::ip::udp::endpoint& destination)
+    {
+        {
+            TableReader reader(*this);
+            const SocketTable& table = *table_.load();
+            auto it = table.find(destination);
+            if (it != table.end())
+            {
+                // Only written once per period, so the sends to a destination do not keep writing its entry
+                uint64_t now = use_clock_.load(std::memory_order_relaxed);
+                if (it->second->last_use.load(std::memory_order_relaxed) != now)
+                {
+                    it->second->last_use.store(now, std::memory_order_relaxed);
+                }
+                return it->second->socket;
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+
+            // Uses of destinations which never became hot are forgotten from time to time
+            if (candidates_.size() >= max_candidates())
+            {
+                candidates_.clear();
+            }
+
+            uint32_t& uses = candidates_[destination];
+            if (++uses < promotion_threshold)
+            {
+                return nullptr;
+            }
+            candidates_.erase(destination);
+        }
+
+        // Opening and connecting the socket does not block the sends to other destinations
+        SocketPtr socket = factory_(destination);
+        if (!socket)
+        {
+            return nullptr;
+        }
+
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        const SocketTable& current = *table_.load();
+        auto it = current.find(destination);
+        if (it != current.end())
+        {
+            return it->second->socket;
+        }
+
+        std::unique_ptr<SocketTable> table(new SocketTable(current));
+        if (table->size() >= max_sockets_)
+        {
+            auto lru = std::min_element(table->begin(), table->end(),
+                            [](const SocketTable::value_type& a, const SocketTable::value_type& b)
+                            {
+                                return a.second->last_use.load(std::memory_order_relaxed) <
+                                b.second->last_use.load(std::memory_order_relaxed);
+                            });
+            table->erase(lru);
+        }
+
+        // Each promotion starts a new period of use, so the sockets used since the last one are the most recent
+        uint64_t now = use_clock_.fetch_add(1, std::memory_order_relaxed) + 1;
+        std::shared_ptr<Entry> entry = std::make_shared<Entry>(socket, now);
+        table->emplace(destination, std::move(entry));
+        publish(table.release());
+        return socket;
+    }
+
+    //! Forget a destination, closing its connected socket once it is not in use.
+    void remove(
+            const asio::ip::udp::endpoint& destination)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        const SocketTable& current = *table_.load();
+        if (current.find(destination) != current.end())
+        {
+            std::unique_ptr<SocketTable> table(new SocketTable(current));
+            table->erase(destination);
+            publish(table.release());
+        }
+    }
+
+    //! Number of connected sockets kept open.
+    size_t size() const
+    {
+        TableReader reader(*this);
+        return table_.load()->size();
+    }
+
+private:
+
+    struct Entry
+    {
+        Entry(
+                SocketPtr s,
+                uint64_t use)
+            : socket(std::move(s))
+            , last_use(use)
+        {
+        }
+
+        SocketPtr socket;
+
+        //! Period of use of the cache in which the socket was last used
+        std::atomic<uint64_t> last_use;
+    };
+
+    //! Immutable snapshot of the connected sockets. Only the last use of the entries changes.
+    using SocketTable = std::map<asio::ip::udp::endpoint, std::shared_ptr<Entry>>;
+
+    /**
+     * Marks the calling thread as a reader of the socket table while alive.
+     * Snapshots replaced while some thread reads the table are not deleted until all the readers leave.
+     */
+    class TableReader
+    {
+    public:
+
+        explicit TableReader(
+                const UDPConnectedSocketCache& cache)
+            : cache_(cache)
+        {
+            cache_.table_readers_.fetch_add(1);
+        }
+
+        ~TableReader()
+        {
+            cache_.table_readers_.fetch_sub(1, std::memory_order_release);
+        }
+
+    private:
+
+        const UDPConnectedSocketCache& cache_;
+    };
+
+    /**
+     * Publishes a new snapshot of the connected sockets, and deletes the replaced one once no thread reads it.
+     * @pre The calling thread holds mutex_.
+     */
+    void publish(
+            SocketTable* table)
+    {
+        SocketTable* old_table = table_.exchange(table);
+
+        // Threads entering after the exchange can only load the new table, so the old one is not used
+        // once the threads reading the table at the time of the exchange have left.
+        while (0 != table_readers_.load())
+        {
+            std::this_thread::yield();
+        }
+
+        delete old_table;
+    }
+
+    size_t max_candidates() const
+    {
+        return 8 * static_cast<size_t>(max_sockets_);
+    }
+
+    uint32_t max_sockets_;
+
+    SocketFactory factory_;
+
+    //! Serializes the updates of the socket table and the accounting of the candidates
+    std::mutex mutex_;
+
+    //! Current snapshot of the connected sockets
+    std::atomic<SocketTable*> table_;
+
+    //! Number of threads reading the socket table
+    mutable std::atomic<uint32_t> table_readers_;
+
+    //! Current period of use of the cache, advanced on every promotion
+    std::atomic<uint64_t> use_clock_;
+
+    //! Number of uses of the destinations without a connected socket
+    std::map<asio::ip::udp::endpoint, uint32_t> candidates_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _RTPS_TRANSPORT_UDPCONNECTEDSOCKETCACHE_HPP_
@@ -15,10 +15,13 @@
 #ifndef __TRANSPORT_UDPSENDERRESOURCE_HPP__
 #define __TRANSPORT_UDPSENDERRESOURCE_HPP__
 
+#include <mutex>
+
 #include <fastdds/rtps/common/Locator.h>
 #include <fastdds/rtps/transport/SenderResource.h>
 
 #include <rtps/transport/ChainingSenderResource.hpp>
+#include <rtps/transport/UDPConnectedSocketCache.hpp>
 #include <rtps/transport/UDPTransportInterface.h>
 
 namespace eprosima {
@@ -40,6 +43,26 @@ public:
         , whitelisted_(whitelisted)
         , transport_(transport)
     {
+#if defined(__linux__)
+        // Connected sockets join the port of the output socket with SO_REUSEPORT, so a destination receives all the
+        // datagrams of the channel from the same source port, and its receive shards keep them in order.
+        uint32_t max_connected_sockets = transport.configuration()->max_connected_sockets;
+        if (0 < max_connected_sockets && !only_multicast_purpose_)
+        {
+            asio::error_code ec;
+            getSocketPtr(socket_)->set_option(asio::detail::socket_option::boolean<
+                        ASIO_OS_DEF(SOL_SOCKET), SO_REUSEPORT>(true), ec);
+            if (!ec)
+            {
+                connected_sockets_.reset(new UDPConnectedSocketCache(max_connected_sockets,
+                        [this, &transport](const asio::ip::udp::endpoint& destination)
+                        {
+                            return transport.OpenConnectedOutputSocket(socket_, destination);
+                        }));
+            }
+        }
+#endif // if defined(__linux__)
+
         // Implementation functions are bound to the right transport parameters
         clean_up = [this, &transport]()
                 {
@@ -53,14 +76,45 @@ public:
             fastrtps::rtps::LocatorsIterator* destination_locators_end,
             const std::chrono::steady_clock::time_point& max_blocking_time_point) -> bool
                 {
+                    std::unique_lock<std::mutex> storage_lock(batch_storage_mutex_, std::try_to_lock);
                     return transport.send(data, dataSize, socket_, destination_locators_begin,
                                    destination_locators_end, only_multicast_purpose_, whitelisted_,
-                                   max_blocking_time_point);
+                                   max_blocking_time_point, connected_sockets_.get(),
+                                   storage_lock.owns_lock() ? &batch_storage_ : nullptr);
+                };
+
+        send_gather_lambda_ = [this, &transport](
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            uint32_t segment_size,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point) -> bool
+                {
+                    // Segmented messages are only given on a single slice
+                    if (0 != segment_size)
+                    {
+                        return transport.send_segmented(buffers.front().buffer, total_bytes, segment_size, socket_,
+                                       destination_locators_begin, destination_locators_end, only_multicast_purpose_,
+                                       whitelisted_, max_blocking_time_point);
+                    }
+
+                    std::unique_lock<std::mutex> storage_lock(batch_storage_mutex_, std::try_to_lock);
+                    return transport.send(buffers, total_bytes, socket_, destination_locators_begin,
+                                   destination_locators_end, only_multicast_purpose_, whitelisted_,
+                                   max_blocking_time_point, connected_sockets_.get(),
+                                   storage_lock.owns_lock() ? &batch_storage_ : nullptr);
                 };
+
+#if defined(FASTDDS_UDP_SEGMENTATION_OFFLOAD)
+        gather_segments_ = transport.configuration()->segmentation_offload;
+#endif // if defined(FASTDDS_UDP_SEGMENTATION_OFFLOAD)
     }
 
     virtual ~UDPSenderResource()
     {
+        connected_sockets_.reset();
+
         if (clean_up)
         {
             clean_up();
@@ -126,6 +180,15 @@ private:
     bool whitelisted_;
 
     UDPTransportInterface& transport_;
+
+    //! Sockets connected to the most used unicast destinations
+    std::unique_ptr<UDPConnectedSocketCache> connected_sockets_;
+
+    //! Memory reused by the sends to several destinations
+    UDPBatchSendStorage batch_storage_;
+
+    //! Guards batch_storage_. Concurrent sends, which the participant does not perform, use their own memory.
+    std::mutex batch_storage_mutex_;
 };
 
 } // namespace rtps
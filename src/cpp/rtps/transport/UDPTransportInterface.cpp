@@ -19,10 +19,18 @@
 #include <algorithm>
 #include <chrono>
 
+#if defined(__linux__)
+#include <cerrno>
+#include <poll.h>
+#include <sys/socket.h>
+#endif // if defined(__linux__)
+
 #include <fastdds/rtps/transport/TransportInterface.h>
 #include <fastdds/rtps/messages/CDRMessage.h>
 #include <fastdds/dds/log/Log.hpp>
 #include <fastrtps/utils/IPLocator.h>
+#include <rtps/transport/NetworkBufferSequence.hpp>
+#include <rtps/transport/UDPConnectedSocketCache.hpp>
 #include <rtps/transport/UDPSenderResource.hpp>
 #include <statistics/rtps/messages/RTPSStatisticsMessages.hpp>
 
@@ -42,6 +50,11 @@ using PortParameters = fastrtps::rtps::PortParameters;
 using SenderResource = fastrtps::rtps::SenderResource;
 using Log = fastdds::dds::Log;
 
+#if defined(FASTDDS_UDP_ZERO_COPY)
+//! Maximum time to wait for the kernel to release the buffer of a zero-copy send
+static constexpr int zero_copy_completion_timeout_ms = 1000;
+#endif // if defined(FASTDDS_UDP_ZERO_COPY)
+
 UDPTransportDescriptor::UDPTransportDescriptor()
     : SocketTransportDescriptor(s_maximumMessageSize, s_maximumInitialPeersRange)
     , m_output_udp_socket(0)
@@ -53,6 +66,13 @@ bool UDPTransportDescriptor::operator ==(
 {
     return (this->m_output_udp_socket == t.m_output_udp_socket &&
            this->non_blocking_send == t.non_blocking_send &&
+           this->receive_batch_size == t.receive_batch_size &&
+           this->segmentation_offload == t.segmentation_offload &&
+           this->receive_shards == t.receive_shards &&
+           this->zero_copy_send_threshold == t.zero_copy_send_threshold &&
+           this->busy_poll_budget_us == t.busy_poll_budget_us &&
+           this->receive_timestamps == t.receive_timestamps &&
+           this->max_connected_sockets == t.max_connected_sockets &&
            SocketTransportDescriptor::operator ==(t));
 }
 
@@ -102,9 +122,54 @@ bool UDPTransportInterface::CloseInputChannel(
     return true;
 }
 
+bool UDPTransportInterface::close_input_channel_shard(
+        const Locator& locator,
+        TransportReceiverInterface* receiver)
+{
+    std::vector<UDPChannelResource*> channel_resources;
+    {
+        std::unique_lock<std::recursive_mutex> scopedLock(mInputMapMutex);
+        if (!IsInputChannelOpen(locator))
+        {
+            return false;
+        }
+
+        // The other shards of the port keep receiving
+        std::vector<UDPChannelResource*>& port_resources = mInputSockets.at(IPLocator::getPhysicalPort(locator));
+        auto shard_end = std::stable_partition(port_resources.begin(), port_resources.end(),
+                        [receiver](UDPChannelResource* channel)
+                        {
+                            return channel->message_receiver() != receiver;
+                        });
+        channel_resources.assign(shard_end, port_resources.end());
+        port_resources.erase(shard_end, port_resources.end());
+        if (port_resources.empty())
+        {
+            mInputSockets.erase(IPLocator::getPhysicalPort(locator));
+        }
+    }
+
+    for (UDPChannelResource* channel : channel_resources)
+    {
+        channel->disable();
+        channel->release();
+        channel->clear();
+        delete channel;
+    }
+
+    return !channel_resources.empty();
+}
+
 void UDPTransportInterface::CloseOutputChannel(
         eProsimaUDPSocket& socket)
 {
+#if defined(FASTDDS_UDP_ZERO_COPY)
+    {
+        std::lock_guard<std::mutex> guard(zero_copy_mutex_);
+        zero_copy_completions_.erase(getSocketPtr(socket)->native_handle());
+    }
+#endif // if defined(FASTDDS_UDP_ZERO_COPY)
+
     socket.cancel();
     socket.close();
 }
@@ -170,6 +235,10 @@ bool UDPTransportInterface::init(
         return false;
     }
 
+#if defined(FASTDDS_UDP_ZERO_COPY)
+    zero_copy_enabled_ = 0 < configuration()->zero_copy_send_threshold;
+#endif // if defined(FASTDDS_UDP_ZERO_COPY)
+
     // TODO(Ricardo) Create an event that update this list.
     get_ips(currentInterfaces);
 
@@ -198,6 +267,7 @@ bool UDPTransportInterface::OpenAndBindInputSockets(
 {
     std::unique_lock<std::recursive_mutex> scopedLock(mInputMapMutex);
 
+    std::vector<UDPChannelResource*> channel_resources;
     try
     {
         std::vector<std::string> vInterfaces = get_binding_interfaces_list();
@@ -205,7 +275,7 @@ bool UDPTransportInterface::OpenAndBindInputSockets(
         {
             UDPChannelResource* p_channel_resource;
             p_channel_resource = CreateInputChannelResource(sInterface, locator, is_multicast, maxMsgSize, receiver);
-            mInputSockets[IPLocator::getPhysicalPort(locator)].push_back(p_channel_resource);
+            channel_resources.push_back(p_channel_resource);
         }
     }
     catch (asio::system_error const& e)
@@ -214,13 +284,77 @@ bool UDPTransportInterface::OpenAndBindInputSockets(
         EPROSIMA_LOG_INFO(RTPS_MSG_OUT, "UDPTransport Error binding at port: (" << IPLocator::getPhysicalPort(
                     locator) << ")"
                                                                                 << " with msg: " << e.what());
-        mInputSockets.erase(IPLocator::getPhysicalPort(locator));
+
+        // Only the channels opened by this call are released, as other shards of the port may be already open
+        for (UDPChannelResource* channel : channel_resources)
+        {
+            channel->disable();
+            channel->release();
+            channel->clear();
+            delete channel;
+        }
         return false;
     }
 
+    std::vector<UDPChannelResource*>& port_resources = mInputSockets[IPLocator::getPhysicalPort(locator)];
+    port_resources.insert(port_resources.end(), channel_resources.begin(), channel_resources.end());
     return true;
 }
 
+bool UDPTransportInterface::OpenAndBindInputShard(
+        const Locator& locator,
+        TransportReceiverInterface* receiver,
+        uint32_t maxMsgSize)
+{
+    std::unique_lock<std::recursive_mutex> scopedLock(mInputMapMutex);
+
+    auto port_resources = mInputSockets.find(IPLocator::getPhysicalPort(locator));
+    if (port_resources == mInputSockets.end())
+    {
+        return false;
+    }
+
+    // Each shard feeds a different receiver
+    std::vector<TransportReceiverInterface*> shard_receivers;
+    for (UDPChannelResource* channel_resource : port_resources->second)
+    {
+        if (std::find(shard_receivers.begin(), shard_receivers.end(),
+                channel_resource->message_receiver()) == shard_receivers.end())
+        {
+            shard_receivers.push_back(channel_resource->message_receiver());
+        }
+    }
+
+    if (shard_receivers.size() >= input_channel_shards(locator) ||
+            std::find(shard_receivers.begin(), shard_receivers.end(), receiver) != shard_receivers.end())
+    {
+        return false;
+    }
+
+    return OpenAndBindInputSockets(locator, receiver, false, maxMsgSize);
+}
+
+uint32_t UDPTransportInterface::configured_receive_shards() const
+{
+#if defined(__linux__)
+    return (std::max)(configuration()->receive_shards, 1u);
+#else
+    return 1;
+#endif // if defined(__linux__)
+}
+
+bool UDPTransportInterface::is_input_shard(
+        uint16_t port) const
+{
+    return mInputSockets.find(port) != mInputSockets.end();
+}
+
+uint32_t UDPTransportInterface::input_channel_shards(
+        const Locator& locator) const
+{
+    return IPLocator::isMulticast(locator) ? 1 : configured_receive_shards();
+}
+
 UDPChannelResource* UDPTransportInterface::CreateInputChannelResource(
         const std::string& sInterface,
         const Locator& locator,
@@ -231,13 +365,16 @@ UDPChannelResource* UDPTransportInterface::CreateInputChannelResource(
     eProsimaUDPSocket unicastSocket = OpenAndBindInputSocket(sInterface,
                     IPLocator::getPhysicalPort(locator), is_multicast);
     UDPChannelResource* p_channel_resource = new UDPChannelResource(this, unicastSocket, maxMsgSize, locator,
-                    sInterface, receiver, configuration()->get_thread_config_for_port(locator.port));
+                    sInterface, receiver, configuration()->get_thread_config_for_port(locator.port),
+                    configuration()->receive_batch_size, configuration()->segmentation_offload,
+                    configuration()->busy_poll_budget_us, configuration()->receive_timestamps);
     return p_channel_resource;
 }
 
 eProsimaUDPSocket UDPTransportInterface::OpenAndBindUnicastOutputSocket(
         const ip::udp::endpoint& endpoint,
-        uint16_t& port)
+        uint16_t& port,
+        bool reuse_port)
 {
     eProsimaUDPSocket socket = createUDPSocket(io_service_);
     getSocketPtr(socket)->open(generate_protocol());
@@ -246,9 +383,30 @@ eProsimaUDPSocket UDPTransportInterface::OpenAndBindUnicastOutputSocket(
         getSocketPtr(socket)->set_option(socket_base::send_buffer_size(static_cast<int32_t>(mSendBufferSize)));
     }
     getSocketPtr(socket)->set_option(ip::multicast::hops(configuration()->TTL));
+#if defined(__linux__)
+    if (reuse_port)
+    {
+        getSocketPtr(socket)->set_option(asio::detail::socket_option::boolean<
+                    ASIO_OS_DEF(SOL_SOCKET), SO_REUSEPORT>(true));
+    }
+#else
+    static_cast<void>(reuse_port);
+#endif // if defined(__linux__)
     getSocketPtr(socket)->bind(endpoint);
     getSocketPtr(socket)->non_blocking(configuration()->non_blocking_send);
 
+#if defined(FASTDDS_UDP_ZERO_COPY)
+    if (zero_copy_enabled_)
+    {
+        int enable = 1;
+        if (0 != setsockopt(getSocketPtr(socket)->native_handle(), SOL_SOCKET, SO_ZEROCOPY, &enable, sizeof(enable)))
+        {
+            EPROSIMA_LOG_WARNING(RTPS_MSG_OUT, "UDP zero-copy send not available: " << strerror(errno));
+            zero_copy_enabled_ = false;
+        }
+    }
+#endif // if defined(FASTDDS_UDP_ZERO_COPY)
+
     if (port == 0)
     {
         port = getSocketPtr(socket)->local_endpoint().port();
@@ -257,6 +415,29 @@ eProsimaUDPSocket UDPTransportInterface::OpenAndBindUnicastOutputSocket(
     return socket;
 }
 
+std::shared_ptr<eProsimaUDPSocket> UDPTransportInterface::OpenConnectedOutputSocket(
+        const eProsimaUDPSocket& output_socket,
+        const ip::udp::endpoint& destination)
+{
+    try
+    {
+        // Bound to the address and port of the output socket, which lets it in with SO_REUSEPORT
+        ip::udp::endpoint local_endpoint = getSocketPtr(output_socket)->local_endpoint();
+        uint16_t port = local_endpoint.port();
+        std::shared_ptr<eProsimaUDPSocket> socket = std::make_shared<eProsimaUDPSocket>(
+            OpenAndBindUnicastOutputSocket(local_endpoint, port, true));
+        getSocketPtr(*socket)->connect(destination);
+        return socket;
+    }
+    catch (asio::system_error const& e)
+    {
+        (void)e;
+        EPROSIMA_LOG_INFO(RTPS_MSG_OUT, "UDPTransport could not connect a socket to " << destination
+                                                                                      << ": " << e.what());
+        return nullptr;
+    }
+}
+
 bool UDPTransportInterface::OpenOutputChannel(
         SendResourceList& sender_resource_list,
         const Locator& locator)
@@ -442,7 +623,9 @@ bool UDPTransportInterface::send(
         fastrtps::rtps::LocatorsIterator* destination_locators_end,
         bool only_multicast_purpose,
         bool whitelisted,
-        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+        const std::chrono::steady_clock::time_point& max_blocking_time_point,
+        UDPConnectedSocketCache* connected_sockets,
+        UDPBatchSendStorage* batch_storage)
 {
     fastrtps::rtps::LocatorsIterator& it = *destination_locators_begin;
 
@@ -451,33 +634,536 @@ bool UDPTransportInterface::send(
     auto time_out = std::chrono::duration_cast<std::chrono::microseconds>(
         max_blocking_time_point - std::chrono::steady_clock::now());
 
+#if defined(__linux__)
+    // Sends without the storage of a channel use their own, which allocates memory on the first destination
+    UDPBatchSendStorage local_storage;
+    UDPBatchSendStorage& storage = (nullptr != batch_storage) ? *batch_storage : local_storage;
+    std::vector<Locator>& remote_locators = storage.remote_locators;
+    remote_locators.clear();
+#else
+    static_cast<void>(batch_storage);
+#endif // if defined(__linux__)
+
     while (it != *destination_locators_end)
     {
         if (IsLocatorSupported(*it))
         {
+#if defined(__linux__)
+            remote_locators.push_back(*it);
+#else
             ret &= send(send_buffer,
                             send_buffer_size,
                             socket,
                             *it,
                             only_multicast_purpose,
                             whitelisted,
-                            time_out);
+                            time_out,
+                            connected_sockets);
+#endif // if defined(__linux__)
         }
 
         ++it;
     }
 
+#if defined(__linux__)
+    ret = send_batch(send_buffer, send_buffer_size, socket, remote_locators, only_multicast_purpose, whitelisted,
+                    time_out, connected_sockets, storage);
+#endif // if defined(__linux__)
+
     return ret;
 }
 
 bool UDPTransportInterface::send(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        bool only_multicast_purpose,
+        bool whitelisted,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point,
+        UDPConnectedSocketCache* connected_sockets,
+        UDPBatchSendStorage* batch_storage)
+{
+    fastrtps::rtps::LocatorsIterator& it = *destination_locators_begin;
+
+    bool ret = true;
+
+    auto time_out = std::chrono::duration_cast<std::chrono::microseconds>(
+        max_blocking_time_point - std::chrono::steady_clock::now());
+
+#if defined(__linux__)
+    // Sends without the storage of a channel use their own, which allocates memory on the first destination
+    UDPBatchSendStorage local_storage;
+    UDPBatchSendStorage& storage = (nullptr != batch_storage) ? *batch_storage : local_storage;
+    std::vector<Locator>& remote_locators = storage.remote_locators;
+    remote_locators.clear();
+#else
+    static_cast<void>(batch_storage);
+#endif // if defined(__linux__)
+
+    while (it != *destination_locators_end)
+    {
+        if (IsLocatorSupported(*it))
+        {
+#if defined(__linux__)
+            remote_locators.push_back(*it);
+#else
+            ret &= send(buffers,
+                            total_bytes,
+                            socket,
+                            *it,
+                            only_multicast_purpose,
+                            whitelisted,
+                            time_out,
+                            connected_sockets);
+#endif // if defined(__linux__)
+        }
+
+        ++it;
+    }
+
+#if defined(__linux__)
+    ret = send_batch(buffers, total_bytes, socket, remote_locators, only_multicast_purpose, whitelisted,
+                    time_out, connected_sockets, storage);
+#endif // if defined(__linux__)
+
+    return ret;
+}
+
+#if defined(__linux__)
+bool UDPTransportInterface::send_batch(
         const octet* send_buffer,
         uint32_t send_buffer_size,
         eProsimaUDPSocket& socket,
-        const Locator& remote_locator,
+        const std::vector<Locator>& remote_locators,
         bool only_multicast_purpose,
         bool whitelisted,
+        const std::chrono::microseconds& timeout,
+        UDPConnectedSocketCache* connected_sockets,
+        UDPBatchSendStorage& storage)
+{
+    bool ret = true;
+
+    // Nothing to gain on few destinations, unless the data is not to be copied
+    if (remote_locators.size() < min_batch_destinations_ && !use_zero_copy(send_buffer_size))
+    {
+        for (const Locator& remote_locator : remote_locators)
+        {
+            ret &= send(send_buffer, send_buffer_size, socket, remote_locator, only_multicast_purpose, whitelisted,
+                            timeout, connected_sockets);
+        }
+        return ret;
+    }
+
+    // The slice is kept on the storage, so it is only allocated once
+    std::vector<NetworkBuffer>& buffers = storage.single_buffer;
+    buffers.assign(1, NetworkBuffer(send_buffer, send_buffer_size));
+    return send_batch(buffers, send_buffer_size, socket, remote_locators, only_multicast_purpose, whitelisted,
+                   timeout, connected_sockets, storage);
+}
+
+bool UDPTransportInterface::send_batch(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        const std::vector<Locator>& remote_locators,
+        bool only_multicast_purpose,
+        bool whitelisted,
+        const std::chrono::microseconds& timeout,
+        UDPConnectedSocketCache* connected_sockets,
+        UDPBatchSendStorage& storage)
+{
+    bool ret = true;
+
+    // Nothing to gain on few destinations, unless the data is not to be copied
+    if (remote_locators.size() < min_batch_destinations_ && !use_zero_copy(total_bytes))
+    {
+        for (const Locator& remote_locator : remote_locators)
+        {
+            ret &= send(buffers, total_bytes, socket, remote_locator, only_multicast_purpose, whitelisted,
+                            timeout, connected_sockets);
+        }
+        return ret;
+    }
+
+    if (total_bytes > configuration()->sendBufferSize || buffers.empty())
+    {
+        return false;
+    }
+
+    std::vector<const Locator*>& destinations = storage.destinations;
+    std::vector<ip::udp::endpoint>& endpoints = storage.endpoints;
+    destinations.clear();
+    endpoints.clear();
+    for (const Locator& remote_locator : remote_locators)
+    {
+        if (IPLocator::isMulticast(remote_locator) == only_multicast_purpose || whitelisted)
+        {
+            destinations.push_back(&remote_locator);
+            endpoints.push_back(generate_endpoint(remote_locator, IPLocator::getPhysicalPort(remote_locator)));
+        }
+        else
+        {
+            ret = false;
+        }
+    }
+
+    const size_t num_destinations = destinations.size();
+    if (0 == num_destinations)
+    {
+        return ret;
+    }
+
+    // The statistics submessage at the end of the last buffer is different for each destination, so each message
+    // is sent as the common part of the buffers followed by its own copy of the statistics submessage.
+    uint32_t tail_size = 0;
+#ifdef FASTDDS_STATISTICS
+    if (nullptr != statistics::rtps::get_statistics_submessage(buffers, total_bytes))
+    {
+        tail_size = statistics::rtps::statistics_submessage_length;
+    }
+#endif // FASTDDS_STATISTICS
+    const NetworkBuffer& last_buffer = buffers.back();
+    const size_t iovecs_per_message = buffers.size() + 1;
+
+    std::vector<octet>& tails = storage.tails;
+    std::vector<struct iovec>& iovecs = storage.iovecs;
+    std::vector<struct mmsghdr>& headers = storage.headers;
+    tails.resize(static_cast<size_t>(tail_size) * num_destinations);
+    iovecs.resize(iovecs_per_message * num_destinations);
+    headers.resize(num_destinations);
+    for (size_t i = 0; i < num_destinations; ++i)
+    {
+        statistics_info_.set_statistics_message_data(*destinations[i], buffers, total_bytes);
+
+        struct iovec* message_iovecs = &iovecs[iovecs_per_message * i];
+        for (size_t j = 0; j < buffers.size(); ++j)
+        {
+            message_iovecs[j].iov_base = const_cast<octet*>(buffers[j].buffer);
+            message_iovecs[j].iov_len = buffers[j].size;
+        }
+        message_iovecs[buffers.size() - 1].iov_len -= tail_size;
+        if (0 < tail_size)
+        {
+            octet* tail = &tails[i * tail_size];
+            memcpy(tail, last_buffer.buffer + last_buffer.size - tail_size, tail_size);
+            message_iovecs[buffers.size()].iov_base = tail;
+            message_iovecs[buffers.size()].iov_len = tail_size;
+        }
+
+        memset(&headers[i], 0, sizeof(struct mmsghdr));
+        headers[i].msg_hdr.msg_name = endpoints[i].data();
+        headers[i].msg_hdr.msg_namelen = static_cast<socklen_t>(endpoints[i].size());
+        headers[i].msg_hdr.msg_iov = message_iovecs;
+        headers[i].msg_hdr.msg_iovlen = (0 < tail_size) ? iovecs_per_message : buffers.size();
+    }
+
+    return send_datagrams(socket, headers, endpoints, timeout) && ret;
+}
+
+bool UDPTransportInterface::send_datagrams(
+        eProsimaUDPSocket& socket,
+        std::vector<struct mmsghdr>& headers,
+        const std::vector<ip::udp::endpoint>& endpoints,
         const std::chrono::microseconds& timeout)
+{
+    bool ret = true;
+    const size_t num_destinations = headers.size();
+
+    int fd = getSocketPtr(socket)->native_handle();
+    struct timeval timeStruct;
+    timeStruct.tv_sec = 0;
+    timeStruct.tv_usec = timeout.count() > 0 ? timeout.count() : 0;
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, reinterpret_cast<const char*>(&timeStruct), sizeof(timeStruct));
+
+    int flags = 0;
+#if defined(FASTDDS_UDP_ZERO_COPY)
+    std::shared_ptr<ZeroCopyCompletions> completions;
+    std::unique_lock<std::mutex> zero_copy_send_lock;
+    uint32_t zero_copy_sends = 0;
+    if (0 < num_destinations && use_zero_copy(headers[0].msg_hdr))
+    {
+        completions = zero_copy_completions(fd);
+        zero_copy_send_lock = std::unique_lock<std::mutex>(completions->send_mutex);
+        flags = MSG_ZEROCOPY;
+    }
+#endif // if defined(FASTDDS_UDP_ZERO_COPY)
+
+    size_t next = 0;
+    while (next < num_destinations)
+    {
+        int sent = sendmmsg(fd, &headers[next], static_cast<unsigned int>(num_destinations - next), flags);
+        if (0 > sent)
+        {
+            // sendmmsg only fails when the first message could not be sent, so the error refers to headers[next]
+            if (EINTR == errno)
+            {
+                continue;
+            }
+
+#if defined(FASTDDS_UDP_ZERO_COPY)
+            // The socket ran out of memory for completion notifications: the rest of the datagrams are copied
+            if (ENOBUFS == errno && 0 != flags)
+            {
+                flags = 0;
+                continue;
+            }
+#endif // if defined(FASTDDS_UDP_ZERO_COPY)
+
+            if ((EAGAIN == errno) || (EWOULDBLOCK == errno))
+            {
+                EPROSIMA_LOG_WARNING(RTPS_MSG_OUT, "UDP send would have blocked. Packet is dropped.");
+            }
+            else
+            {
+                EPROSIMA_LOG_WARNING(RTPS_MSG_OUT, "UDPTransport error sending to endpoint " << endpoints[next]
+                                                                                            << ": " << strerror(errno));
+                ret = false;
+            }
+
+            ++next;
+            continue;
+        }
+
+        for (size_t i = next; i < next + static_cast<size_t>(sent); ++i)
+        {
+            EPROSIMA_LOG_INFO(RTPS_MSG_OUT, "UDPTransport: " << headers[i].msg_len << " bytes TO endpoint: "
+                                                             << endpoints[i] << " FROM "
+                                                             << getSocketPtr(socket)->local_endpoint());
+        }
+        next += static_cast<size_t>(sent);
+#if defined(FASTDDS_UDP_ZERO_COPY)
+        if (0 != flags)
+        {
+            zero_copy_sends += static_cast<uint32_t>(sent);
+        }
+#endif // if defined(FASTDDS_UDP_ZERO_COPY)
+    }
+
+#if defined(FASTDDS_UDP_ZERO_COPY)
+    if (completions)
+    {
+        completions->sent += zero_copy_sends;
+        uint32_t target = completions->sent;
+        zero_copy_send_lock.unlock();
+        if (0 < zero_copy_sends && !wait_zero_copy_completions(fd, *completions, target))
+        {
+            reopen_output_socket(socket);
+        }
+    }
+#endif // if defined(FASTDDS_UDP_ZERO_COPY)
+
+    return ret;
+}
+
+bool UDPTransportInterface::use_zero_copy(
+        uint32_t size) const
+{
+#if defined(FASTDDS_UDP_ZERO_COPY)
+    return zero_copy_enabled_ && size >= configuration()->zero_copy_send_threshold;
+#else
+    static_cast<void>(size);
+    return false;
+#endif // if defined(FASTDDS_UDP_ZERO_COPY)
+}
+
+bool UDPTransportInterface::use_zero_copy(
+        const struct msghdr& msg) const
+{
+    size_t size = 0;
+    for (size_t i = 0; i < msg.msg_iovlen; ++i)
+    {
+        size += msg.msg_iov[i].iov_len;
+    }
+    return use_zero_copy(static_cast<uint32_t>(size));
+}
+
+#endif // if defined(__linux__)
+
+uint64_t UDPTransportInterface::zero_copy_completed_sends() const
+{
+    return zero_copy_completed_sends_;
+}
+
+#if defined(FASTDDS_UDP_ZERO_COPY)
+std::shared_ptr<UDPTransportInterface::ZeroCopyCompletions> UDPTransportInterface::zero_copy_completions(
+        int fd)
+{
+    std::lock_guard<std::mutex> guard(zero_copy_mutex_);
+    std::shared_ptr<ZeroCopyCompletions>& completions = zero_copy_completions_[fd];
+    if (!completions)
+    {
+        completions = std::make_shared<ZeroCopyCompletions>();
+    }
+    return completions;
+}
+
+void UDPTransportInterface::ZeroCopyCompletions::add_completed_range(
+        uint32_t first,
+        uint32_t last)
+{
+    if (first == completed)
+    {
+        completed = last + 1;
+    }
+    else
+    {
+        pending_ranges[first] = last;
+    }
+
+    auto it = pending_ranges.find(completed);
+    while (pending_ranges.end() != it)
+    {
+        completed = it->second + 1;
+        pending_ranges.erase(it);
+        it = pending_ranges.find(completed);
+    }
+}
+
+bool UDPTransportInterface::wait_zero_copy_completions(
+        int fd,
+        ZeroCopyCompletions& completions,
+        uint32_t target)
+{
+    // Send numbers wrap around, so they are compared by their distance
+    auto is_completed = [&completions, target]()
+            {
+                return 0 <= static_cast<int32_t>(completions.completed - target);
+            };
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(zero_copy_completion_timeout_ms);
+
+    std::unique_lock<std::mutex> lock(completions.mutex);
+    while (!is_completed())
+    {
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now());
+        if (0 >= remaining.count())
+        {
+            break;
+        }
+
+        if (completions.draining)
+        {
+            completions.cv.wait_until(lock, deadline);
+            continue;
+        }
+
+        completions.draining = true;
+        lock.unlock();
+
+        struct pollfd poll_fd;
+        poll_fd.fd = fd;
+        poll_fd.events = 0;
+        poll_fd.revents = 0;
+        int ready = poll(&poll_fd, 1, static_cast<int>(remaining.count()));
+
+        bool copied = false;
+        if (0 < ready)
+        {
+            // Large enough for the extended error and the offender address of both IPv4 and IPv6
+            char control[CMSG_SPACE(sizeof(struct sock_extended_err) + sizeof(struct sockaddr_in6))];
+            struct msghdr msg;
+            memset(&msg, 0, sizeof(msg));
+            msg.msg_control = control;
+            msg.msg_controllen = sizeof(control);
+            while (0 <= recvmsg(fd, &msg, MSG_ERRQUEUE | MSG_DONTWAIT))
+            {
+                for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); nullptr != cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg))
+                {
+                    if ((SOL_IP == cmsg->cmsg_level && IP_RECVERR == cmsg->cmsg_type) ||
+                            (SOL_IPV6 == cmsg->cmsg_level && IPV6_RECVERR == cmsg->cmsg_type))
+                    {
+                        struct sock_extended_err error;
+                        memcpy(&error, CMSG_DATA(cmsg), sizeof(error));
+                        if (0 == error.ee_errno && SO_EE_ORIGIN_ZEROCOPY == error.ee_origin)
+                        {
+                            zero_copy_completed_sends_ += error.ee_data - error.ee_info + 1;
+                            copied |= 0 != (error.ee_code & SO_EE_CODE_ZEROCOPY_COPIED);
+                            std::lock_guard<std::mutex> guard(completions.mutex);
+                            completions.add_completed_range(error.ee_info, error.ee_data);
+                        }
+                    }
+                }
+                msg.msg_controllen = sizeof(control);
+            }
+        }
+
+        if (copied)
+        {
+            EPROSIMA_LOG_INFO(RTPS_MSG_OUT, "UDP zero-copy send fell back to copying the data");
+        }
+
+        lock.lock();
+        completions.draining = false;
+        completions.cv.notify_all();
+    }
+
+    if (is_completed())
+    {
+        return true;
+    }
+
+    lock.unlock();
+    EPROSIMA_LOG_WARNING(RTPS_MSG_OUT, "Kernel did not release the buffer of a zero-copy send on time. "
+            "Disabling UDP zero-copy sends.");
+    zero_copy_enabled_ = false;
+    return false;
+}
+
+void UDPTransportInterface::reopen_output_socket(
+        eProsimaUDPSocket& socket)
+{
+    try
+    {
+        ip::udp::endpoint local_endpoint = getSocketPtr(socket)->local_endpoint();
+        int fd = getSocketPtr(socket)->native_handle();
+
+        asio::detail::socket_option::boolean<ASIO_OS_DEF(SOL_SOCKET), SO_REUSEPORT> reuse_port;
+        getSocketPtr(socket)->get_option(reuse_port);
+        ip::multicast::enable_loopback loopback;
+        getSocketPtr(socket)->get_option(loopback);
+
+        // Large enough for both the IPv4 address and the IPv6 interface index
+        int level = local_endpoint.address().is_v6() ? IPPROTO_IPV6 : IPPROTO_IP;
+        int name = local_endpoint.address().is_v6() ? IPV6_MULTICAST_IF : IP_MULTICAST_IF;
+        char outbound_interface[sizeof(struct in6_addr)];
+        socklen_t outbound_interface_size = sizeof(outbound_interface);
+        bool has_outbound_interface =
+                0 == getsockopt(fd, level, name, outbound_interface, &outbound_interface_size);
+
+        CloseOutputChannel(socket);
+
+        uint16_t port = local_endpoint.port();
+        eProsimaUDPSocket new_socket = OpenAndBindUnicastOutputSocket(local_endpoint, port, reuse_port.value());
+        getSocketPtr(new_socket)->set_option(loopback);
+        if (has_outbound_interface)
+        {
+            setsockopt(getSocketPtr(new_socket)->native_handle(), level, name, outbound_interface,
+                    outbound_interface_size);
+        }
+        socket = std::move(new_socket);
+
+        EPROSIMA_LOG_INFO(RTPS_MSG_OUT, "UDP output socket reopened on " << local_endpoint);
+    }
+    catch (const std::exception& error)
+    {
+        EPROSIMA_LOG_WARNING(RTPS_MSG_OUT, "UDP output socket could not be reopened: " << error.what());
+    }
+}
+
+#endif // if defined(FASTDDS_UDP_ZERO_COPY)
+
+bool UDPTransportInterface::send(
+        const octet* send_buffer,
+        uint32_t send_buffer_size,
+        eProsimaUDPSocket& socket,
+        const Locator& remote_locator,
+        bool only_multicast_purpose,
+        bool whitelisted,
+        const std::chrono::microseconds& timeout,
+        UDPConnectedSocketCache* connected_sockets)
 {
     using namespace eprosima::fastdds::statistics::rtps;
 
@@ -493,6 +1179,14 @@ bool UDPTransportInterface::send(
     {
         auto destinationEndpoint = generate_endpoint(remote_locator, IPLocator::getPhysicalPort(remote_locator));
 
+        // Hot unicast destinations are sent to through a socket connected to them
+        UDPConnectedSocketCache::SocketPtr connected_socket;
+        if (nullptr != connected_sockets && !is_multicast_remote_address)
+        {
+            connected_socket = connected_sockets->get(destinationEndpoint);
+        }
+        eProsimaUDPSocket& send_socket = connected_socket ? *connected_socket : socket;
+
         size_t bytesSent = 0;
 
         try
@@ -502,14 +1196,21 @@ bool UDPTransportInterface::send(
             struct timeval timeStruct;
             timeStruct.tv_sec = 0;
             timeStruct.tv_usec = timeout.count() > 0 ? timeout.count() : 0;
-            setsockopt(getSocketPtr(socket)->native_handle(), SOL_SOCKET, SO_SNDTIMEO,
+            setsockopt(getSocketPtr(send_socket)->native_handle(), SOL_SOCKET, SO_SNDTIMEO,
                     reinterpret_cast<const char*>(&timeStruct), sizeof(timeStruct));
 #endif // ifndef _WIN32
 
             asio::error_code ec;
             statistics_info_.set_statistics_message_data(remote_locator, send_buffer, send_buffer_size);
-            bytesSent = getSocketPtr(socket)->send_to(asio::buffer(send_buffer,
-                            send_buffer_size), destinationEndpoint, 0, ec);
+            if (connected_socket)
+            {
+                bytesSent = getSocketPtr(send_socket)->send(asio::buffer(send_buffer, send_buffer_size), 0, ec);
+            }
+            else
+            {
+                bytesSent = getSocketPtr(send_socket)->send_to(asio::buffer(send_buffer,
+                                send_buffer_size), destinationEndpoint, 0, ec);
+            }
             if (!!ec)
             {
                 if ((ec.value() == asio::error::would_block) ||
@@ -519,6 +1220,15 @@ bool UDPTransportInterface::send(
                     return true;
                 }
 
+                // Connected sockets report the unreachable destinations of previous datagrams, which unconnected
+                // ones ignore. The destination is given back to the unconnected socket.
+                if (connected_socket && ec.value() == asio::error::connection_refused)
+                {
+                    EPROSIMA_LOG_INFO(RTPS_MSG_OUT, "UDP destination " << destinationEndpoint << " unreachable");
+                    connected_sockets->remove(destinationEndpoint);
+                    return true;
+                }
+
                 EPROSIMA_LOG_WARNING(RTPS_MSG_OUT, ec.message());
                 return false;
             }
@@ -531,13 +1241,285 @@ bool UDPTransportInterface::send(
 
         (void)bytesSent;
         EPROSIMA_LOG_INFO(RTPS_MSG_OUT, "UDPTransport: " << bytesSent << " bytes TO endpoint: " << destinationEndpoint
-                                                         << " FROM " << getSocketPtr(socket)->local_endpoint());
+                                                         << " FROM " << getSocketPtr(send_socket)->local_endpoint());
         success = true;
     }
 
     return success;
 }
 
+bool UDPTransportInterface::send(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        const Locator& remote_locator,
+        bool only_multicast_purpose,
+        bool whitelisted,
+        const std::chrono::microseconds& timeout,
+        UDPConnectedSocketCache* connected_sockets)
+{
+    if (total_bytes > configuration()->sendBufferSize)
+    {
+        return false;
+    }
+
+    bool success = false;
+    bool is_multicast_remote_address = IPLocator::isMulticast(remote_locator);
+
+    if (is_multicast_remote_address == only_multicast_purpose || whitelisted)
+    {
+        auto destinationEndpoint = generate_endpoint(remote_locator, IPLocator::getPhysicalPort(remote_locator));
+
+        // Hot unicast destinations are sent to through a socket connected to them
+        UDPConnectedSocketCache::SocketPtr connected_socket;
+        if (nullptr != connected_sockets && !is_multicast_remote_address)
+        {
+            connected_socket = connected_sockets->get(destinationEndpoint);
+        }
+        eProsimaUDPSocket& send_socket = connected_socket ? *connected_socket : socket;
+
+        size_t bytesSent = 0;
+
+        try
+        {
+            (void)timeout;
+#ifndef _WIN32
+            struct timeval timeStruct;
+            timeStruct.tv_sec = 0;
+            timeStruct.tv_usec = timeout.count() > 0 ? timeout.count() : 0;
+            setsockopt(getSocketPtr(send_socket)->native_handle(), SOL_SOCKET, SO_SNDTIMEO,
+                    reinterpret_cast<const char*>(&timeStruct), sizeof(timeStruct));
+#endif // ifndef _WIN32
+
+            NetworkBufferSequence asio_buffers(buffers);
+
+            asio::error_code ec;
+            statistics_info_.set_statistics_message_data(remote_locator, buffers, total_bytes);
+            if (connected_socket)
+            {
+                bytesSent = getSocketPtr(send_socket)->send(asio_buffers, 0, ec);
+            }
+            else
+            {
+                bytesSent = getSocketPtr(send_socket)->send_to(asio_buffers, destinationEndpoint, 0, ec);
+            }
+            if (!!ec)
+            {
+                if ((ec.value() == asio::error::would_block) ||
+                        (ec.value() == asio::error::try_again))
+                {
+                    EPROSIMA_LOG_WARNING(RTPS_MSG_OUT, "UDP send would have blocked. Packet is dropped.");
+                    return true;
+                }
+
+                if (connected_socket && ec.value() == asio::error::connection_refused)
+                {
+                    EPROSIMA_LOG_INFO(RTPS_MSG_OUT, "UDP destination " << destinationEndpoint << " unreachable");
+                    connected_sockets->remove(destinationEndpoint);
+                    return true;
+                }
+
+                EPROSIMA_LOG_WARNING(RTPS_MSG_OUT, ec.message());
+                return false;
+            }
+        }
+        catch (const std::exception& error)
+        {
+            EPROSIMA_LOG_WARNING(RTPS_MSG_OUT, error.what());
+            return false;
+        }
+
+        (void)bytesSent;
+        EPROSIMA_LOG_INFO(RTPS_MSG_OUT, "UDPTransport: " << bytesSent << " bytes TO endpoint: " << destinationEndpoint
+                                                         << " FROM " << getSocketPtr(send_socket)->local_endpoint());
+        success = true;
+    }
+
+    return success;
+}
+
+bool UDPTransportInterface::send_segmented(
+        const octet* send_buffer,
+        uint32_t send_buffer_size,
+        uint32_t segment_size,
+        eProsimaUDPSocket& socket,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        bool only_multicast_purpose,
+        bool whitelisted,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    fastrtps::rtps::LocatorsIterator& it = *destination_locators_begin;
+
+    bool ret = true;
+
+    auto time_out = std::chrono::duration_cast<std::chrono::microseconds>(
+        max_blocking_time_point - std::chrono::steady_clock::now());
+
+    while (it != *destination_locators_end)
+    {
+        if (IsLocatorSupported(*it))
+        {
+            ret &= send_segmented(send_buffer,
+                            send_buffer_size,
+                            segment_size,
+                            socket,
+                            *it,
+                            only_multicast_purpose,
+                            whitelisted,
+                            time_out);
+        }
+
+        ++it;
+    }
+
+    return ret;
+}
+
+bool UDPTransportInterface::send_segmented(
+        const octet* send_buffer,
+        uint32_t send_buffer_size,
+        uint32_t segment_size,
+        eProsimaUDPSocket& socket,
+        const Locator& remote_locator,
+        bool only_multicast_purpose,
+        bool whitelisted,
+        const std::chrono::microseconds& timeout)
+{
+    if (0 == segment_size || send_buffer_size <= segment_size)
+    {
+        return send(send_buffer, send_buffer_size, socket, remote_locator, only_multicast_purpose, whitelisted,
+                       timeout);
+    }
+
+    if (segment_size > configuration()->maxMessageSize)
+    {
+        return false;
+    }
+
+#if defined(FASTDDS_UDP_SEGMENTATION_OFFLOAD)
+    if (send_buffer_size > configuration()->sendBufferSize)
+    {
+        return false;
+    }
+
+    bool is_multicast_remote_address = IPLocator::isMulticast(remote_locator);
+    if (is_multicast_remote_address != only_multicast_purpose && !whitelisted)
+    {
+        return false;
+    }
+
+    // Each segment carries its own statistics submessage
+    for (uint32_t offset = 0; offset < send_buffer_size; offset += segment_size)
+    {
+        statistics_info_.set_statistics_message_data(remote_locator, send_buffer + offset,
+                (std::min)(segment_size, send_buffer_size - offset));
+    }
+
+    auto destinationEndpoint = generate_endpoint(remote_locator, IPLocator::getPhysicalPort(remote_locator));
+    int fd = getSocketPtr(socket)->native_handle();
+
+    struct timeval timeStruct;
+    timeStruct.tv_sec = 0;
+    timeStruct.tv_usec = timeout.count() > 0 ? timeout.count() : 0;
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, reinterpret_cast<const char*>(&timeStruct), sizeof(timeStruct));
+
+    struct iovec iov;
+    iov.iov_base = const_cast<octet*>(send_buffer);
+    iov.iov_len = send_buffer_size;
+
+    char control[CMSG_SPACE(sizeof(uint16_t))] = {};
+    struct msghdr msg = {};
+    msg.msg_name = destinationEndpoint.data();
+    msg.msg_namelen = static_cast<socklen_t>(destinationEndpoint.size());
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_UDP;
+    cmsg->cmsg_type = UDP_SEGMENT;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+    uint16_t gso_size = static_cast<uint16_t>(segment_size);
+    memcpy(CMSG_DATA(cmsg), &gso_size, sizeof(gso_size));
+
+    int flags = 0;
+#if defined(FASTDDS_UDP_ZERO_COPY)
+    std::shared_ptr<ZeroCopyCompletions> completions;
+    std::unique_lock<std::mutex> zero_copy_send_lock;
+    if (use_zero_copy(send_buffer_size))
+    {
+        completions = zero_copy_completions(fd);
+        zero_copy_send_lock = std::unique_lock<std::mutex>(completions->send_mutex);
+        flags = MSG_ZEROCOPY;
+    }
+#endif // if defined(FASTDDS_UDP_ZERO_COPY)
+
+    ssize_t bytes_sent = 0;
+    do
+    {
+        bytes_sent = sendmsg(fd, &msg, flags);
+#if defined(FASTDDS_UDP_ZERO_COPY)
+        if (0 > bytes_sent && ENOBUFS == errno && 0 != flags)
+        {
+            // The socket ran out of memory for completion notifications: the data is copied
+            flags = 0;
+            bytes_sent = sendmsg(fd, &msg, flags);
+        }
+#endif // if defined(FASTDDS_UDP_ZERO_COPY)
+    } while (0 > bytes_sent && EINTR == errno);
+
+#if defined(FASTDDS_UDP_ZERO_COPY)
+    if (completions)
+    {
+        bool zero_copy_sent = 0 <= bytes_sent && 0 != flags;
+        int send_errno = errno;
+        completions->sent += zero_copy_sent ? 1 : 0;
+        uint32_t target = completions->sent;
+        zero_copy_send_lock.unlock();
+        if (zero_copy_sent && !wait_zero_copy_completions(fd, *completions, target))
+        {
+            reopen_output_socket(socket);
+        }
+        errno = send_errno;
+    }
+#endif // if defined(FASTDDS_UDP_ZERO_COPY)
+
+    if (0 <= bytes_sent)
+    {
+        EPROSIMA_LOG_INFO(RTPS_MSG_OUT, "UDPTransport: " << bytes_sent << " bytes in segments of " << segment_size
+                                                         << " TO endpoint: " << destinationEndpoint
+                                                         << " FROM " << getSocketPtr(socket)->local_endpoint());
+        return true;
+    }
+
+    if ((EAGAIN == errno) || (EWOULDBLOCK == errno))
+    {
+        EPROSIMA_LOG_WARNING(RTPS_MSG_OUT, "UDP send would have blocked. Packet is dropped.");
+        return true;
+    }
+
+    if ((EINVAL != errno) && (EIO != errno) && (EOPNOTSUPP != errno))
+    {
+        EPROSIMA_LOG_WARNING(RTPS_MSG_OUT, "UDPTransport error sending to endpoint " << destinationEndpoint
+                                                                                    << ": " << strerror(errno));
+        return false;
+    }
+
+    // Segmentation offload not available for this destination: fall back to one datagram per segment
+    EPROSIMA_LOG_INFO(RTPS_MSG_OUT, "UDP segmentation offload not available: " << strerror(errno));
+#endif // if defined(FASTDDS_UDP_SEGMENTATION_OFFLOAD)
+
+    bool ret = true;
+    for (uint32_t offset = 0; offset < send_buffer_size; offset += segment_size)
+    {
+        ret &= send(send_buffer + offset, (std::min)(segment_size, send_buffer_size - offset), socket,
+                        remote_locator, only_multicast_purpose, whitelisted, timeout);
+    }
+    return ret;
+}
+
 /**
  * Invalidate all selector entries containing certain multicast locator.
  *
@@ -15,13 +15,25 @@
 #ifndef _FASTDDS_UDP_TRANSPORT_INTERFACE_H_
 #define _FASTDDS_UDP_TRANSPORT_INTERFACE_H_
 
+#include <atomic>
+#include <condition_variable>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <vector>
 
+#if defined(__linux__)
+#include <sys/socket.h>
+#include <time.h>  // Needed by linux/errqueue.h
+#include <linux/errqueue.h>
+#if defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY) && defined(SO_EE_ORIGIN_ZEROCOPY)
+#define FASTDDS_UDP_ZERO_COPY 1
+#endif // if defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY) && defined(SO_EE_ORIGIN_ZEROCOPY)
+#endif // if defined(__linux__)
+
 #include <asio.hpp>
 
+#include <fastdds/rtps/transport/NetworkBuffer.hpp>
 #include <fastdds/rtps/transport/TransportInterface.h>
 #include <fastdds/rtps/transport/UDPTransportDescriptor.h>
 #include <fastrtps/utils/IPFinder.h>
@@ -33,6 +45,40 @@ namespace eprosima {
 namespace fastdds {
 namespace rtps {
 
+class UDPConnectedSocketCache;
+
+/**
+ * Memory used to prepare the datagrams of a batched send.
+ *
+ * It is kept by each output channel and reused on every send, so sending does not allocate memory once it has grown
+ * to the number of destinations of the channel. It should only be used by one send operation at a time.
+ */
+struct UDPBatchSendStorage
+{
+#if defined(__linux__)
+    //! Destinations of the message supported by the transport
+    std::vector<Locator> remote_locators;
+
+    //! Destinations the message is actually sent to
+    std::vector<const Locator*> destinations;
+
+    //! Endpoint of each destination
+    std::vector<asio::ip::udp::endpoint> endpoints;
+
+    //! Copy of the statistics submessage for each destination
+    std::vector<fastrtps::rtps::octet> tails;
+
+    //! Slices of the datagram for each destination
+    std::vector<struct iovec> iovecs;
+
+    //! Datagram for each destination
+    std::vector<struct mmsghdr> headers;
+
+    //! Single slice of the messages sent from a contiguous buffer
+    std::vector<NetworkBuffer> single_buffer;
+#endif // if defined(__linux__)
+};
+
 class UDPTransportInterface : public TransportInterface
 {
     friend class UDPSenderResource;
@@ -47,6 +93,11 @@ public:
     bool CloseInputChannel(
             const Locator&) override;
 
+    //! Removes the listening sockets of the specified port feeding the given receiver.
+    bool close_input_channel_shard(
+            const Locator& locator,
+            TransportReceiverInterface* receiver) override;
+
     //! Removes all outbound sockets on the given port.
     void CloseOutputChannel(
             eProsimaUDPSocket& socket);
@@ -65,6 +116,10 @@ public:
     bool IsInputChannelOpen(
             const Locator&) const override;
 
+    //! Reports the number of sockets that are opened with SO_REUSEPORT on the given input locator.
+    uint32_t input_channel_shards(
+            const Locator&) const override;
+
     //! Checks for TCP kinds.
     bool IsLocatorSupported(
             const Locator&) const override;
@@ -116,12 +171,79 @@ public:
      * @param only_multicast_purpose multicast network interface
      * @param whitelisted network interface included in the user whitelist
      * @param max_blocking_time_point maximum blocking time.
+     * @param connected_sockets sockets connected to the most used destinations of the channel, if any.
+     * @param batch_storage memory of the channel reused to send to several destinations, if any.
+     *
+     * @pre Open the output channel of each remote locator by invoking \ref OpenOutputChannel function.
+     */
+    virtual bool send(
+            const fastrtps::rtps::octet* send_buffer,
+            uint32_t send_buffer_size,
+            eProsimaUDPSocket& socket,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end,
+            bool only_multicast_purpose,
+            bool whitelisted,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point,
+            UDPConnectedSocketCache* connected_sockets = nullptr,
+            UDPBatchSendStorage* batch_storage = nullptr);
+
+    /**
+     * Blocking Send of a message, given as a list of slices, through the specified channel.
+     * The slices are handed to the kernel as a single datagram without being copied into a single buffer first.
+     *
+     * @param buffers Slices of the message to send.
+     * @param total_bytes Size of the message. Sum of the sizes of the slices.
+     * It must not exceed the send_buffer_size fed to this class during construction.
+     * @param socket channel we're sending from.
+     * @param destination_locators_begin pointer to destination locators iterator begin, the iterator can be advanced inside this fuction
+     * so should not be reuse.
+     * @param destination_locators_end pointer to destination locators iterator end, the iterator can be advanced inside this fuction
+     * so should not be reuse.
+     * @param only_multicast_purpose multicast network interface
+     * @param whitelisted network interface included in the user whitelist
+     * @param max_blocking_time_point maximum blocking time.
+     * @param connected_sockets sockets connected to the most used destinations of the channel, if any.
+     * @param batch_storage memory of the channel reused to send to several destinations, if any.
      *
      * @pre Open the output channel of each remote locator by invoking \ref OpenOutputChannel function.
      */
     virtual bool send(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            eProsimaUDPSocket& socket,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end,
+            bool only_multicast_purpose,
+            bool whitelisted,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point,
+            UDPConnectedSocketCache* connected_sockets = nullptr,
+            UDPBatchSendStorage* batch_storage = nullptr);
+
+    /**
+     * Blocking Send of several RTPS messages, stored consecutively on a buffer, through the specified channel.
+     * When segmentation offload is enabled, the messages are handed to the kernel with a single system call per
+     * destination. Otherwise, they are sent one by one.
+     *
+     * @param send_buffer Slice into the raw data to send.
+     * @param send_buffer_size Size of the raw data.
+     * @param segment_size Size of each message on the buffer. The last one may be shorter.
+     * It must not exceed the maxMessageSize of this transport.
+     * @param socket channel we're sending from.
+     * @param destination_locators_begin pointer to destination locators iterator begin, the iterator can be advanced inside this fuction
+     * so should not be reuse.
+     * @param destination_locators_end pointer to destination locators iterator end, the iterator can be advanced inside this fuction
+     * so should not be reuse.
+     * @param only_multicast_purpose multicast network interface
+     * @param whitelisted network interface included in the user whitelist
+     * @param max_blocking_time_point maximum blocking time.
+     *
+     * @pre Open the output channel of each remote locator by invoking \ref OpenOutputChannel function.
+     */
+    bool send_segmented(
             const fastrtps::rtps::octet* send_buffer,
             uint32_t send_buffer_size,
+            uint32_t segment_size,
             eProsimaUDPSocket& socket,
             fastrtps::rtps::LocatorsIterator* destination_locators_begin,
             fastrtps::rtps::LocatorsIterator* destination_locators_end,
@@ -172,9 +294,13 @@ public:
 
     bool is_localhost_allowed() const override;
 
+    //! Number of zero-copy sends whose completion has been notified by the kernel.
+    uint64_t zero_copy_completed_sends() const;
+
 protected:
 
     friend class UDPChannelResource;
+    friend class UDPUringChannelResource;
 
     // For UDPv6, the notion of channel corresponds to a port + direction tuple.
     asio::io_service io_service_;
@@ -243,7 +369,29 @@ protected:
             TransportReceiverInterface* receiver,
             bool is_multicast,
             uint32_t maxMsgSize);
-    UDPChannelResource* CreateInputChannelResource(
+
+    /**
+     * Opens an additional shard of an already open unicast input channel, i.e. another set of sockets bound with
+     * SO_REUSEPORT to the same port, feeding the given receiver from their own listening threads.
+     *
+     * @return false if all the configured shards are already open, or the sockets could not be bound.
+     */
+    bool OpenAndBindInputShard(
+            const Locator& locator,
+            TransportReceiverInterface* receiver,
+            uint32_t maxMsgSize);
+
+    //! Number of sockets to open on each unicast input port, as honored on the current platform.
+    uint32_t configured_receive_shards() const;
+
+    /**
+     * Whether the input sockets being opened on the given port are additional shards of a channel already open.
+     * Should be called with mInputMapMutex locked.
+     */
+    bool is_input_shard(
+            uint16_t port) const;
+
+    virtual UDPChannelResource* CreateInputChannelResource(
             const std::string& sInterface,
             const Locator& locator,
             bool is_multicast,
@@ -253,9 +401,14 @@ protected:
             const std::string& sIp,
             uint16_t port,
             bool is_multicast) = 0;
+    /**
+     * Opens an output socket bound to the given endpoint.
+     * @param reuse_port Whether the socket joins a port other sockets let in with SO_REUSEPORT. Only on Linux.
+     */
     eProsimaUDPSocket OpenAndBindUnicastOutputSocket(
             const asio::ip::udp::endpoint& endpoint,
-            uint16_t& port);
+            uint16_t& port,
+            bool reuse_port = false);
 
     virtual void set_receive_buffer_size(
             uint32_t size) = 0;
@@ -266,7 +419,18 @@ protected:
             const std::string&) = 0;
 
     /**
-     * Send a buffer to a destination
+     * Opens a socket connected to a unicast destination, bound to the same local address and port as an output
+     * socket, so the destination receives the datagrams from the same source port whichever socket sends them.
+     * @pre The output socket lets other sockets join its port with SO_REUSEPORT.
+     * @return nullptr if the socket could not be opened.
+     */
+    std::shared_ptr<eProsimaUDPSocket> OpenConnectedOutputSocket(
+            const eProsimaUDPSocket& output_socket,
+            const asio::ip::udp::endpoint& destination);
+
+    /**
+     * Send a buffer to a destination.
+     * When a socket connected to the destination is available on connected_sockets, it is used instead of socket.
      */
     bool send(
             const fastrtps::rtps::octet* send_buffer,
@@ -275,8 +439,176 @@ protected:
             const Locator& remote_locator,
             bool only_multicast_purpose,
             bool whitelisted,
+            const std::chrono::microseconds& timeout,
+            UDPConnectedSocketCache* connected_sockets = nullptr);
+
+    /**
+     * Send a message, given as a list of slices, to a destination.
+     * When a socket connected to the destination is available on connected_sockets, it is used instead of socket.
+     */
+    bool send(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            eProsimaUDPSocket& socket,
+            const Locator& remote_locator,
+            bool only_multicast_purpose,
+            bool whitelisted,
+            const std::chrono::microseconds& timeout,
+            UDPConnectedSocketCache* connected_sockets = nullptr);
+
+    /**
+     * Send several messages, stored consecutively on a buffer, to a destination
+     */
+    bool send_segmented(
+            const fastrtps::rtps::octet* send_buffer,
+            uint32_t send_buffer_size,
+            uint32_t segment_size,
+            eProsimaUDPSocket& socket,
+            const Locator& remote_locator,
+            bool only_multicast_purpose,
+            bool whitelisted,
             const std::chrono::microseconds& timeout);
 
+#if defined(__linux__)
+    /**
+     * Send a buffer to several destinations with a single system call (sendmmsg).
+     *
+     * The result for each destination is evaluated individually: a failure sending to one of them is reported
+     * and does not prevent the buffer from being sent to the rest. The datagrams are prepared on @c storage.
+     *
+     * @return true when the buffer was sent to all the destinations, false otherwise.
+     */
+    bool send_batch(
+            const fastrtps::rtps::octet* send_buffer,
+            uint32_t send_buffer_size,
+            eProsimaUDPSocket& socket,
+            const std::vector<Locator>& remote_locators,
+            bool only_multicast_purpose,
+            bool whitelisted,
+            const std::chrono::microseconds& timeout,
+            UDPConnectedSocketCache* connected_sockets,
+            UDPBatchSendStorage& storage);
+
+    /**
+     * Send a message, given as a list of slices, to several destinations with a single system call (sendmmsg).
+     * The datagrams are prepared on @c storage.
+     *
+     * @return true when the message was sent to all the destinations, false otherwise.
+     */
+    bool send_batch(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            eProsimaUDPSocket& socket,
+            const std::vector<Locator>& remote_locators,
+            bool only_multicast_purpose,
+            bool whitelisted,
+            const std::chrono::microseconds& timeout,
+            UDPConnectedSocketCache* connected_sockets,
+            UDPBatchSendStorage& storage);
+
+    /**
+     * Send the datagrams prepared by send_batch.
+     *
+     * @param socket Socket used to send the datagrams.
+     * @param headers Datagrams to send.
+     * @param endpoints Destination of each datagram.
+     * @param timeout Maximum blocking time.
+     *
+     * @return false when any of the datagrams failed to be sent for a reason other than the socket being full.
+     */
+    virtual bool send_datagrams(
+            eProsimaUDPSocket& socket,
+            std::vector<struct mmsghdr>& headers,
+            const std::vector<asio::ip::udp::endpoint>& endpoints,
+            const std::chrono::microseconds& timeout);
+
+    //! Whether a send operation of the given size should avoid copying the data into the kernel.
+    bool use_zero_copy(
+            uint32_t size) const;
+
+    //! Whether the given message should be sent avoiding copying its data into the kernel.
+    bool use_zero_copy(
+            const struct msghdr& msg) const;
+
+    //! Destinations needed for a message to be sent through send_datagrams instead of one send per destination
+    size_t min_batch_destinations_ = 2;
+#endif // if defined(__linux__)
+
+#if defined(FASTDDS_UDP_ZERO_COPY)
+    /**
+     * Completion state of the zero-copy sends of an output socket.
+     *
+     * The kernel numbers the zero-copy sends of a socket consecutively and notifies their completion, in ranges,
+     * on the socket error queue. Each sender waits for its own sends only, while one of the waiting senders at a
+     * time drains the error queue on behalf of all of them.
+     */
+    struct ZeroCopyCompletions
+    {
+        //! Held during the zero-copy system calls on the socket, so the number given to each send is known
+        std::mutex send_mutex;
+
+        //! Number of zero-copy sends performed on the socket. Protected by send_mutex.
+        uint32_t sent = 0;
+
+        std::mutex mutex;
+
+        std::condition_variable cv;
+
+        //! Every send numbered below this one has completed
+        uint32_t completed = 0;
+
+        //! Completed ranges of sends, as first and last numbers, still preceded by uncompleted sends
+        std::map<uint32_t, uint32_t> pending_ranges;
+
+        //! Whether a sender is draining the error queue
+        bool draining = false;
+
+        //! Records the completion of the sends numbered from @c first to @c last. Called with mutex held.
+        void add_completed_range(
+                uint32_t first,
+                uint32_t last);
+    };
+
+    //! Completion state of the zero-copy sends of the given socket, created on first use.
+    std::shared_ptr<ZeroCopyCompletions> zero_copy_completions(
+            int fd);
+
+    /**
+     * Waits until the kernel has released the buffers of every zero-copy send numbered below @c target, for
+     * zero_copy_completion_timeout_ms at most.
+     *
+     * When the notifications do not arrive on time, zero-copy sends are disabled, so later sends neither wait nor
+     * pin the caller buffers.
+     *
+     * @return false when the wait timed out. The caller should then reopen the socket with reopen_output_socket.
+     */
+    bool wait_zero_copy_completions(
+            int fd,
+            ZeroCopyCompletions& completions,
+            uint32_t target);
+
+    /**
+     * Closes an output socket whose zero-copy sends did not complete on time and opens a new one bound to the same
+     * address, port and multicast options, dropping its pending notifications.
+     *
+     * Sends through the socket are serialized by the participant, so it is not in use by other threads.
+     */
+    void reopen_output_socket(
+            eProsimaUDPSocket& socket);
+
+    //! Whether send operations above the configured threshold use MSG_ZEROCOPY
+    std::atomic_bool zero_copy_enabled_ = {false};
+
+    //! Protects zero_copy_completions_
+    std::mutex zero_copy_mutex_;
+
+    //! Completion state of the zero-copy sends of each output socket
+    std::map<int, std::shared_ptr<ZeroCopyCompletions>> zero_copy_completions_;
+#endif // if defined(FASTDDS_UDP_ZERO_COPY)
+
+    //! Number of zero-copy sends whose completion has been notified by the kernel
+    std::atomic<uint64_t> zero_copy_completed_sends_ = {0};
+
     /**
      * @brief Return list of not yet open network interfaces
      *
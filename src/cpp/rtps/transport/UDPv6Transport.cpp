@@ -304,6 +304,18 @@ eProsimaUDPSocket UDPv6Transport::OpenAndBindInputSocket(
         getSocketPtr(socket)->set_option(socket_base::receive_buffer_size(mReceiveBufferSize));
     }
 
+#if defined(__linux__)
+    // Shards of a unicast port join it with SO_REUSEPORT. The first socket binds the port exclusively and then lets
+    // the shards in, so a port in use by another participant is never shared.
+    bool reuse_port = !is_multicast && 1 < configured_receive_shards();
+    bool is_first_shard = reuse_port && !is_input_shard(port);
+    if (reuse_port && !is_first_shard)
+    {
+        getSocketPtr(socket)->set_option(asio::detail::socket_option::boolean<
+                    ASIO_OS_DEF(SOL_SOCKET), SO_REUSEPORT>(true));
+    }
+#endif // if defined(__linux__)
+
     if (is_multicast)
     {
         getSocketPtr(socket)->set_option(ip::udp::socket::reuse_address(true));
@@ -322,6 +334,14 @@ eProsimaUDPSocket UDPv6Transport::OpenAndBindInputSocket(
 
     getSocketPtr(socket)->bind(generate_endpoint(sIp, port));
 
+#if defined(__linux__)
+    if (is_first_shard)
+    {
+        getSocketPtr(socket)->set_option(asio::detail::socket_option::boolean<
+                    ASIO_OS_DEF(SOL_SOCKET), SO_REUSEPORT>(true));
+    }
+#endif // if defined(__linux__)
+
     return socket;
 }
 
@@ -342,6 +362,11 @@ bool UDPv6Transport::OpenInputChannel(
     {
         success = OpenAndBindInputSockets(locator, receiver, IPLocator::isMulticast(locator), maxMsgSize);
     }
+    else if (!IPLocator::isMulticast(locator))
+    {
+        // Additional receivers of a unicast channel get their own sockets when sharding is enabled
+        success = OpenAndBindInputShard(locator, receiver, maxMsgSize);
+    }
 
     if (IPLocator::isMulticast(locator) && IsInputChannelOpen(locator))
     {
@@ -136,6 +136,64 @@ public:
             return (counter == 1);
         }
 
+        /**
+         * Pops several consecutive cells, starting at the read pointer.
+         * The free cells are incremented once for all the cells whose ref_counter reaches 0.
+         * @param [out] data array where the elements of the popped cells are copied.
+         * @param [out] was_cell_freed array where is stored, for each popped cell, whether its ref_counter is 0
+         * after pop.
+         * @param max_count maximum number of cells to pop. Both arrays should have room for them.
+         * @return the number of cells popped, 0 if the buffer is empty.
+         */
+        uint32_t pop(
+                T* data,
+                bool* was_cell_freed,
+                uint32_t max_count)
+        {
+            auto pointer = buffer_.node_->pointer_.load(std::memory_order_relaxed);
+
+            uint32_t count = 0;
+            uint32_t freed_cells = 0;
+            while (count < max_count && read_p_ != pointer.ptr.write_p)
+            {
+                auto& cell = buffer_.cells_[get_pointer_value(read_p_)];
+
+                // The cell is reserved but not written yet
+                if (cell.ref_counter() == 0)
+                {
+                    break;
+                }
+
+                // The element is copied before releasing the cell
+                data[count] = cell.data();
+
+                auto counter = cell.ref_counter_.fetch_sub(1);
+                assert(counter > 0);
+
+                was_cell_freed[count] = (counter == 1);
+                if (counter == 1)
+                {
+                    freed_cells++;
+                }
+
+                read_p_ = buffer_.inc_pointer(read_p_);
+                count++;
+            }
+
+            if (freed_cells > 0)
+            {
+                pointer = buffer_.node_->pointer_.load(std::memory_order_relaxed);
+                while (!buffer_.node_->pointer_.compare_exchange_weak(pointer,
+                        { { pointer.ptr.write_p, pointer.ptr.free_cells + freed_cells } },
+                        std::memory_order_release,
+                        std::memory_order_relaxed))
+                {
+                }
+            }
+
+            return count;
+        }
+
     private:
 
         MultiProducerConsumerRingBuffer<T>& buffer_;
@@ -238,6 +296,59 @@ public:
         return true;
     }
 
+    /**
+     * Push several elements into the buffer, reserving all their cells with a single update of the write pointer.
+     * The elements are enqueued consecutively and in order, even with other producers pushing concurrently.
+     * @param data array with the elements to push.
+     * @param count number of elements to push.
+     * @return true if there are listeners registered, false if no listeners => elements not enqueued
+     * @throw std::runtime_error if the buffer has not room for all the elements. None of them is enqueued then.
+     */
+    bool push(
+            const T* data,
+            uint32_t count)
+    {
+        // If no listeners the buffers are dropped
+        if (node_->registered_listeners_ == 0)
+        {
+            return false;
+        }
+
+        if (count == 0)
+        {
+            return true;
+        }
+
+        auto pointer = node_->pointer_.load(std::memory_order_relaxed);
+
+        // if enough free cells, increase the write pointer and decrease the free cells
+        while (pointer.ptr.free_cells >= count &&
+                !node_->pointer_.compare_exchange_weak(pointer,
+                { { add_pointer(pointer.ptr.write_p, count), pointer.ptr.free_cells - count } },
+                std::memory_order_release,
+                std::memory_order_relaxed))
+        {
+        }
+
+        if (pointer.ptr.free_cells < count)
+        {
+            throw std::runtime_error("Buffer full");
+        }
+
+        uint32_t write_p = pointer.ptr.write_p;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            auto& cell = cells_[get_pointer_value(write_p)];
+
+            cell.data(data[i]);
+            cell.ref_counter_.store(node_->registered_listeners_, std::memory_order_release);
+
+            write_p = inc_pointer(write_p);
+        }
+
+        return true;
+    }
+
     bool is_buffer_full()
     {
         return (node_->pointer_.load(std::memory_order_relaxed).ptr.free_cells == 0);
@@ -342,6 +453,26 @@ private:
         return (loop_flag << 31) | value;
     }
 
+    uint32_t add_pointer(
+            const uint32_t pointer,
+            uint32_t count) const
+    {
+        uint32_t value = pointer & 0x7FFFFFFF;
+        uint32_t loop_flag = pointer >> 31;
+
+        // count is never greater than total_cells_
+        value += count;
+
+        if (value >= node_->total_cells_)
+        {
+            value -= node_->total_cells_;
+            loop_flag ^= 1;
+        }
+
+        // Bit 31 is loop_flag, 0-30 are value
+        return (loop_flag << 31) | value;
+    }
+
     uint32_t pointer_to_head(
             const PtrType& pointer) const
     {
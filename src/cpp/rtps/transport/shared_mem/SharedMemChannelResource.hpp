@@ -42,10 +42,12 @@ public:
             const std::string& dump_file,
             const ThreadSettings& dump_thr_config,
             bool should_init_thread,
-            const ThreadSettings& thr_config)
+            const ThreadSettings& thr_config,
+            uint32_t busy_poll_budget_us = 0)
         : ChannelResource()
         , message_receiver_(receiver)
         , listener_(listener)
+        , busy_poll_budget_(busy_poll_budget_us)
         , only_multicast_purpose_(false)
         , locator_(locator)
     {
@@ -189,6 +191,11 @@ protected:
 
         try
         {
+            if (0 < busy_poll_budget_.count())
+            {
+                listener_->busy_poll(busy_poll_budget_);
+            }
+
             return listener_->pop();
         }
         catch (const std::exception& error)
@@ -212,6 +219,9 @@ protected:
 
     std::shared_ptr<SharedMemManager::Listener> listener_;
 
+    //! Time polling the port before blocking on it
+    std::chrono::microseconds busy_poll_budget_;
+
 private:
 
     bool only_multicast_purpose_;
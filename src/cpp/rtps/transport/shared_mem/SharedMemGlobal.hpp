@@ -16,11 +16,13 @@
 #define _FASTDDS_SHAREDMEM_GLOBAL_H_
 
 #include <algorithm>
+#include <cassert>
 #include <vector>
 #include <mutex>
 #include <memory>
 #include <thread>
 
+#include <utils/shared_memory/SharedMemFutex.hpp>
 #include <utils/shared_memory/SharedMemSegment.hpp>
 #include <utils/shared_memory/RobustExclusiveLock.hpp>
 #include <utils/shared_memory/RobustSharedLock.hpp>
@@ -91,13 +93,16 @@ public:
     typedef MultiProducerConsumerRingBuffer<BufferDescriptor>::Listener Listener;
     typedef MultiProducerConsumerRingBuffer<BufferDescriptor>::Cell PortCell;
 
-    static const uint32_t CURRENT_ABI_VERSION = 5;
+    static const uint32_t CURRENT_ABI_VERSION = 6;
 
     struct PortNode
     {
         alignas(8) std::atomic<std::chrono::high_resolution_clock::rep> last_listeners_status_check_time_ms;
         alignas(8) std::atomic<uint32_t> ref_counter;
 
+        // Incremented when the waiting listeners are notified. On Linux they sleep on it with a futex.
+        alignas(4) std::atomic<uint32_t> notification_counter;
+
         SharedMemSegment::Offset buffer;
         SharedMemSegment::Offset buffer_node;
 
@@ -121,6 +126,9 @@ public:
         // Number of listeners this port supports
         static constexpr size_t LISTENERS_STATUS_SIZE = 1024;
 
+        // Maximum number of descriptors a listener pops from the port at once
+        static constexpr uint32_t LISTENER_POP_BATCH_SIZE = 8;
+
         // Status of each listener
         struct ListenerStatus
         {
@@ -130,6 +138,9 @@ public:
                 , is_processing(0)
                 , counter(0)
                 , last_verified_counter(0)
+                , popped_cells_freed()
+                , popped_index(0)
+                , popped_count(0)
             {
             }
 
@@ -152,6 +163,13 @@ public:
             // Descriptor of the message the listener is processing
             // Valid only if is_processing is true.
             BufferDescriptor descriptor;
+
+            // Descriptors popped at once by the listener, the ones from popped_index to popped_count
+            // not handed out yet. The listener holds the enqueued count of the ones whose cell was freed.
+            BufferDescriptor popped_descriptors[LISTENER_POP_BATCH_SIZE];
+            bool popped_cells_freed[LISTENER_POP_BATCH_SIZE];
+            uint8_t popped_index;
+            uint8_t popped_count;
         };
         ListenerStatus listeners_status[LISTENERS_STATUS_SIZE];
 
@@ -180,20 +198,106 @@ public:
         std::unique_ptr<RobustExclusiveLock> read_exclusive_lock_;
         std::unique_ptr<RobustSharedLock> read_shared_lock_;
 
+        //! Adaptive number of checks of the port a listener performs before sleeping on it
+        std::atomic<uint32_t> spin_iterations_{256};
+
         inline void notify_unicast(
                 bool was_buffer_empty_before_push)
         {
             if (was_buffer_empty_before_push)
             {
+#if defined(__linux__)
+                futex_wake(&node_->notification_counter, 1);
+#else
                 node_->empty_cv.notify_one();
+#endif // if defined(__linux__)
             }
         }
 
         inline void notify_multicast()
         {
+#if defined(__linux__)
+            futex_wake(&node_->notification_counter);
+#else
             node_->empty_cv.notify_all();
+#endif // if defined(__linux__)
+        }
+
+#if defined(__linux__)
+        /**
+         * Check the port for a while before sleeping on it.
+         * The number of checks grows while data arrives during them, and shrinks otherwise.
+         * @return true if the listener has data to pop or has been closed.
+         */
+        bool spin_for_data(
+                Listener& listener,
+                const std::atomic<bool>& is_listener_closed)
+        {
+            // Spinning on a single core only delays the writer the listener waits for
+            static const bool can_spin = std::thread::hardware_concurrency() > 1;
+            if (!can_spin)
+            {
+                return false;
+            }
+
+            constexpr uint32_t min_spin_iterations = 16;
+            constexpr uint32_t max_spin_iterations = 4096;
+
+            uint32_t iterations = spin_iterations_.load(std::memory_order_relaxed);
+            for (uint32_t i = 0; i < iterations; ++i)
+            {
+                if (is_listener_closed.load() || listener.head() != nullptr)
+                {
+                    spin_iterations_.store((std::min)(iterations * 2, max_spin_iterations),
+                            std::memory_order_relaxed);
+                    return true;
+                }
+            }
+
+            spin_iterations_.store((std::max)(iterations / 2, min_spin_iterations), std::memory_order_relaxed);
+            return false;
+        }
+
+        /**
+         * Sleep on the notification counter of the port until the listener has data to pop or is closed.
+         * The listener status is refreshed every port_wait_timeout_ms, as with the condition variable.
+         * Should be called with the port mutex taken and the listener accounted as waiting.
+         */
+        void wait_notification(
+                std::unique_lock<SharedMemSegment::mutex>& lock,
+                Listener& listener,
+                const std::atomic<bool>& is_listener_closed,
+                PortNode::ListenerStatus& status)
+        {
+            auto wait_timeout = std::chrono::milliseconds(node_->port_wait_timeout_ms);
+            auto deadline = std::chrono::steady_clock::now() + wait_timeout;
+
+            while (!is_listener_closed.load() && listener.head() == nullptr)
+            {
+                auto now = std::chrono::steady_clock::now();
+                if (now >= deadline)
+                {
+                    if (!node_->is_port_ok)
+                    {
+                        throw std::runtime_error("port marked as not ok");
+                    }
+
+                    status.counter = status.last_verified_counter + 1;
+                    deadline = now + wait_timeout;
+                }
+
+                // Writers change the counter with the mutex taken, so a push after this read wakes the listener,
+                // or makes the futex return straight away.
+                uint32_t notification = node_->notification_counter.load(std::memory_order_relaxed);
+                lock.unlock();
+                futex_wait(&node_->notification_counter, notification,
+                        std::chrono::duration_cast<std::chrono::microseconds>(deadline - now));
+                lock.lock();
+            }
         }
 
+#endif // if defined(__linux__)
+
         /**
          * Singleton task, for SharedMemWatchdog, that periodically checks all opened ports
          * to verify if some listener is dead.
@@ -521,6 +625,24 @@ public:
         bool try_push(
                 const BufferDescriptor& buffer_descriptor,
                 bool* listeners_active)
+        {
+            return try_push(&buffer_descriptor, 1, listeners_active);
+        }
+
+        /**
+         * Try to enqueue several buffer descriptors in the port, taking the port mutex and notifying
+         * the listeners only once.
+         * If the port queue has not room for all the descriptors, none of them is enqueued and
+         * returns inmediatelly with false value.
+         * @param[in] buffer_descriptors array with the buffer descriptors to be enqueued, in order.
+         * @param[in] count number of buffer descriptors to be enqueued.
+         * @param[out] listeners_active false if no active listeners => buffers not enqueued
+         * @return false in overflow case, true otherwise.
+         */
+        bool try_push(
+                const BufferDescriptor* buffer_descriptors,
+                uint32_t count,
+                bool* listeners_active)
         {
             std::unique_lock<SharedMemSegment::mutex> lock_empty(node_->empty_cv_mutex);
 
@@ -535,7 +657,14 @@ public:
                 bool was_buffer_empty_before_push = buffer_->is_buffer_empty();
                 bool was_someone_listening = (node_->waiting_count > 0);
 
-                *listeners_active = buffer_->push(buffer_descriptor);
+                *listeners_active = buffer_->push(buffer_descriptors, count);
+
+#if defined(__linux__)
+                if (was_someone_listening)
+                {
+                    node_->notification_counter.fetch_add(1, std::memory_order_relaxed);
+                }
+#endif // if defined(__linux__)
 
                 lock_empty.unlock();
 
@@ -573,6 +702,14 @@ public:
                 const std::atomic<bool>& is_listener_closed,
                 uint32_t listener_index)
         {
+#if defined(__linux__)
+            // Data pushed shortly after the port got empty is taken without sleeping
+            if (spin_for_data(listener, is_listener_closed))
+            {
+                return;
+            }
+#endif // if defined(__linux__)
+
             try
             {
                 std::unique_lock<SharedMemSegment::mutex> lock(node_->empty_cv_mutex);
@@ -588,6 +725,9 @@ public:
                 status.counter = status.last_verified_counter + 1;
                 node_->waiting_count++;
 
+#if defined(__linux__)
+                wait_notification(lock, listener, is_listener_closed, status);
+#else
                 do
                 {
                     boost::system_time const timeout =
@@ -610,6 +750,7 @@ public:
                         status.counter = status.last_verified_counter + 1;
                     }
                 } while (1);
+#endif // if defined(__linux__)
 
                 node_->waiting_count--;
                 status.is_waiting = 0;
@@ -676,7 +817,13 @@ public:
                 {
                     std::lock_guard<SharedMemSegment::mutex> lock(node_->empty_cv_mutex);
                     is_listener_closed->exchange(true);
+#if defined(__linux__)
+                    node_->notification_counter.fetch_add(1, std::memory_order_relaxed);
+#endif // if defined(__linux__)
                 }
+#if defined(__linux__)
+                futex_wake(&node_->notification_counter);
+#endif // if defined(__linux__)
                 node_->empty_cv.notify_all();
             }
             catch (const boost::interprocess::interprocess_exception& /*e*/)
@@ -699,6 +846,36 @@ public:
             was_cell_freed = listener.pop();
         }
 
+        /**
+         * Removes several buffer-descriptors from the head of the listener's queue at once.
+         * They are kept on the listener status until handed out, so the enqueued count of their buffers
+         * can be recovered if the listener is frozen.
+         * @param [in] listener reference to the listener that will pop the buffer descriptors.
+         * @param [in] listener_index The index of the listener as returned by create_listener.
+         * @param [out] buffer_descriptors array where the popped buffer descriptors are copied, in order.
+         * @param [out] was_cell_freed array where is stored, for each buffer descriptor, whether the port's cell
+         * is freed because all listeners has poped the cell
+         * @param [in] max_count maximum number of buffer descriptors to pop, up to LISTENER_POP_BATCH_SIZE.
+         * @return the number of buffer descriptors popped, 0 if the listener's queue is empty.
+         */
+        uint32_t pop(
+                Listener& listener,
+                uint32_t listener_index,
+                BufferDescriptor* buffer_descriptors,
+                bool* was_cell_freed,
+                uint32_t max_count)
+        {
+            assert(max_count <= PortNode::LISTENER_POP_BATCH_SIZE);
+
+            uint32_t count = listener.pop(buffer_descriptors, was_cell_freed, max_count);
+            if (0 < count)
+            {
+                listener_popped(listener_index, buffer_descriptors, was_cell_freed, count);
+            }
+
+            return count;
+        }
+
         /**
          * Register a new listener
          * The new listener's read pointer is equal to the ring-buffer write pointer at the registering moment.
@@ -730,6 +907,8 @@ public:
                 *listener_index = i;
                 node_->listeners_status[i].is_in_use = true;
                 node_->listeners_status[i].is_processing = false;
+                node_->listeners_status[i].popped_index = 0;
+                node_->listeners_status[i].popped_count = 0;
                 node_->num_listeners++;
                 listener = buffer_->register_listener();
             }
@@ -812,21 +991,93 @@ public:
             return false;
         }
 
+        /**
+         * The intention of this method is to locate all buffer descriptors popped by a listener and not handed out
+         * yet, whose enqueued count is held by the listener, when the port is found to be zombie.
+         * This method should be called iteratively until the return value is false
+         * (there is no popped descriptor remaining).
+         *
+         * \pre Current port is zombie, as reported by is_zombie()
+         *
+         * @param[OUT] buffer_descriptor Descriptor of the first buffer popped and not handed out by a listener
+         * @return True if there was at least one popped descriptor. False if not.
+         */
+        bool get_and_remove_blocked_popped(
+                BufferDescriptor& buffer_descriptor)
+        {
+            try
+            {
+                std::lock_guard<SharedMemSegment::mutex> lock(node_->empty_cv_mutex);
+                for (uint32_t i = 0; i < PortNode::LISTENERS_STATUS_SIZE; i++)
+                {
+                    auto& status = node_->listeners_status[i];
+                    while (status.is_in_use && status.popped_index < status.popped_count)
+                    {
+                        uint8_t index = status.popped_index++;
+                        if (status.popped_cells_freed[index])
+                        {
+                            buffer_descriptor = status.popped_descriptors[index];
+                            return true;
+                        }
+                    }
+                }
+            }
+            catch (const boost::interprocess::interprocess_exception& /*e*/)
+            {
+                // Timeout when locking
+            }
+
+            return false;
+        }
+
+        /**
+         * Keeps the descriptors popped at once by the listener on its status, until they are handed out.
+         * @param listener_index The index of the listener as returned by create_listener.
+         * @param buffer_descriptors The descriptors popped, in order.
+         * @param was_cell_freed Whether the listener holds the enqueued count of each popped descriptor.
+         * @param count Number of descriptors popped. 0 when the pending descriptors are released.
+         */
+        void listener_popped(
+                uint32_t listener_index,
+                const BufferDescriptor* buffer_descriptors,
+                const bool* was_cell_freed,
+                uint32_t count)
+        {
+            try
+            {
+                std::lock_guard<SharedMemSegment::mutex> lock(node_->empty_cv_mutex);
+
+                auto& status = node_->listeners_status[listener_index];
+                std::copy(buffer_descriptors, buffer_descriptors + count, status.popped_descriptors);
+                std::copy(was_cell_freed, was_cell_freed + count, status.popped_cells_freed);
+                status.popped_index = 0;
+                status.popped_count = static_cast<uint8_t>(count);
+            }
+            catch (const boost::interprocess::interprocess_exception& /*e*/)
+            {
+                // Timeout when locking
+            }
+        }
+
         /**
          * Marks the listener as processing a buffer
          * @param listener_index The index of the listener as returned by create_listener.
          * @param buffer_descriptor The descriptor of the buffer that the listener is processing
+         * @param popped_index Number of descriptors of the last popped batch already handed out, this one included
          */
         void listener_processing_start(
                 uint32_t listener_index,
-                const BufferDescriptor& buffer_descriptor)
+                const BufferDescriptor& buffer_descriptor,
+                uint32_t popped_index)
         {
             try
             {
                 std::lock_guard<SharedMemSegment::mutex> lock(node_->empty_cv_mutex);
 
-                node_->listeners_status[listener_index].descriptor = buffer_descriptor;
-                node_->listeners_status[listener_index].is_processing = true;
+                auto& status = node_->listeners_status[listener_index];
+                status.descriptor = buffer_descriptor;
+                status.is_processing = true;
+                status.popped_index = static_cast<uint8_t>(popped_index);
             }
             catch (const boost::interprocess::interprocess_exception& /*e*/)
             {
@@ -1242,6 +1493,7 @@ private:
         port_node->port_id = port_id;
         UUID<8>::generate(port_node->uuid);
         port_node->waiting_count = 0;
+        port_node->notification_counter.store(0);
         port_node->is_opened_read_exclusive = (open_mode == Port::OpenMode::ReadExclusive);
         port_node->is_opened_for_reading = (open_mode != Port::OpenMode::Write);
         port_node->num_listeners = 0;
@@ -15,10 +15,14 @@
 #ifndef _FASTDDS_SHAREDMEM_MANAGER_H_
 #define _FASTDDS_SHAREDMEM_MANAGER_H_
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <list>
+#include <memory>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include <foonathan/memory/container.hpp>
 #include <foonathan/memory/memory_pool.hpp>
@@ -409,6 +413,19 @@ public:
                 buffers_nodes[i].data_offset = 0;
                 free_buffers_.push_back(&buffers_nodes[i]);
             }
+
+            buffer_nodes_ = buffers_nodes;
+            node_capacities_.assign(max_allocations, 0u);
+            node_links_.reset(new std::atomic<uint32_t>[max_allocations]);
+            for (uint32_t i = 0; i < max_allocations; i++)
+            {
+                node_links_[i].store(0u, std::memory_order_relaxed);
+            }
+            for (auto& cache : cached_buffers_)
+            {
+                cache.store(0u, std::memory_order_relaxed);
+            }
+            fast_allocated_buffers_.store(0u, std::memory_order_relaxed);
         }
 
         ~Segment()
@@ -435,68 +452,39 @@ public:
             return segment_id_;
         }
 
+        /**
+         * Allocate a buffer on the segment.
+         *
+         * Buffers are recovered on the size class of their capacity once no listener references them, and reused
+         * by later allocations of the same class without taking the allocation mutex. The mutex is only taken when
+         * the class has no recovered buffer, to recover the unreferenced buffers and allocate on the segment.
+         * When the segment is full, the oldest buffers not being processed by any listener are invalidated.
+         * @throw std::exception when the buffer cannot be allocated.
+         */
         std::shared_ptr<Buffer> alloc_buffer(
                 uint32_t size,
                 const std::chrono::steady_clock::time_point& max_blocking_time_point)
         {
             (void)max_blocking_time_point;
 
-            std::lock_guard<std::mutex> lock(alloc_mutex_);
-
-            if (!recover_buffers(size))
-            {
-                throw std::runtime_error("allocation overflow");
-            }
-
-            void* data = nullptr;
-            BufferNode* buffer_node = nullptr;
-            std::shared_ptr<SharedMemBuffer> new_buffer;
+            return allocate(size, true);
+        }
 
+        /**
+         * Allocate a buffer on the segment without invalidating any buffer still referenced by a listener.
+         * @return The buffer, or nullptr if the segment has no room for it.
+         */
+        std::shared_ptr<Buffer> try_alloc_buffer(
+                uint32_t size)
+        {
             try
             {
-                buffer_node = pop_free_node();
-
-                data = segment_->get().allocate(size);
-                free_bytes_ -= size;
-
-                buffer_node->data_offset = segment_->get_offset_from_address(data);
-                buffer_node->data_size = size;
-
-                auto validity_id = buffer_node->status.load(std::memory_order_relaxed).validity_id;
-
-                // TODO(Adolfo) : Dynamic allocation. Use foonathan to convert it to static allocation
-                new_buffer = std::make_shared<SharedMemBuffer>(segment_, segment_id_, buffer_node,
-                                static_cast<uint32_t>(validity_id));
-
-                if (new_buffer)
-                {
-                    buffer_node->inc_processing_count(static_cast<uint32_t>(validity_id));
-                }
-                else
-                {
-                    throw std::runtime_error("alloc_buffer: out of memory");
-                }
-
-                allocated_buffers_.push_back(buffer_node);
+                return allocate(size, false);
             }
             catch (const std::exception&)
             {
-                if (buffer_node)
-                {
-                    if (data)
-                    {
-                        release_buffer(buffer_node);
-                    }
-
-                    free_buffers_.push_back(buffer_node);
-                }
-
-                overflows_count_++;
-
-                throw;
+                return nullptr;
             }
-
-            return new_buffer;
         }
 
         uint64_t mem_size()
@@ -504,6 +492,28 @@ public:
             return segment_->mem_size();
         }
 
+        /**
+         * Back the segment with huge pages when the system provides them.
+         * Should be called before the buffers of the segment are accessed.
+         * @return true if the segment may be given huge pages, false otherwise.
+         */
+        bool use_huge_pages()
+        {
+            return segment_->advise_huge_pages();
+        }
+
+        /**
+         * Place the pages of the segment on a NUMA node.
+         * Should be called before the buffers of the segment are accessed.
+         * @param node NUMA node, or a negative value for the node of the calling thread.
+         * @return true if the placement was set, false otherwise.
+         */
+        bool bind_to_numa_node(
+                int32_t node)
+        {
+            return segment_->bind_to_numa_node(node);
+        }
+
     private:
 
         std::string segment_name_;
@@ -527,6 +537,217 @@ public:
 
         uint32_t free_bytes_;
 
+        //! Capacity of the smallest size class
+        static constexpr uint32_t min_class_size = 64u;
+
+        //! Number of size classes each power of two is split into
+        static constexpr uint32_t classes_per_power_of_two = 4u;
+
+        //! Buffers bigger than this are not recovered on a size class
+        static constexpr uint32_t max_class_size = 1u << 30;
+
+        //! Classes up to min_class_size, then classes_per_power_of_two classes per power of two up to max_class_size
+        static constexpr uint32_t size_classes_count = 1u + (30u - 6u) * classes_per_power_of_two;
+
+        //! Nodes of the segment, in the order they were constructed
+        BufferNode* buffer_nodes_ = nullptr;
+
+        //! Bytes allocated for the data of each node, which may be more than its data_size
+        std::vector<uint32_t> node_capacities_;
+
+        //! Next node of the stack each node is on, as index + 1 (0 ends the stack)
+        std::unique_ptr<std::atomic<uint32_t>[]> node_links_;
+
+        /**
+         * Lock-free stacks of recovered buffers, one per size class.
+         * Each head holds the index + 1 of the top node in the low 32 bits, and a counter of the changes to the
+         * stack in the high 32 bits, so a pop racing with other pops and pushes of the same node fails.
+         */
+        std::array<std::atomic<uint64_t>, size_classes_count> cached_buffers_;
+
+        //! Stack of buffers allocated without the mutex, moved to allocated_buffers_ when the mutex is taken
+        std::atomic<uint64_t> fast_allocated_buffers_;
+
+        /**
+         * Get the size class of a buffer.
+         * @param [in] size Size of the buffer.
+         * @param [out] capacity Capacity of the size class. Left unchanged when the size has no size class.
+         * @return The size class, or size_classes_count when the size is too big to have one.
+         */
+        static uint32_t get_size_class(
+                uint32_t size,
+                uint32_t& capacity)
+        {
+            if (size <= min_class_size)
+            {
+                capacity = min_class_size;
+                return 0u;
+            }
+
+            if (size > max_class_size)
+            {
+                return size_classes_count;
+            }
+
+            // Sizes in (2^msb, 2^(msb+1)] are split in classes of 2^(msb-2) bytes
+            uint32_t msb = 0;
+            uint32_t value = size - 1;
+            while (value >>= 1)
+            {
+                ++msb;
+            }
+
+            uint32_t step = 1u << (msb - 2);
+            uint32_t sub_class = (size - 1 - (1u << msb)) / step;
+            capacity = (1u << msb) + (sub_class + 1) * step;
+            return 1u + (msb - 6) * classes_per_power_of_two + sub_class;
+        }
+
+        inline uint32_t node_index(
+                const BufferNode* buffer_node) const
+        {
+            return static_cast<uint32_t>(buffer_node - buffer_nodes_);
+        }
+
+        void push_node(
+                std::atomic<uint64_t>& stack,
+                BufferNode* buffer_node)
+        {
+            uint32_t index = node_index(buffer_node);
+            uint64_t head = stack.load(std::memory_order_relaxed);
+            uint64_t new_head;
+            do
+            {
+                node_links_[index].store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+                new_head = (((head >> 32) + 1) << 32) | (index + 1);
+            } while (!stack.compare_exchange_weak(head, new_head, std::memory_order_release,
+                    std::memory_order_relaxed));
+        }
+
+        BufferNode* pop_node(
+                std::atomic<uint64_t>& stack)
+        {
+            uint64_t head = stack.load(std::memory_order_acquire);
+            while (0u != static_cast<uint32_t>(head))
+            {
+                uint32_t index = static_cast<uint32_t>(head) - 1;
+                uint64_t new_head = (((head >> 32) + 1) << 32) |
+                        node_links_[index].load(std::memory_order_relaxed);
+                if (stack.compare_exchange_weak(head, new_head, std::memory_order_acquire,
+                        std::memory_order_acquire))
+                {
+                    return &buffer_nodes_[index];
+                }
+            }
+
+            return nullptr;
+        }
+
+        inline BufferNode* pop_cached_node(
+                uint32_t size_class)
+        {
+            return size_class < size_classes_count ? pop_node(cached_buffers_[size_class]) : nullptr;
+        }
+
+        /**
+         * Give a recovered buffer to a new allocation. Can be called without the allocation mutex.
+         */
+        std::shared_ptr<Buffer> reuse_cached_node(
+                BufferNode* buffer_node,
+                uint32_t size,
+                uint32_t size_class)
+        {
+            // The node was invalidated when recovered, and no listener can reference it anymore
+            buffer_node->data_size = size;
+            auto validity_id = buffer_node->status.load(std::memory_order_relaxed).validity_id;
+
+            std::shared_ptr<SharedMemBuffer> new_buffer;
+            try
+            {
+                new_buffer = std::make_shared<SharedMemBuffer>(segment_, segment_id_, buffer_node,
+                                static_cast<uint32_t>(validity_id));
+            }
+            catch (const std::exception&)
+            {
+                push_node(cached_buffers_[size_class], buffer_node);
+                throw;
+            }
+
+            buffer_node->inc_processing_count(static_cast<uint32_t>(validity_id));
+            push_node(fast_allocated_buffers_, buffer_node);
+            return new_buffer;
+        }
+
+        /**
+         * Move the buffers allocated without the mutex to allocated_buffers_, oldest first.
+         * Should be called with the allocation mutex taken.
+         */
+        void collect_fast_allocations()
+        {
+            // The whole stack is taken at once, so its nodes cannot be popped by anyone else meanwhile
+            uint64_t head = fast_allocated_buffers_.exchange(0u, std::memory_order_acquire);
+            auto position = allocated_buffers_.end();
+            uint32_t link = static_cast<uint32_t>(head);
+            while (0u != link)
+            {
+                BufferNode* buffer_node = &buffer_nodes_[link - 1];
+                link = node_links_[link - 1].load(std::memory_order_relaxed);
+                position = allocated_buffers_.insert(position, buffer_node);
+            }
+        }
+
+        /**
+         * Recover the unreferenced buffers on the size class of their capacity.
+         * Should be called with the allocation mutex taken.
+         */
+        void recycle_unreferenced_buffers()
+        {
+            auto it = allocated_buffers_.begin();
+            while (it != allocated_buffers_.end())
+            {
+                if ((*it)->is_not_referenced())
+                {
+                    (*it)->invalidate_buffer();
+
+                    uint32_t capacity = node_capacities_[node_index(*it)];
+                    uint32_t class_capacity = 0;
+                    uint32_t size_class = get_size_class(capacity, class_capacity);
+                    if (size_class < size_classes_count && class_capacity == capacity)
+                    {
+                        push_node(cached_buffers_[size_class], *it);
+                    }
+                    else
+                    {
+                        release_buffer(*it);
+                        free_buffers_.push_back(*it);
+                    }
+
+                    it = allocated_buffers_.erase(it);
+                }
+                else
+                {
+                    it++;
+                }
+            }
+        }
+
+        /**
+         * Release the buffers recovered on all the size classes.
+         * Should be called with the allocation mutex taken.
+         */
+        void release_cached_buffers()
+        {
+            for (auto& cache : cached_buffers_)
+            {
+                BufferNode* buffer_node = nullptr;
+                while (nullptr != (buffer_node = pop_node(cache)))
+                {
+                    release_buffer(buffer_node);
+                    free_buffers_.push_back(buffer_node);
+                }
+            }
+        }
+
         void generate_segment_id_and_name(
                 const std::string& domain_name)
         {
@@ -557,6 +778,112 @@ public:
             }
         }
 
+        /**
+         * Allocate a buffer on the segment.
+         * @param size Size of the buffer.
+         * @param recover_referenced Whether the buffers still referenced by listeners can be recovered to make
+         * room for the new one.
+         * @return The buffer, or nullptr if there is no room for it and recover_referenced is false.
+         */
+        std::shared_ptr<Buffer> allocate(
+                uint32_t size,
+                bool recover_referenced)
+        {
+            uint32_t capacity = size;
+            uint32_t size_class = get_size_class(size, capacity);
+
+            BufferNode* buffer_node = pop_cached_node(size_class);
+            if (nullptr != buffer_node)
+            {
+                return reuse_cached_node(buffer_node, size, size_class);
+            }
+
+            std::lock_guard<std::mutex> lock(alloc_mutex_);
+
+            collect_fast_allocations();
+            recycle_unreferenced_buffers();
+
+            buffer_node = pop_cached_node(size_class);
+            if (nullptr != buffer_node)
+            {
+                return reuse_cached_node(buffer_node, size, size_class);
+            }
+
+            // The buffers recovered on other size classes are released before recovering referenced ones
+            if (free_bytes_ < size || free_buffers_.empty())
+            {
+                release_cached_buffers();
+
+                if (!recover_referenced && (free_bytes_ < size || free_buffers_.empty()))
+                {
+                    return nullptr;
+                }
+            }
+
+            if (!recover_buffers(size))
+            {
+                throw std::runtime_error("allocation overflow");
+            }
+
+            // When there is no room for the whole size class, the buffer is allocated with its exact size
+            // and released, instead of recovered on a size class, when it is not referenced anymore.
+            if (free_bytes_ < capacity)
+            {
+                capacity = size;
+            }
+
+            void* data = nullptr;
+            buffer_node = nullptr;
+            std::shared_ptr<SharedMemBuffer> new_buffer;
+
+            try
+            {
+                buffer_node = pop_free_node();
+
+                data = segment_->get().allocate(capacity);
+                free_bytes_ -= capacity;
+
+                buffer_node->data_offset = segment_->get_offset_from_address(data);
+                buffer_node->data_size = size;
+                node_capacities_[node_index(buffer_node)] = capacity;
+
+                auto validity_id = buffer_node->status.load(std::memory_order_relaxed).validity_id;
+
+                // TODO(Adolfo) : Dynamic allocation. Use foonathan to convert it to static allocation
+                new_buffer = std::make_shared<SharedMemBuffer>(segment_, segment_id_, buffer_node,
+                                static_cast<uint32_t>(validity_id));
+
+                if (new_buffer)
+                {
+                    buffer_node->inc_processing_count(static_cast<uint32_t>(validity_id));
+                }
+                else
+                {
+                    throw std::runtime_error("alloc_buffer: out of memory");
+                }
+
+                allocated_buffers_.push_back(buffer_node);
+            }
+            catch (const std::exception&)
+            {
+                if (buffer_node)
+                {
+                    if (data)
+                    {
+                        release_buffer(buffer_node);
+                    }
+
+                    free_buffers_.push_back(buffer_node);
+                }
+
+                overflows_count_++;
+
+                throw;
+            }
+
+            return new_buffer;
+        }
+
         inline BufferNode* pop_free_node()
         {
             if (free_buffers_.empty())
@@ -575,7 +902,7 @@ public:
             segment_->get().deallocate(
                 segment_->get_address_from_offset(buffer_node->data_offset));
 
-            free_bytes_ += buffer_node->data_size;
+            free_bytes_ += node_capacities_[node_index(buffer_node)];
         }
 
         /**
@@ -672,6 +999,7 @@ public:
             {
                 try
                 {
+                    release_popped_descriptors();
                     global_port_->unregister_listener(&global_listener_, listener_index_);
                 }
                 catch (const std::exception& e)
@@ -684,6 +1012,13 @@ public:
         Listener& operator = (
                 Listener&& other)
         {
+            release_popped_descriptors();
+            popped_descriptors_ = other.popped_descriptors_;
+            popped_cells_freed_ = other.popped_cells_freed_;
+            popped_index_ = other.popped_index_;
+            popped_count_ = other.popped_count_;
+            other.popped_index_ = other.popped_count_ = 0;
+
             global_listener_ = std::move(other.global_listener_);
             other.global_listener_.reset();
             global_port_ = other.global_port_;
@@ -698,6 +1033,8 @@ public:
          * Extract the first buffer enqueued in the port.
          * If the queue is empty, blocks until a buffer is pushed
          * to the port.
+         * Descriptors are popped from the port in batches of up to pop_batch_size, and the buffers
+         * they reference are extracted one by one by the following calls.
          * @return A shared_ptr to the buffer, this shared_ptr can be nullptr if the
          * wait was interrupted because errors or close operations.
          * @remark Multithread not supported.
@@ -711,18 +1048,18 @@ public:
             {
                 while (!is_buffer_valid)
                 {
-                    bool was_cell_freed;
-
-                    SharedMemGlobal::PortCell* head_cell = nullptr;
                     buffer_ref.reset();
 
-                    while ( !is_closed_.load() && nullptr == (head_cell = global_listener_->head()))
+                    if (popped_index_ == popped_count_)
                     {
-                        // Wait until there's data to pop
-                        global_port_->wait_pop(*global_listener_, is_closed_, listener_index_);
+                        while ( !is_closed_.load() && nullptr == global_listener_->head())
+                        {
+                            // Wait until there's data to pop
+                            global_port_->wait_pop(*global_listener_, is_closed_, listener_index_);
+                        }
                     }
 
-                    if (!head_cell)
+                    if (is_closed_.load())
                     {
                         return nullptr;
                     }
@@ -732,9 +1069,22 @@ public:
                         throw std::runtime_error("");
                     }
 
-                    // Read and pop descriptor
-                    SharedMemGlobal::BufferDescriptor buffer_descriptor = head_cell->data();
-                    global_port_->pop(*global_listener_, was_cell_freed);
+                    if (popped_index_ == popped_count_)
+                    {
+                        // Read and pop all the descriptors available, up to the batch size
+                        popped_index_ = 0;
+                        popped_count_ = global_port_->pop(*global_listener_, listener_index_,
+                                        popped_descriptors_.data(), popped_cells_freed_.data(), pop_batch_size);
+
+                        if (0 == popped_count_)
+                        {
+                            continue;
+                        }
+                    }
+
+                    SharedMemGlobal::BufferDescriptor buffer_descriptor = popped_descriptors_[popped_index_];
+                    bool was_cell_freed = popped_cells_freed_[popped_index_];
+                    popped_index_++;
 
                     auto segment = shared_mem_manager_->find_segment(buffer_descriptor.source_segment_id);
                     if (!segment)
@@ -753,7 +1103,7 @@ public:
 
                     if (buffer_ref)
                     {
-                        global_port_->listener_processing_start(listener_index_, buffer_descriptor);
+                        global_port_->listener_processing_start(listener_index_, buffer_descriptor, popped_index_);
                         if (was_cell_freed)
                         {
                             // Atomically increase processing & decrease enqueued
@@ -795,6 +1145,33 @@ public:
             return buffer_ref;
         }
 
+        /**
+         * Polls the port until a buffer is enqueued, the listener is closed or the budget expires.
+         * Polling listeners are not counted as waiting, so the writers do not need to notify them.
+         * @param budget Maximum polling time.
+         * @return true if there is a buffer ready to be popped.
+         * @remark Multithread not supported.
+         */
+        bool busy_poll(
+                const std::chrono::microseconds& budget)
+        {
+            auto deadline = std::chrono::steady_clock::now() + budget;
+            while (!is_closed_.load())
+            {
+                if (popped_index_ < popped_count_ || nullptr != global_listener_->head())
+                {
+                    return true;
+                }
+
+                if (std::chrono::steady_clock::now() >= deadline)
+                {
+                    break;
+                }
+            }
+
+            return false;
+        }
+
         void stop_processing_buffer()
         {
             global_port_->listener_processing_stop(listener_index_);
@@ -820,6 +1197,38 @@ public:
 
     private:
 
+        //! Maximum number of descriptors popped from the port at once
+        static constexpr uint32_t pop_batch_size = SharedMemGlobal::PortNode::LISTENER_POP_BATCH_SIZE;
+
+        /**
+         * Release the enqueued count of the buffers referenced by the descriptors popped from the port
+         * and not extracted yet.
+         */
+        void release_popped_descriptors()
+        {
+            if (popped_index_ < popped_count_)
+            {
+                global_port_->listener_popped(listener_index_, nullptr, nullptr, 0);
+            }
+
+            for (; popped_index_ < popped_count_; ++popped_index_)
+            {
+                if (popped_cells_freed_[popped_index_])
+                {
+                    const auto& buffer_descriptor = popped_descriptors_[popped_index_];
+                    auto segment = shared_mem_manager_->find_segment(buffer_descriptor.source_segment_id);
+                    if (segment)
+                    {
+                        auto buffer_node = static_cast<BufferNode*>(segment->get_address_from_offset(
+                                    buffer_descriptor.buffer_node_offset));
+                        buffer_node->dec_enqueued_count(buffer_descriptor.validity_id);
+                    }
+                }
+            }
+
+            popped_index_ = popped_count_ = 0;
+        }
+
         std::shared_ptr<SharedMemGlobal::Port> global_port_;
 
         std::unique_ptr<SharedMemGlobal::Listener> global_listener_;
@@ -829,6 +1238,12 @@ public:
 
         std::atomic<bool> is_closed_;
 
+        //! Descriptors popped from the port, the ones from popped_index_ to popped_count_ not extracted yet
+        std::array<SharedMemGlobal::BufferDescriptor, pop_batch_size> popped_descriptors_;
+        std::array<bool, pop_batch_size> popped_cells_freed_;
+        uint32_t popped_index_ = 0;
+        uint32_t popped_count_ = 0;
+
     }; // Listener
 
     /**
@@ -924,11 +1339,86 @@ public:
             return ret;
         }
 
+        /**
+         * Try to enqueue several buffers in the port at once, notifying the listeners only once.
+         * @param[in] buffers the SHM buffers to push, in order
+         * @param[out] is_port_ok true if the port is ok
+         * @returns false If the port's queue has not room for all the buffers, so none of them was enqueued.
+         */
+        bool try_push(
+                const std::vector<std::shared_ptr<Buffer>>& buffers,
+                bool& is_port_ok)
+        {
+            is_port_ok = true;
+
+            // Reused by the following pushes of the thread, so the descriptors are not allocated on every push
+            static thread_local std::vector<SharedMemGlobal::BufferDescriptor> buffer_descriptors;
+            buffer_descriptors.clear();
+
+            for (const auto& buffer : buffers)
+            {
+                assert(std::dynamic_pointer_cast<SharedMemBuffer>(buffer));
+
+                SharedMemBuffer* shared_mem_buffer = std::static_pointer_cast<SharedMemBuffer>(buffer).get();
+                auto validity_id = shared_mem_buffer->validity_id();
+
+                shared_mem_buffer->inc_enqueued_count(validity_id);
+                buffer_descriptors.push_back(SharedMemGlobal::BufferDescriptor{shared_mem_buffer->segment_id(),
+                                                                                shared_mem_buffer->node_offset(),
+                                                                                validity_id});
+            }
+
+            auto dec_enqueued_counts = [&buffers]()
+                    {
+                        for (const auto& buffer : buffers)
+                        {
+                            SharedMemBuffer* shared_mem_buffer =
+                                    std::static_pointer_cast<SharedMemBuffer>(buffer).get();
+                            shared_mem_buffer->dec_enqueued_count(shared_mem_buffer->validity_id());
+                        }
+                    };
+
+            bool ret;
+            bool are_listeners_active = false;
+
+            try
+            {
+                ret = global_port_->try_push(buffer_descriptors.data(),
+                                static_cast<uint32_t>(buffer_descriptors.size()), &are_listeners_active);
+
+                if (!are_listeners_active)
+                {
+                    dec_enqueued_counts();
+                }
+            }
+            catch (std::exception& e)
+            {
+                dec_enqueued_counts();
+
+                if (!global_port_->is_port_ok())
+                {
+                    EPROSIMA_LOG_WARNING(RTPS_TRANSPORT_SHM, "SHM Port " << global_port_->port_id() << " failure: "
+                                                                         << e.what());
+
+                    regenerate_port();
+                    is_port_ok = false;
+                    ret = false;
+                }
+                else
+                {
+                    throw;
+                }
+            }
+
+            return ret;
+        }
+
         /**
          * @brief Unlock buffers being processed by the port if the port is frozen.
          *
          * If the port is zombie, finds all the buffers that were being processed by a listener
-         * and decrements their processing count, so that they are not kept locked forever
+         * and decrements their processing count, and the ones popped by a listener and not processed yet
+         * and decrements their enqueued count, so that they are not kept locked forever
          */
         void recover_blocked_processing()
         {
@@ -949,6 +1439,20 @@ public:
                                     buffer_node_offset));
                     buffer_node->dec_processing_count(buffer_descriptor.validity_id);
                 }
+
+                // Buffers popped and not handed out yet keep the enqueued count taken from their cell
+                while (global_port_->get_and_remove_blocked_popped(buffer_descriptor))
+                {
+                    auto segment = shared_mem_manager_->find_segment(buffer_descriptor.source_segment_id);
+                    if (!segment)
+                    {
+                        continue;
+                    }
+                    auto buffer_node =
+                            static_cast<BufferNode*>(segment->get_address_from_offset(buffer_descriptor.
+                                    buffer_node_offset));
+                    buffer_node->dec_enqueued_count(buffer_descriptor.validity_id);
+                }
             }
         }
 
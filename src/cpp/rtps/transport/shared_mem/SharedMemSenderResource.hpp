@@ -49,6 +49,27 @@ public:
                                    max_blocking_time_point);
                 };
 
+        send_gather_lambda_ = [&transport](
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            uint32_t segment_size,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point) -> bool
+                {
+                    // Segmented messages are only given on a single slice
+                    if (0 != segment_size)
+                    {
+                        return transport.send_segmented(buffers.front().buffer, total_bytes, segment_size,
+                                       destination_locators_begin, destination_locators_end, max_blocking_time_point);
+                    }
+
+                    return transport.send(buffers, total_bytes, destination_locators_begin,
+                                   destination_locators_end, max_blocking_time_point);
+                };
+
+        gather_segments_ = true;
+
     }
 
     virtual ~SharedMemSenderResource()
@@ -229,6 +229,12 @@ void SharedMemTransport::clean_up()
             input_channels_.clear();
         }
 
+        {
+            std::lock_guard<std::mutex> lock(extra_segments_mutex_);
+            extra_segments_count_.store(0);
+            extra_segments_.clear();
+        }
+
         shared_mem_segment_.reset();
     }
     catch (const std::exception& e)
@@ -277,14 +283,13 @@ bool SharedMemTransport::init(
         {
             return false;
         }
-        shared_mem_segment_ = shared_mem_manager_->create_segment(configuration_.segment_size(),
-                        configuration_.port_queue_capacity());
+        shared_mem_segment_ = create_shared_mem_segment();
 
-        // Memset the whole segment to zero in order to force physical map of the buffer
-        auto buffer = shared_mem_segment_->alloc_buffer(configuration_.segment_size(),
-                        (std::chrono::steady_clock::now() + std::chrono::milliseconds(100)));
-        memset(buffer->data(), 0, configuration_.segment_size());
-        buffer.reset();
+        if (configuration_.max_segment_size() > configuration_.segment_size())
+        {
+            uint32_t growth = configuration_.max_segment_size() - configuration_.segment_size();
+            extra_segments_.resize((growth + configuration_.segment_size() - 1) / configuration_.segment_size());
+        }
 
         if (!configuration_.rtps_dump_file().empty())
         {
@@ -345,7 +350,8 @@ SharedMemChannelResource* SharedMemTransport::CreateInputChannelResource(
         configuration_.rtps_dump_file(),
         configuration_.dump_thread(),
         true,
-        configuration_.get_thread_config_for_port(locator.port));
+        configuration_.get_thread_config_for_port(locator.port),
+        configuration_.busy_poll_budget_us());
 }
 
 bool SharedMemTransport::OpenOutputChannel(
@@ -415,6 +421,83 @@ bool SharedMemTransport::transform_remote_locator(
     return false;
 }
 
+std::shared_ptr<SharedMemManager::Segment> SharedMemTransport::create_shared_mem_segment()
+{
+    auto segment = shared_mem_manager_->create_segment(configuration_.segment_size(),
+                    configuration_.port_queue_capacity());
+
+    // Pages are given their size and node when first accessed, so this is done before the memset below
+    if (configuration_.huge_pages() && !segment->use_huge_pages())
+    {
+        EPROSIMA_LOG_INFO(RTPS_MSG_OUT, "Huge pages not available for the SHM segment. Using default pages.");
+    }
+    if (SharedMemTransportDescriptor::numa_node_none != configuration_.numa_node() &&
+            !segment->bind_to_numa_node(configuration_.numa_node()))
+    {
+        EPROSIMA_LOG_WARNING(RTPS_MSG_OUT, "Cannot place the SHM segment on NUMA node "
+                << configuration_.numa_node() << ". Leaving the placement to the system.");
+    }
+
+    // Memset the whole segment to zero in order to force physical map of the buffer
+    auto buffer = segment->alloc_buffer(configuration_.segment_size(),
+                    (std::chrono::steady_clock::now() + std::chrono::milliseconds(100)));
+    memset(buffer->data(), 0, configuration_.segment_size());
+    buffer.reset();
+
+    return segment;
+}
+
+std::shared_ptr<SharedMemManager::Buffer> SharedMemTransport::alloc_shared_buffer(
+        uint32_t size,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    if (extra_segments_.empty())
+    {
+        return shared_mem_segment_->alloc_buffer(size, max_blocking_time_point);
+    }
+
+    std::shared_ptr<SharedMemManager::Buffer> buffer = shared_mem_segment_->try_alloc_buffer(size);
+
+    size_t count = extra_segments_count_.load(std::memory_order_acquire);
+    for (size_t i = 0; !buffer && i < count; ++i)
+    {
+        buffer = extra_segments_[i]->try_alloc_buffer(size);
+    }
+
+    if (!buffer)
+    {
+        std::lock_guard<std::mutex> lock(extra_segments_mutex_);
+
+        // Other threads may have grown the chain meanwhile
+        size_t current_count = extra_segments_count_.load(std::memory_order_relaxed);
+        for (size_t i = count; !buffer && i < current_count; ++i)
+        {
+            buffer = extra_segments_[i]->try_alloc_buffer(size);
+        }
+
+        if (!buffer && current_count < extra_segments_.size())
+        {
+            try
+            {
+                extra_segments_[current_count] = create_shared_mem_segment();
+                extra_segments_count_.store(current_count + 1, std::memory_order_release);
+                buffer = extra_segments_[current_count]->try_alloc_buffer(size);
+            }
+            catch (const std::exception& e)
+            {
+                EPROSIMA_LOG_WARNING(RTPS_MSG_OUT, "Cannot grow the SHM segment: " << e.what());
+            }
+        }
+    }
+
+    if (!buffer)
+    {
+        buffer = shared_mem_segment_->alloc_buffer(size, max_blocking_time_point);
+    }
+
+    return buffer;
+}
+
 std::shared_ptr<SharedMemManager::Buffer> SharedMemTransport::copy_to_shared_buffer(
         const octet* send_buffer,
         uint32_t send_buffer_size,
@@ -423,22 +506,34 @@ std::shared_ptr<SharedMemManager::Buffer> SharedMemTransport::copy_to_shared_buf
     assert(shared_mem_segment_);
 
     std::shared_ptr<SharedMemManager::Buffer> shared_buffer =
-            shared_mem_segment_->alloc_buffer(send_buffer_size, max_blocking_time_point);
+            alloc_shared_buffer(send_buffer_size, max_blocking_time_point);
 
     memcpy(shared_buffer->data(), send_buffer, send_buffer_size);
 
     return shared_buffer;
 }
 
-bool SharedMemTransport::send(
-        const octet* send_buffer,
-        uint32_t send_buffer_size,
-        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
-        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+std::shared_ptr<SharedMemManager::Buffer> SharedMemTransport::copy_to_shared_buffer(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
         const std::chrono::steady_clock::time_point& max_blocking_time_point)
 {
-    using namespace eprosima::fastdds::statistics::rtps;
+    assert(shared_mem_segment_);
+
+    std::shared_ptr<SharedMemManager::Buffer> shared_buffer =
+            alloc_shared_buffer(total_bytes, max_blocking_time_point);
+
+    copy_network_buffers(buffers, total_bytes, static_cast<octet*>(shared_buffer->data()));
 
+    return shared_buffer;
+}
+
+template<typename CopyFunction>
+bool SharedMemTransport::send_buffers(
+        CopyFunction copy_message,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end)
+{
 #if !defined(_WIN32)
     cleanup_output_ports();
 #endif // if !defined(_WIN32)
@@ -458,8 +553,7 @@ bool SharedMemTransport::send(
                 // Only copy the first time
                 if (shared_buffer == nullptr)
                 {
-                    remove_statistics_submessage(send_buffer, send_buffer_size);
-                    shared_buffer = copy_to_shared_buffer(send_buffer, send_buffer_size, max_blocking_time_point);
+                    shared_buffer = copy_message();
                 }
 
                 ret &= send(shared_buffer, *it);
@@ -493,6 +587,109 @@ bool SharedMemTransport::send(
 
 }
 
+bool SharedMemTransport::send(
+        const octet* send_buffer,
+        uint32_t send_buffer_size,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    return send_buffers([&]()
+                   {
+                       fastdds::statistics::rtps::remove_statistics_submessage(send_buffer, send_buffer_size);
+                       return copy_to_shared_buffer(send_buffer, send_buffer_size, max_blocking_time_point);
+                   }, destination_locators_begin, destination_locators_end);
+}
+
+bool SharedMemTransport::send(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    return send_buffers([&]()
+                   {
+                       fastdds::statistics::rtps::remove_statistics_submessage(buffers, total_bytes);
+                       return copy_to_shared_buffer(buffers, total_bytes, max_blocking_time_point);
+                   }, destination_locators_begin, destination_locators_end);
+}
+
+bool SharedMemTransport::send_segmented(
+        const octet* send_buffer,
+        uint32_t send_buffer_size,
+        uint32_t segment_size,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    if (0 == segment_size || send_buffer_size <= segment_size)
+    {
+        return send(send_buffer, send_buffer_size, destination_locators_begin, destination_locators_end,
+                       max_blocking_time_point);
+    }
+
+    if (segment_size > configuration_.max_message_size())
+    {
+        return false;
+    }
+
+#if !defined(_WIN32)
+    cleanup_output_ports();
+#endif // if !defined(_WIN32)
+
+    fastrtps::rtps::LocatorsIterator& it = *destination_locators_begin;
+
+    bool ret = true;
+    bool copied = false;
+
+    try
+    {
+        while (it != *destination_locators_end)
+        {
+            if (IsLocatorSupported(*it))
+            {
+                // Only copy the first time, each message on its own shared buffer
+                if (!copied)
+                {
+                    for (uint32_t offset = 0; offset < send_buffer_size; offset += segment_size)
+                    {
+                        uint32_t size = (std::min)(segment_size, send_buffer_size - offset);
+                        fastdds::statistics::rtps::remove_statistics_submessage(send_buffer + offset, size);
+                        segment_buffers_.push_back(copy_to_shared_buffer(send_buffer + offset, size,
+                                max_blocking_time_point));
+                    }
+                    copied = true;
+                }
+
+                ret &= send(segment_buffers_, *it);
+
+                if (packet_logger_ && ret)
+                {
+                    for (const auto& shared_buffer : segment_buffers_)
+                    {
+                        packet_logger_->QueueLog({packet_logger_->now(), Locator(), *it, shared_buffer});
+                    }
+                }
+            }
+
+            ++it;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        EPROSIMA_LOG_INFO(RTPS_TRANSPORT_SHM, e.what());
+        (void)e;
+
+        // Segment overflow with discard policy doesn't return error.
+        ret = !copied;
+    }
+
+    segment_buffers_.clear();
+
+    return ret;
+}
+
 void SharedMemTransport::cleanup_output_ports()
 {
     auto it = opened_ports_.begin();
@@ -530,8 +727,9 @@ std::shared_ptr<SharedMemManager::Port> SharedMemTransport::find_port(
     return port;
 }
 
+template<typename BufferType>
 bool SharedMemTransport::push_discard(
-        const std::shared_ptr<SharedMemManager::Buffer>& buffer,
+        const BufferType& buffer,
         const Locator& remote_locator)
 {
     try
@@ -579,6 +777,22 @@ bool SharedMemTransport::send(
     return true;
 }
 
+bool SharedMemTransport::send(
+        const std::vector<std::shared_ptr<SharedMemManager::Buffer>>& buffers,
+        const Locator& remote_locator)
+{
+    if (!push_discard(buffers, remote_locator))
+    {
+        return false;
+    }
+
+    EPROSIMA_LOG_INFO(RTPS_MSG_OUT,
+            "(ID:" << std::this_thread::get_id() << ") " << "SharedMemTransport: " << buffers.size() <<
+            " messages to port " << remote_locator.port);
+
+    return true;
+}
+
 /**
  * Invalidate all selector entries containing certain multicast locator.
  *
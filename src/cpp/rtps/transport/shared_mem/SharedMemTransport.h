@@ -15,13 +15,17 @@
 #ifndef _FASTDDS_SHAREDMEM_TRANSPORT_H_
 #define _FASTDDS_SHAREDMEM_TRANSPORT_H_
 
+#include <fastdds/rtps/transport/NetworkBuffer.hpp>
 #include <fastdds/rtps/transport/TransportInterface.h>
 #include <fastdds/rtps/transport/shared_mem/SharedMemTransportDescriptor.h>
 
 #include <rtps/transport/shared_mem/SharedMemManager.hpp>
 #include <rtps/transport/shared_mem/SharedMemLog.hpp>
 
+#include <atomic>
 #include <map>
+#include <mutex>
+#include <vector>
 
 namespace eprosima {
 namespace fastdds {
@@ -159,6 +163,42 @@ public:
             fastrtps::rtps::LocatorsIterator* destination_locators_end,
             const std::chrono::steady_clock::time_point& max_blocking_time_point);
 
+    /**
+     * Blocking Send of a message, given as a list of slices.
+     * The slices are copied straight into the shared memory buffer, without being gathered on a single
+     * buffer first.
+     * @param buffers Slices of the message to send.
+     * @param total_bytes Size of the message. Sum of the sizes of the slices.
+     * @param destination_locators_begin pointer to destination locators iterator begin.
+     * @param destination_locators_end pointer to destination locators iterator end.
+     * @param max_blocking_time_point Maximum time this function will block
+     */
+    virtual bool send(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point);
+
+    /**
+     * Blocking Send of several messages stored one after another on a single buffer.
+     * Each message is copied to its own shared memory buffer, and all of them are enqueued on each destination
+     * port at once, notifying its listeners only once.
+     * @param send_buffer Buffer with the messages to send.
+     * @param send_buffer_size Size of the buffer.
+     * @param segment_size Size of each message. Only the last one can be shorter.
+     * @param destination_locators_begin pointer to destination locators iterator begin.
+     * @param destination_locators_end pointer to destination locators iterator end.
+     * @param max_blocking_time_point Maximum time this function will block
+     */
+    virtual bool send_segmented(
+            const fastrtps::rtps::octet* send_buffer,
+            uint32_t send_buffer_size,
+            uint32_t segment_size,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point);
+
     /**
      * Performs the locator selection algorithm for this transport.
      *
@@ -225,8 +265,23 @@ private:
 
     std::shared_ptr<SharedMemManager::Segment> shared_mem_segment_;
 
+    /**
+     * Segments chained to shared_mem_segment_ when it runs out of room, up to max_segment_size.
+     * The slots are created on init and filled in order, so the chain can be read without locking.
+     */
+    std::vector<std::shared_ptr<SharedMemManager::Segment>> extra_segments_;
+
+    //! Number of filled slots of extra_segments_
+    std::atomic<size_t> extra_segments_count_{0};
+
+    //! Serializes the growth of the chain
+    std::mutex extra_segments_mutex_;
+
     std::shared_ptr<PacketsLog<SHMPacketFileConsumer>> packet_logger_;
 
+    //! Shared buffers of the messages of the segmented send in progress. Sends are serialized, as for opened_ports_.
+    std::vector<std::shared_ptr<SharedMemManager::Buffer>> segment_buffers_;
+
     friend class SharedMemChannelResource;
 
 protected:
@@ -249,17 +304,56 @@ private:
             uint32_t send_buffer_size,
             const std::chrono::steady_clock::time_point& max_blocking_time_point);
 
+    std::shared_ptr<SharedMemManager::Buffer> copy_to_shared_buffer(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point);
+
+    /**
+     * Implementation of the send operations, which copies the message once for all the destinations.
+     * @param copy_message Function returning the shared buffer with a copy of the message, called on the first
+     * supported destination.
+     */
+    template<typename CopyFunction>
+    bool send_buffers(
+            CopyFunction copy_message,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end);
+
+    /**
+     * Creates a segment of segment_size with the page settings of the descriptor, touching all its pages.
+     * @throw std::exception& If the segment cannot be created
+     */
+    std::shared_ptr<SharedMemManager::Segment> create_shared_mem_segment();
+
+    /**
+     * Allocates a buffer on the chain of segments.
+     * Buffers still referenced by listeners are only recovered when the chain cannot grow anymore.
+     * @throw std::exception& If the buffer cannot be allocated
+     */
+    std::shared_ptr<SharedMemManager::Buffer> alloc_shared_buffer(
+            uint32_t size,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point);
+
     bool send(
             const std::shared_ptr<SharedMemManager::Buffer>& buffer,
             const Locator& remote_locator);
 
+    bool send(
+            const std::vector<std::shared_ptr<SharedMemManager::Buffer>>& buffers,
+            const Locator& remote_locator);
+
     void cleanup_output_ports();
 
     std::shared_ptr<SharedMemManager::Port> find_port(
             uint32_t port_id);
 
+    /**
+     * Enqueues a buffer, or several ones at once, on the port of the locator, dropping them if the port is full.
+     */
+    template<typename BufferType>
     bool push_discard(
-            const std::shared_ptr<SharedMemManager::Buffer>& buffer,
+            const BufferType& buffer,
             const Locator& remote_locator);
 
     void delete_input_channel(
@@ -36,12 +36,19 @@ static constexpr uint32_t shm_default_healthy_check_timeout_ms = 1000;
 //*********************************************************
 // SharedMemTransportDescriptor
 //*********************************************************
+constexpr int32_t SharedMemTransportDescriptor::numa_node_none;
+constexpr int32_t SharedMemTransportDescriptor::numa_node_local;
+
 SharedMemTransportDescriptor::SharedMemTransportDescriptor()
     : PortBasedTransportDescriptor(shm_default_segment_size, s_maximumInitialPeersRange)
     , segment_size_(shm_default_segment_size)
+    , max_segment_size_(0)
     , port_queue_capacity_(shm_default_port_queue_capacity)
     , healthy_check_timeout_ms_(shm_default_healthy_check_timeout_ms)
     , rtps_dump_file_("")
+    , busy_poll_budget_us_(0)
+    , huge_pages_(false)
+    , numa_node_(numa_node_none)
 {
     maxMessageSize = s_maximumMessageSize;
 }
@@ -50,9 +57,13 @@ bool SharedMemTransportDescriptor::operator ==(
         const SharedMemTransportDescriptor& t) const
 {
     return (this->segment_size_ == t.segment_size() &&
+           this->max_segment_size_ == t.max_segment_size() &&
            this->port_queue_capacity_ == t.port_queue_capacity() &&
            this->healthy_check_timeout_ms_ == t.healthy_check_timeout_ms() &&
            this->rtps_dump_file_ == t.rtps_dump_file() &&
+           this->busy_poll_budget_us_ == t.busy_poll_budget_us() &&
+           this->huge_pages_ == t.huge_pages() &&
+           this->numa_node_ == t.numa_node() &&
            this->dump_thread_ == t.dump_thread() &&
            PortBasedTransportDescriptor::operator ==(t));
 }
@@ -64,6 +64,22 @@ bool test_SharedMemTransport::send(
                    destination_locators_end, max_blocking_time_point);
 }
 
+bool test_SharedMemTransport::send(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    if (total_bytes >= big_buffer_size_)
+    {
+        (*big_buffer_size_send_count_)++;
+    }
+
+    return SharedMemTransport::send(buffers, total_bytes, destination_locators_begin,
+                   destination_locators_end, max_blocking_time_point);
+}
+
 SharedMemChannelResource* test_SharedMemTransport::CreateInputChannelResource(
         const Locator& locator,
         uint32_t maxMsgSize,
@@ -198,7 +198,9 @@ bool test_UDPv4Transport::send(
         fastrtps::rtps::LocatorsIterator* destination_locators_end,
         bool only_multicast_purpose,
         bool whitelisted,
-        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+        const std::chrono::steady_clock::time_point& max_blocking_time_point,
+        UDPConnectedSocketCache* connected_sockets,
+        UDPBatchSendStorage* /*batch_storage*/)
 {
     fastrtps::rtps::LocatorsIterator& it = *destination_locators_begin;
 
@@ -222,7 +224,8 @@ bool test_UDPv4Transport::send(
                             *it,
                             only_multicast_purpose,
                             whitelisted,
-                            std::chrono::duration_cast<std::chrono::microseconds>(now - max_blocking_time_point));
+                            std::chrono::duration_cast<std::chrono::microseconds>(now - max_blocking_time_point),
+                            connected_sockets);
 
             ++it;
         }
@@ -236,6 +239,24 @@ bool test_UDPv4Transport::send(
     return ret;
 }
 
+bool test_UDPv4Transport::send(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        bool only_multicast_purpose,
+        bool whitelisted,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point,
+        UDPConnectedSocketCache* connected_sockets,
+        UDPBatchSendStorage* /*batch_storage*/)
+{
+    std::vector<octet> send_buffer(total_bytes);
+    copy_network_buffers(buffers, total_bytes, send_buffer.data());
+    return send(send_buffer.data(), total_bytes, socket, destination_locators_begin, destination_locators_end,
+                   only_multicast_purpose, whitelisted, max_blocking_time_point, connected_sockets);
+}
+
 bool test_UDPv4Transport::send(
         const octet* send_buffer,
         uint32_t send_buffer_size,
@@ -243,7 +264,8 @@ bool test_UDPv4Transport::send(
         const Locator& remote_locator,
         bool only_multicast_purpose,
         bool whitelisted,
-        const std::chrono::microseconds& timeout)
+        const std::chrono::microseconds& timeout,
+        UDPConnectedSocketCache* connected_sockets)
 {
     bool is_multicast_remote_address = fastrtps::rtps::IPLocator::IPLocator::isMulticast(remote_locator);
     if (is_multicast_remote_address == only_multicast_purpose || whitelisted)
@@ -257,7 +279,7 @@ bool test_UDPv4Transport::send(
         else
         {
             return UDPv4Transport::send(send_buffer, send_buffer_size, socket, remote_locator, only_multicast_purpose,
-                           whitelisted, timeout);
+                           whitelisted, timeout, connected_sockets);
         }
     }
 
@@ -48,7 +48,25 @@ public:
             fastrtps::rtps::LocatorsIterator* destination_locators_end,
             bool only_multicast_purpose,
             bool whitelisted,
-            const std::chrono::steady_clock::time_point& max_blocking_time_point) override;
+            const std::chrono::steady_clock::time_point& max_blocking_time_point,
+            UDPConnectedSocketCache* connected_sockets = nullptr,
+            UDPBatchSendStorage* batch_storage = nullptr) override;
+
+    /**
+     * The slices of the message are copied into a single buffer, so the drop criteria are applied on the same
+     * buffer as with the other send operations.
+     */
+    virtual bool send(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            eProsimaUDPSocket& socket,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end,
+            bool only_multicast_purpose,
+            bool whitelisted,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point,
+            UDPConnectedSocketCache* connected_sockets = nullptr,
+            UDPBatchSendStorage* batch_storage = nullptr) override;
 
     virtual LocatorList NormalizeLocator(
             const Locator& locator) override;
@@ -122,7 +140,8 @@ private:
             const Locator& remote_locator,
             bool only_multicast_purpose,
             bool whitelisted,
-            const std::chrono::microseconds& timeout);
+            const std::chrono::microseconds& timeout,
+            UDPConnectedSocketCache* connected_sockets);
 };
 
 } // namespace rtps
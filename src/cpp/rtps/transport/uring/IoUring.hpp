@@ -0,0 +1,412 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTDDS_URING_IOURING_HPP_
+#define _FASTDDS_URING_IOURING_HPP_
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup) && defined(IORING_RECV_MULTISHOT)
+#define FASTDDS_IO_URING 1
+#endif // if defined(__NR_io_uring_setup) && defined(IORING_RECV_MULTISHOT)
+#endif // if __has_include(<linux/io_uring.h>)
+#endif // if defined(__linux__) && defined(__has_include)
+
+#if defined(FASTDDS_IO_URING)
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Minimal wrapper around a Linux io_uring instance, using the raw system calls.
+ *
+ * The submission and completion queues are not protected: each instance must be used from a single thread
+ * at a time.
+ */
+class IoUring
+{
+public:
+
+    IoUring() = default;
+
+    ~IoUring()
+    {
+        if (nullptr != sqes_)
+        {
+            munmap(sqes_, sqes_size_);
+        }
+        if (nullptr != cq_ring_ && cq_ring_ != sq_ring_)
+        {
+            munmap(cq_ring_, cq_ring_size_);
+        }
+        if (nullptr != sq_ring_)
+        {
+            munmap(sq_ring_, sq_ring_size_);
+        }
+        if (0 <= ring_fd_)
+        {
+            close(ring_fd_);
+        }
+    }
+
+    IoUring(
+            const IoUring&) = delete;
+    IoUring& operator =(
+            const IoUring&) = delete;
+
+    /**
+     * Creates the ring and maps its queues.
+     * @param sq_entries Number of entries of the submission queue.
+     * @param cq_entries Number of entries of the completion queue. When 0, the kernel default is used.
+     * @return 0 on success, or the negated errno value reported by the kernel.
+     */
+    int init(
+            uint32_t sq_entries,
+            uint32_t cq_entries = 0)
+    {
+        struct io_uring_params params;
+        memset(&params, 0, sizeof(params));
+        if (0 < cq_entries)
+        {
+            params.flags |= IORING_SETUP_CQSIZE;
+            params.cq_entries = (std::max)(cq_entries, 2 * sq_entries);
+        }
+
+        int fd = static_cast<int>(syscall(__NR_io_uring_setup, sq_entries, &params));
+        if (0 > fd)
+        {
+            return -errno;
+        }
+        ring_fd_ = fd;
+
+        sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+        bool single_mmap = 0 != (params.features & IORING_FEAT_SINGLE_MMAP);
+        if (single_mmap)
+        {
+            sq_ring_size_ = cq_ring_size_ = (std::max)(sq_ring_size_, cq_ring_size_);
+        }
+
+        void* ptr = mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+                        IORING_OFF_SQ_RING);
+        if (MAP_FAILED == ptr)
+        {
+            return -errno;
+        }
+        sq_ring_ = ptr;
+
+        if (single_mmap)
+        {
+            cq_ring_ = sq_ring_;
+        }
+        else
+        {
+            ptr = mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+                            IORING_OFF_CQ_RING);
+            if (MAP_FAILED == ptr)
+            {
+                return -errno;
+            }
+            cq_ring_ = ptr;
+        }
+
+        sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+        ptr = mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+                        IORING_OFF_SQES);
+        if (MAP_FAILED == ptr)
+        {
+            return -errno;
+        }
+        sqes_ = static_cast<struct io_uring_sqe*>(ptr);
+
+        char* sq = static_cast<char*>(sq_ring_);
+        sq_head_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sq_mask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sq_entries_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_entries);
+        sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+
+        char* cq = static_cast<char*>(cq_ring_);
+        cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cq_mask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+
+        sqe_head_ = sqe_tail_ = *sq_tail_;
+
+        return 0;
+    }
+
+    bool is_valid() const
+    {
+        return nullptr != sqes_;
+    }
+
+    //! @return Number of entries of the submission queue.
+    uint32_t sq_entries() const
+    {
+        return sq_entries_;
+    }
+
+    /**
+     * Takes the next free submission queue entry.
+     * @return A zeroed entry, or nullptr if the submission queue is full.
+     */
+    struct io_uring_sqe* get_sqe()
+    {
+        unsigned head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+        if (sqe_tail_ - head >= sq_entries_)
+        {
+            return nullptr;
+        }
+
+        struct io_uring_sqe* sqe = &sqes_[sqe_tail_ & sq_mask_];
+        ++sqe_tail_;
+        memset(sqe, 0, sizeof(struct io_uring_sqe));
+        return sqe;
+    }
+
+    /**
+     * Submits the prepared entries and waits for completions.
+     * @param wait_nr Number of completions to wait for.
+     * @return 0 on success, or the negated errno value reported by the kernel.
+     */
+    int submit_and_wait(
+            uint32_t wait_nr)
+    {
+        unsigned tail = *sq_tail_;
+        for (; sqe_head_ != sqe_tail_; ++sqe_head_, ++tail)
+        {
+            sq_array_[tail & sq_mask_] = sqe_head_ & sq_mask_;
+        }
+        __atomic_store_n(sq_tail_, tail, __ATOMIC_RELEASE);
+
+        unsigned flags = (0 < wait_nr) ? IORING_ENTER_GETEVENTS : 0;
+        while (true)
+        {
+            // Entries not consumed by a call interrupted by a signal are submitted again on the next one.
+            unsigned pending = tail - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+            if (0 == pending && 0 < wait_nr && nullptr != peek_cqe())
+            {
+                return 0;
+            }
+
+            long ret = syscall(__NR_io_uring_enter, ring_fd_, pending, wait_nr, flags, nullptr, 0);
+            if (0 <= ret)
+            {
+                return 0;
+            }
+            if (EINTR != errno)
+            {
+                return -errno;
+            }
+        }
+    }
+
+    /**
+     * Peeks the next completion queue entry.
+     * @return The entry, or nullptr if there are no completions available.
+     */
+    struct io_uring_cqe* peek_cqe()
+    {
+        unsigned head = *cq_head_;
+        if (head == __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE))
+        {
+            return nullptr;
+        }
+        return &cqes_[head & cq_mask_];
+    }
+
+    //! Releases the entry returned by the last call to peek_cqe.
+    void cqe_seen()
+    {
+        __atomic_store_n(cq_head_, *cq_head_ + 1, __ATOMIC_RELEASE);
+    }
+
+    /**
+     * Registers a ring of buffers the kernel can select from on reception.
+     * @param ring Page aligned memory holding the ring.
+     * @param entries Number of entries of the ring. Must be a power of two.
+     * @param group_id Identifier of the buffer group.
+     * @return 0 on success, or the negated errno value reported by the kernel.
+     */
+    int register_buffer_ring(
+            struct io_uring_buf_ring* ring,
+            uint32_t entries,
+            uint16_t group_id)
+    {
+        struct io_uring_buf_reg reg;
+        memset(&reg, 0, sizeof(reg));
+        reg.ring_addr = reinterpret_cast<uint64_t>(ring);
+        reg.ring_entries = entries;
+        reg.bgid = group_id;
+
+        long ret = syscall(__NR_io_uring_register, ring_fd_, IORING_REGISTER_PBUF_RING, &reg, 1);
+        return (0 > ret) ? -errno : 0;
+    }
+
+private:
+
+    int ring_fd_ = -1;
+
+    void* sq_ring_ = nullptr;
+    size_t sq_ring_size_ = 0;
+    void* cq_ring_ = nullptr;
+    size_t cq_ring_size_ = 0;
+    struct io_uring_sqe* sqes_ = nullptr;
+    size_t sqes_size_ = 0;
+
+    unsigned* sq_head_ = nullptr;
+    unsigned* sq_tail_ = nullptr;
+    unsigned* sq_array_ = nullptr;
+    unsigned sq_mask_ = 0;
+    unsigned sq_entries_ = 0;
+
+    unsigned* cq_head_ = nullptr;
+    unsigned* cq_tail_ = nullptr;
+    unsigned cq_mask_ = 0;
+    struct io_uring_cqe* cqes_ = nullptr;
+
+    //! Entries handed to the kernel
+    unsigned sqe_head_ = 0;
+    //! Entries prepared by the user
+    unsigned sqe_tail_ = 0;
+};
+
+/**
+ * Ring of equally sized buffers provided to the kernel, which selects one of them for each completed receive.
+ *
+ * The ring is accessed as an array of io_uring_buf, as the layout of io_uring_buf_ring in C++ differs from
+ * the kernel one. The tail of the ring overlays the reserved field of its first entry.
+ */
+class IoUringBufferRing
+{
+public:
+
+    IoUringBufferRing() = default;
+
+    ~IoUringBufferRing()
+    {
+        if (nullptr != ring_)
+        {
+            munmap(ring_, ring_size_);
+        }
+    }
+
+    IoUringBufferRing(
+            const IoUringBufferRing&) = delete;
+    IoUringBufferRing& operator =(
+            const IoUringBufferRing&) = delete;
+
+    /**
+     * Allocates the buffers and registers them on a ring.
+     * @param ring Ring the buffers are registered on.
+     * @param entries Number of buffers. Must be a power of two.
+     * @param buffer_size Size of each buffer.
+     * @param group_id Identifier of the buffer group.
+     * @return 0 on success, or the negated errno value reported by the kernel.
+     */
+    int init(
+            IoUring& ring,
+            uint32_t entries,
+            uint32_t buffer_size,
+            uint16_t group_id)
+    {
+        ring_size_ = entries * sizeof(struct io_uring_buf);
+        void* ptr = mmap(nullptr, ring_size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (MAP_FAILED == ptr)
+        {
+            return -errno;
+        }
+        ring_ = static_cast<struct io_uring_buf*>(ptr);
+        mask_ = entries - 1;
+        buffer_size_ = buffer_size;
+        buffers_.reset(new uint8_t[static_cast<size_t>(entries) * buffer_size]);
+
+        for (uint32_t bid = 0; bid < entries; ++bid)
+        {
+            add(static_cast<uint16_t>(bid), bid);
+        }
+        advance(entries);
+
+        return ring.register_buffer_ring(reinterpret_cast<struct io_uring_buf_ring*>(ring_), entries, group_id);
+    }
+
+    //! @return The buffer with the given identifier.
+    uint8_t* buffer(
+            uint16_t bid)
+    {
+        return &buffers_[static_cast<size_t>(bid) * buffer_size_];
+    }
+
+    uint32_t buffer_size() const
+    {
+        return buffer_size_;
+    }
+
+    //! Gives a buffer selected by the kernel back to the ring.
+    void recycle(
+            uint16_t bid)
+    {
+        add(bid, 0);
+        advance(1);
+    }
+
+private:
+
+    void add(
+            uint16_t bid,
+            uint32_t offset)
+    {
+        struct io_uring_buf* buf = &ring_[(tail_ + offset) & mask_];
+        buf->addr = reinterpret_cast<uint64_t>(buffer(bid));
+        buf->len = buffer_size_;
+        buf->bid = bid;
+    }
+
+    void advance(
+            uint32_t count)
+    {
+        tail_ = static_cast<uint16_t>(tail_ + count);
+        __atomic_store_n(&ring_[0].resv, tail_, __ATOMIC_RELEASE);
+    }
+
+    struct io_uring_buf* ring_ = nullptr;
+    size_t ring_size_ = 0;
+    uint32_t mask_ = 0;
+    uint16_t tail_ = 0;
+    uint32_t buffer_size_ = 0;
+    std::unique_ptr<uint8_t[]> buffers_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // if defined(FASTDDS_IO_URING)
+
+#endif // _FASTDDS_URING_IOURING_HPP_
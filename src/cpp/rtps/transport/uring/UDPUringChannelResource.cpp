@@ -0,0 +1,317 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rtps/transport/uring/UDPUringChannelResource.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#if defined(FASTDDS_IO_URING)
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif // if defined(FASTDDS_IO_URING)
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/transport/TransportReceiverInterface.h>
+
+#include <rtps/transport/UDPTransportInterface.h>
+#include <utils/threading.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+#if defined(FASTDDS_IO_URING)
+//! Completion tags
+static constexpr uint64_t receive_tag = 1;
+static constexpr uint64_t wakeup_tag = 2;
+
+//! Buffer group of the receive buffers
+static constexpr uint16_t buffer_group = 0;
+
+//! Maximum number of entries of a buffer ring
+static constexpr uint32_t max_ring_buffers = 32768;
+#endif // if defined(FASTDDS_IO_URING)
+
+UDPUringChannelResource::UDPUringChannelResource(
+        UDPTransportInterface* transport,
+        eProsimaUDPSocket& socket,
+        uint32_t maxMsgSize,
+        const Locator& locator,
+        const std::string& sInterface,
+        TransportReceiverInterface* receiver,
+        const ThreadSettings& thread_config,
+        uint32_t ring_buffers)
+    : UDPChannelResource(transport, socket, maxMsgSize, sInterface, receiver)
+    , transport_(transport)
+{
+#if defined(FASTDDS_IO_URING)
+    uring_ready_ = init_ring(maxMsgSize, ring_buffers);
+#else
+    static_cast<void>(ring_buffers);
+#endif // if defined(FASTDDS_IO_URING)
+
+    auto fn = [this, locator]()
+            {
+#if defined(FASTDDS_IO_URING)
+                if (uring_ready_ && perform_uring_listen_operation(locator))
+                {
+                    return;
+                }
+#endif // if defined(FASTDDS_IO_URING)
+                perform_listen_operation(locator);
+            };
+    thread(create_thread(fn, thread_config, "dds.udp.%u", locator.port));
+}
+
+UDPUringChannelResource::~UDPUringChannelResource()
+{
+#if defined(FASTDDS_IO_URING)
+    // The listening thread uses the ring, so it should finish before the ring is destroyed
+    disable();
+    wakeup();
+    clear();
+
+    if (0 <= wakeup_fd_)
+    {
+        close(wakeup_fd_);
+    }
+#endif // if defined(FASTDDS_IO_URING)
+}
+
+void UDPUringChannelResource::release()
+{
+    UDPChannelResource::release();
+#if defined(FASTDDS_IO_URING)
+    wakeup();
+#endif // if defined(FASTDDS_IO_URING)
+}
+
+#if defined(FASTDDS_IO_URING)
+bool UDPUringChannelResource::init_ring(
+        uint32_t max_msg_size,
+        uint32_t ring_buffers)
+{
+    uint32_t entries = 1;
+    while (entries < ring_buffers && entries < max_ring_buffers)
+    {
+        entries <<= 1;
+    }
+
+    // Every receive buffer may be waiting on the completion queue, along with the wake-up completion
+    int ret = ring_.init(4, entries + 4);
+    if (0 != ret)
+    {
+        EPROSIMA_LOG_WARNING(RTPS_MSG_IN, "io_uring not available: " << strerror(-ret)
+                                                                    << ". Receiving with blocking calls.");
+        return false;
+    }
+
+    // The event must be blocking for the read submitted to the ring to wait on it
+    wakeup_fd_ = eventfd(0, EFD_CLOEXEC);
+    if (0 > wakeup_fd_)
+    {
+        EPROSIMA_LOG_WARNING(RTPS_MSG_IN, "Cannot create io_uring wake-up event: " << strerror(errno)
+                                                                                   << ". Receiving with blocking calls.");
+        return false;
+    }
+
+    // Each buffer holds the receive header, the sender address and the datagram
+    memset(&msg_header_, 0, sizeof(msg_header_));
+    msg_header_.msg_namelen = sizeof(struct sockaddr_storage);
+    uint32_t buffer_size = static_cast<uint32_t>(sizeof(struct io_uring_recvmsg_out) + msg_header_.msg_namelen) +
+            max_msg_size;
+
+    ret = buffers_.init(ring_, entries, buffer_size, buffer_group);
+    if (0 != ret)
+    {
+        EPROSIMA_LOG_WARNING(RTPS_MSG_IN, "Cannot register io_uring receive buffers: " << strerror(-ret)
+                                                                                       << ". Receiving with blocking calls.");
+        return false;
+    }
+
+    return true;
+}
+
+bool UDPUringChannelResource::perform_uring_listen_operation(
+        Locator input_locator)
+{
+    Locator remote_locator;
+    bool receive_armed = false;
+    bool wakeup_armed = false;
+    bool received_any = false;
+
+    while (alive())
+    {
+        if (!receive_armed)
+        {
+            receive_armed = arm_receive();
+        }
+        if (!wakeup_armed)
+        {
+            wakeup_armed = arm_wakeup();
+        }
+
+        int ret = ring_.submit_and_wait(1);
+        if (0 != ret && alive())
+        {
+            EPROSIMA_LOG_WARNING(RTPS_MSG_IN, "Error waiting on io_uring: " << strerror(-ret) << " - "
+                                                                           << message_receiver()
+                                                                           << " (" << this << ")");
+        }
+
+        struct io_uring_cqe* cqe = nullptr;
+        while (nullptr != (cqe = ring_.peek_cqe()))
+        {
+            uint64_t user_data = cqe->user_data;
+            int32_t res = cqe->res;
+            uint32_t flags = cqe->flags;
+            ring_.cqe_seen();
+
+            if (wakeup_tag == user_data)
+            {
+                wakeup_armed = false;
+                continue;
+            }
+
+            // The multishot operation is terminated on errors and when the ring runs out of buffers
+            if (0 == (flags & IORING_CQE_F_MORE))
+            {
+                receive_armed = false;
+            }
+
+            if (0 != (flags & IORING_CQE_F_BUFFER))
+            {
+                uint16_t bid = static_cast<uint16_t>(flags >> IORING_CQE_BUFFER_SHIFT);
+                if (0 < res && alive())
+                {
+                    deliver(buffers_.buffer(bid), input_locator, remote_locator);
+                    received_any = true;
+                }
+                buffers_.recycle(bid);
+            }
+            else if (-EINVAL == res && !received_any)
+            {
+                EPROSIMA_LOG_WARNING(RTPS_MSG_IN, "Multishot receive not supported by the kernel. "
+                        "Receiving with blocking calls.");
+                return false;
+            }
+            else if (0 > res && -ENOBUFS != res && alive())
+            {
+                EPROSIMA_LOG_WARNING(RTPS_MSG_IN, "Error receiving data: " << strerror(-res) << " - "
+                                                                           << message_receiver()
+                                                                           << " (" << this << ")");
+            }
+        }
+    }
+
+    message_receiver(nullptr);
+    return true;
+}
+
+bool UDPUringChannelResource::arm_receive()
+{
+    struct io_uring_sqe* sqe = ring_.get_sqe();
+    if (nullptr == sqe)
+    {
+        return false;
+    }
+
+    sqe->opcode = IORING_OP_RECVMSG;
+    sqe->fd = socket()->native_handle();
+    sqe->addr = reinterpret_cast<uint64_t>(&msg_header_);
+    sqe->len = 1;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = buffer_group;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->user_data = receive_tag;
+    return true;
+}
+
+bool UDPUringChannelResource::arm_wakeup()
+{
+    struct io_uring_sqe* sqe = ring_.get_sqe();
+    if (nullptr == sqe)
+    {
+        return false;
+    }
+
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = wakeup_fd_;
+    sqe->addr = reinterpret_cast<uint64_t>(&wakeup_value_);
+    sqe->len = sizeof(wakeup_value_);
+    sqe->user_data = wakeup_tag;
+    return true;
+}
+
+void UDPUringChannelResource::deliver(
+        uint8_t* buffer,
+        const Locator& input_locator,
+        Locator& remote_locator)
+{
+    struct io_uring_recvmsg_out* out = reinterpret_cast<struct io_uring_recvmsg_out*>(buffer);
+    uint8_t* name = buffer + sizeof(struct io_uring_recvmsg_out);
+    uint8_t* payload = name + msg_header_.msg_namelen + msg_header_.msg_controllen;
+    uint32_t length = out->payloadlen;
+
+    if (0 != (out->flags & MSG_TRUNC))
+    {
+        EPROSIMA_LOG_WARNING(RTPS_MSG_IN, "Received datagram bigger than the receive buffer. Discarded.");
+        return;
+    }
+
+    // This is not necessary anymore but it's left here for back compatibility with versions older than 1.8.1
+    if (0 == length || (length == 13 && memcmp(payload, "EPRORTPSCLOSE", 13) == 0))
+    {
+        return;
+    }
+
+    asio::ip::udp::endpoint sender_endpoint;
+    size_t name_length = (std::min)(static_cast<size_t>(out->namelen), static_cast<size_t>(msg_header_.msg_namelen));
+    if (name_length > sender_endpoint.capacity())
+    {
+        return;
+    }
+    memcpy(sender_endpoint.data(), name, name_length);
+    sender_endpoint.resize(name_length);
+    transport_->endpoint_to_locator(sender_endpoint, remote_locator);
+
+    // Processes the data through the CDR Message interface.
+    if (message_receiver() != nullptr)
+    {
+        message_receiver()->OnDataReceived(payload, length, input_locator, remote_locator);
+    }
+    else if (alive())
+    {
+        EPROSIMA_LOG_WARNING(RTPS_MSG_IN, "Received Message, but no receiver attached");
+    }
+}
+
+void UDPUringChannelResource::wakeup()
+{
+    if (0 <= wakeup_fd_)
+    {
+        uint64_t value = 1;
+        ssize_t written = write(wakeup_fd_, &value, sizeof(value));
+        static_cast<void>(written);
+    }
+}
+
+#endif // if defined(FASTDDS_IO_URING)
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
@@ -0,0 +1,103 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTDDS_UDP_URING_CHANNEL_RESOURCE_H_
+#define _FASTDDS_UDP_URING_CHANNEL_RESOURCE_H_
+
+#include <rtps/transport/UDPChannelResource.h>
+#include <rtps/transport/uring/IoUring.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * UDP input channel receiving through io_uring.
+ *
+ * A multishot receive operation is kept armed on the socket, so a single submission serves any number of
+ * datagrams. The kernel places each datagram on one of the buffers of a ring provided by the channel, which is
+ * handed to the message receiver without further copies and given back to the kernel afterwards.
+ *
+ * When io_uring is not available, the channel falls back to the blocking receive of UDPChannelResource.
+ */
+class UDPUringChannelResource : public UDPChannelResource
+{
+public:
+
+    UDPUringChannelResource(
+            UDPTransportInterface* transport,
+            eProsimaUDPSocket& socket,
+            uint32_t maxMsgSize,
+            const Locator& locator,
+            const std::string& sInterface,
+            TransportReceiverInterface* receiver,
+            const ThreadSettings& thread_config,
+            uint32_t ring_buffers);
+
+    virtual ~UDPUringChannelResource() override;
+
+    void release() override;
+
+private:
+
+#if defined(FASTDDS_IO_URING)
+    /**
+     * Creates the ring, the wake-up event and the receive buffers.
+     * @return true when the channel is able to receive through io_uring.
+     */
+    bool init_ring(
+            uint32_t max_msg_size,
+            uint32_t ring_buffers);
+
+    /**
+     * Function to be called from the listening thread when the ring could be initialized.
+     * @param input_locator - Locator that triggered the creation of the resource
+     * @return false if the kernel does not support multishot receive operations on the socket.
+     */
+    bool perform_uring_listen_operation(
+            Locator input_locator);
+
+    //! Submits the multishot receive operation.
+    bool arm_receive();
+
+    //! Submits the wait on the wake-up event used to unblock the listening thread.
+    bool arm_wakeup();
+
+    //! Hands a datagram placed by the kernel on a ring buffer to the message receiver.
+    void deliver(
+            uint8_t* buffer,
+            const Locator& input_locator,
+            Locator& remote_locator);
+
+    //! Unblocks the listening thread.
+    void wakeup();
+
+    IoUring ring_;
+    IoUringBufferRing buffers_;
+    //! Layout of the buffers used by the multishot receive operation
+    struct msghdr msg_header_;
+    //! Event used to unblock the listening thread when the channel is released
+    int wakeup_fd_ = -1;
+    uint64_t wakeup_value_ = 0;
+    bool uring_ready_ = false;
+#endif // if defined(FASTDDS_IO_URING)
+
+    UDPTransportInterface* transport_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_UDP_URING_CHANNEL_RESOURCE_H_
@@ -0,0 +1,286 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rtps/transport/uring/UDPv4UringTransport.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastrtps/utils/IPLocator.h>
+
+#include <rtps/transport/uring/UDPUringChannelResource.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+using IPLocator = fastrtps::rtps::IPLocator;
+using Log = fastdds::dds::Log;
+
+#if defined(FASTDDS_IO_URING)
+//! Completion tag of the timeouts linked to the send operations
+static constexpr uint64_t link_timeout_tag = (std::numeric_limits<uint64_t>::max)();
+#endif // if defined(FASTDDS_IO_URING)
+
+UDPv4UringTransportDescriptor::UDPv4UringTransportDescriptor()
+    : UDPv4TransportDescriptor()
+{
+}
+
+TransportInterface* UDPv4UringTransportDescriptor::create_transport() const
+{
+    return new UDPv4UringTransport(*this);
+}
+
+bool UDPv4UringTransportDescriptor::operator ==(
+        const UDPv4UringTransportDescriptor& t) const
+{
+    return (this->send_ring_entries == t.send_ring_entries &&
+           this->receive_ring_buffers == t.receive_ring_buffers &&
+           UDPv4TransportDescriptor::operator ==(t));
+}
+
+UDPv4UringTransport::UDPv4UringTransport(
+        const UDPv4UringTransportDescriptor& descriptor)
+    : UDPv4Transport(descriptor)
+    , send_ring_entries_((std::max)(descriptor.send_ring_entries, 2u))
+    , receive_ring_buffers_((std::max)(descriptor.receive_ring_buffers, 1u))
+{
+}
+
+UDPv4UringTransport::~UDPv4UringTransport()
+{
+}
+
+bool UDPv4UringTransport::init(
+        const fastrtps::rtps::PropertyPolicy* properties)
+{
+    if (!UDPv4Transport::init(properties))
+    {
+        return false;
+    }
+
+#if defined(FASTDDS_IO_URING)
+    std::unique_ptr<IoUring> ring(new IoUring());
+    int ret = ring->init(send_ring_entries_);
+    if (0 != ret)
+    {
+        EPROSIMA_LOG_WARNING(RTPS_MSG_OUT, "io_uring not available: " << strerror(-ret)
+                                                                     << ". Sending with system calls.");
+    }
+    else
+    {
+        send_rings_available_ = true;
+        release_send_ring(std::move(ring));
+
+        // Messages to a single destination also go through the ring
+        min_batch_destinations_ = 1;
+    }
+#else
+    EPROSIMA_LOG_WARNING(RTPS_MSG_OUT, "io_uring not supported on this platform. Behaving as UDPv4 transport.");
+#endif // if defined(FASTDDS_IO_URING)
+
+    return true;
+}
+
+UDPChannelResource* UDPv4UringTransport::CreateInputChannelResource(
+        const std::string& sInterface,
+        const Locator& locator,
+        bool is_multicast,
+        uint32_t maxMsgSize,
+        TransportReceiverInterface* receiver)
+{
+    eProsimaUDPSocket unicastSocket = OpenAndBindInputSocket(sInterface,
+                    IPLocator::getPhysicalPort(locator), is_multicast);
+    UDPChannelResource* p_channel_resource = new UDPUringChannelResource(this, unicastSocket, maxMsgSize, locator,
+                    sInterface, receiver, configuration()->get_thread_config_for_port(locator.port),
+                    receive_ring_buffers_);
+    return p_channel_resource;
+}
+
+#if defined(__linux__)
+bool UDPv4UringTransport::send_datagrams(
+        eProsimaUDPSocket& socket,
+        std::vector<struct mmsghdr>& headers,
+        const std::vector<asio::ip::udp::endpoint>& endpoints,
+        const std::chrono::microseconds& timeout)
+{
+#if defined(FASTDDS_IO_URING)
+    // Zero-copy sends rely on the completion notifications of the socket error queue
+    if (send_rings_available_ && !headers.empty() && !use_zero_copy(headers[0].msg_hdr))
+    {
+        std::unique_ptr<IoUring> ring = acquire_send_ring();
+        if (ring)
+        {
+            bool ring_failed = false;
+            bool ret = send_through_ring(*ring, socket, headers, endpoints, timeout, ring_failed);
+            if (!ring_failed)
+            {
+                release_send_ring(std::move(ring));
+            }
+            return ret;
+        }
+    }
+#endif // if defined(FASTDDS_IO_URING)
+
+    return UDPv4Transport::send_datagrams(socket, headers, endpoints, timeout);
+}
+
+#endif // if defined(__linux__)
+
+#if defined(FASTDDS_IO_URING)
+std::unique_ptr<IoUring> UDPv4UringTransport::acquire_send_ring()
+{
+    {
+        std::lock_guard<std::mutex> guard(send_rings_mutex_);
+        if (!idle_send_rings_.empty())
+        {
+            std::unique_ptr<IoUring> ring = std::move(idle_send_rings_.back());
+            idle_send_rings_.pop_back();
+            return ring;
+        }
+    }
+
+    std::unique_ptr<IoUring> ring(new IoUring());
+    int ret = ring->init(send_ring_entries_);
+    if (0 != ret)
+    {
+        EPROSIMA_LOG_WARNING(RTPS_MSG_OUT, "Could not create io_uring send ring: " << strerror(-ret)
+                                                                                  << ". Sending with system calls.");
+        ring.reset();
+    }
+    return ring;
+}
+
+void UDPv4UringTransport::release_send_ring(
+        std::unique_ptr<IoUring> ring)
+{
+    std::lock_guard<std::mutex> guard(send_rings_mutex_);
+    idle_send_rings_.push_back(std::move(ring));
+}
+
+bool UDPv4UringTransport::send_through_ring(
+        IoUring& ring,
+        eProsimaUDPSocket& socket,
+        std::vector<struct mmsghdr>& headers,
+        const std::vector<asio::ip::udp::endpoint>& endpoints,
+        const std::chrono::microseconds& timeout,
+        bool& ring_failed)
+{
+    bool ret = true;
+    int fd = getSocketPtr(socket)->native_handle();
+
+    // Send operations not completed on time are cancelled, dropping the datagram as a socket send timeout does.
+    // Without a timeout, datagrams that do not fit on the socket are dropped straight away.
+    bool use_timeout = 0 < timeout.count();
+    struct __kernel_timespec timeout_spec;
+    timeout_spec.tv_sec = static_cast<int64_t>(timeout.count() / 1000000);
+    timeout_spec.tv_nsec = static_cast<long long>((timeout.count() % 1000000) * 1000);
+
+    const size_t entries_per_datagram = use_timeout ? 2 : 1;
+    const size_t datagrams_per_submission = ring.sq_entries() / entries_per_datagram;
+
+    size_t next = 0;
+    while (next < headers.size())
+    {
+        size_t count = (std::min)(datagrams_per_submission, headers.size() - next);
+        for (size_t i = next; i < next + count; ++i)
+        {
+            // The submission queue is empty at this point, so it has room for the whole submission
+            struct io_uring_sqe* sqe = ring.get_sqe();
+            sqe->opcode = IORING_OP_SENDMSG;
+            sqe->fd = fd;
+            sqe->addr = reinterpret_cast<uint64_t>(&headers[i].msg_hdr);
+            sqe->len = 1;
+            sqe->user_data = i;
+
+            if (use_timeout)
+            {
+                sqe->flags = IOSQE_IO_LINK;
+
+                struct io_uring_sqe* timeout_sqe = ring.get_sqe();
+                timeout_sqe->opcode = IORING_OP_LINK_TIMEOUT;
+                timeout_sqe->fd = -1;
+                timeout_sqe->addr = reinterpret_cast<uint64_t>(&timeout_spec);
+                timeout_sqe->len = 1;
+                timeout_sqe->user_data = link_timeout_tag;
+            }
+            else
+            {
+                sqe->msg_flags = MSG_DONTWAIT;
+            }
+        }
+
+        // All the completions are reaped before returning, as the kernel references the caller's buffers
+        size_t pending = count * entries_per_datagram;
+        while (0 < pending)
+        {
+            int result = ring.submit_and_wait(static_cast<uint32_t>(pending));
+            if (0 != result && -EBUSY != result && -EAGAIN != result)
+            {
+                // The ring is left in an unknown state, so it is not used anymore
+                EPROSIMA_LOG_ERROR(RTPS_MSG_OUT, "Error submitting to io_uring: " << strerror(-result)
+                                                                                 << ". Discarding the send ring.");
+                ring_failed = true;
+                return false;
+            }
+
+            struct io_uring_cqe* cqe = nullptr;
+            while (nullptr != (cqe = ring.peek_cqe()))
+            {
+                uint64_t user_data = cqe->user_data;
+                int32_t res = cqe->res;
+                ring.cqe_seen();
+                --pending;
+
+                if (link_timeout_tag == user_data)
+                {
+                    continue;
+                }
+
+                size_t i = static_cast<size_t>(user_data);
+                if (0 <= res)
+                {
+                    EPROSIMA_LOG_INFO(RTPS_MSG_OUT, "UDPTransport: " << res << " bytes TO endpoint: "
+                                                                     << endpoints[i] << " FROM "
+                                                                     << getSocketPtr(socket)->local_endpoint());
+                }
+                else if (-ECANCELED == res || -EAGAIN == res || -EWOULDBLOCK == res)
+                {
+                    EPROSIMA_LOG_WARNING(RTPS_MSG_OUT, "UDP send would have blocked. Packet is dropped.");
+                }
+                else
+                {
+                    EPROSIMA_LOG_WARNING(RTPS_MSG_OUT, "UDPTransport error sending to endpoint " << endpoints[i]
+                                                                                                << ": " << strerror(
+                                -res));
+                    ret = false;
+                }
+            }
+        }
+
+        next += count;
+    }
+
+    return ret;
+}
+
+#endif // if defined(FASTDDS_IO_URING)
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
@@ -0,0 +1,117 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTDDS_UDPV4_URING_TRANSPORT_H
+#define _FASTDDS_UDPV4_URING_TRANSPORT_H
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <fastdds/rtps/transport/UDPv4UringTransportDescriptor.h>
+#include <rtps/transport/UDPv4Transport.h>
+#include <rtps/transport/uring/IoUring.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * UDPv4 transport whose data path goes through io_uring.
+ *
+ *    - Each input channel keeps a multishot receive operation armed on its socket, and the kernel places the
+ *      datagrams on a ring of buffers owned by the channel. See UDPUringChannelResource.
+ *
+ *    - The datagrams for all the destinations of a message are handed to the kernel with a single submission
+ *      on a send ring. Each sending thread takes a ring of its own from a pool for the duration of the
+ *      submission, so concurrent senders do not wait for each other's completions.
+ *
+ * Socket management, locators and interface handling are those of UDPv4Transport, which is also the behavior
+ * of this transport when io_uring is not available on the running system.
+ * @ingroup TRANSPORT_MODULE
+ */
+class UDPv4UringTransport : public UDPv4Transport
+{
+public:
+
+    UDPv4UringTransport(
+            const UDPv4UringTransportDescriptor&);
+
+    ~UDPv4UringTransport() override;
+
+    bool init(
+            const fastrtps::rtps::PropertyPolicy* properties = nullptr) override;
+
+protected:
+
+    UDPChannelResource* CreateInputChannelResource(
+            const std::string& sInterface,
+            const Locator& locator,
+            bool is_multicast,
+            uint32_t maxMsgSize,
+            TransportReceiverInterface* receiver) override;
+
+#if defined(__linux__)
+    bool send_datagrams(
+            eProsimaUDPSocket& socket,
+            std::vector<struct mmsghdr>& headers,
+            const std::vector<asio::ip::udp::endpoint>& endpoints,
+            const std::chrono::microseconds& timeout) override;
+#endif // if defined(__linux__)
+
+private:
+
+#if defined(FASTDDS_IO_URING)
+    /**
+     * Sends the datagrams through the given send ring.
+     * @param [out] ring_failed Set when the ring is left in an unknown state and should not be used anymore.
+     * @return false if any datagram could not be sent.
+     */
+    bool send_through_ring(
+            IoUring& ring,
+            eProsimaUDPSocket& socket,
+            std::vector<struct mmsghdr>& headers,
+            const std::vector<asio::ip::udp::endpoint>& endpoints,
+            const std::chrono::microseconds& timeout,
+            bool& ring_failed);
+
+    //! Takes an idle send ring from the pool, creating a new one when all of them are in use.
+    std::unique_ptr<IoUring> acquire_send_ring();
+
+    //! Gives a send ring back to the pool.
+    void release_send_ring(
+            std::unique_ptr<IoUring> ring);
+#endif // if defined(FASTDDS_IO_URING)
+
+    uint32_t send_ring_entries_;
+
+    uint32_t receive_ring_buffers_;
+
+#if defined(FASTDDS_IO_URING)
+    //! Whether io_uring could be set up on init
+    bool send_rings_available_ = false;
+
+    //! Protects idle_send_rings_. Never held during a submission.
+    std::mutex send_rings_mutex_;
+
+    //! Send rings not in use by any sending thread
+    std::vector<std::unique_ptr<IoUring>> idle_send_rings_;
+#endif // if defined(FASTDDS_IO_URING)
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_UDPV4_URING_TRANSPORT_H
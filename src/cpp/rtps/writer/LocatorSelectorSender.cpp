@@ -12,6 +12,15 @@ bool LocatorSelectorSender::send(
     return writer_.send_nts(message, *this, max_blocking_time_point);
 }
 
+bool LocatorSelectorSender::send_gather(
+        const std::vector<fastdds::rtps::NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        uint32_t segment_size,
+        std::chrono::steady_clock::time_point max_blocking_time_point) const
+{
+    return writer_.send_gather_nts(buffers, total_bytes, segment_size, *this, max_blocking_time_point);
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
@@ -442,6 +442,21 @@ bool RTPSWriter::send_nts(
                    locator_selector.locator_selector.end(), max_blocking_time_point);
 }
 
+bool RTPSWriter::send_gather_nts(
+        const std::vector<fastdds::rtps::NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        uint32_t segment_size,
+        const LocatorSelectorSender& locator_selector,
+        std::chrono::steady_clock::time_point& max_blocking_time_point) const
+{
+    RTPSParticipantImpl* participant = getRTPSParticipant();
+
+    return locator_selector.locator_selector.selected_size() == 0 ||
+           participant->sendSync(buffers, total_bytes, segment_size, m_guid,
+                   locator_selector.locator_selector.begin(), locator_selector.locator_selector.end(),
+                   max_blocking_time_point);
+}
+
 #ifdef FASTDDS_STATISTICS
 
 bool RTPSWriter::add_statistics_listener(
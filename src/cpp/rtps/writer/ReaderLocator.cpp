@@ -202,6 +202,33 @@ bool ReaderLocator::send(
     return true;
 }
 
+bool ReaderLocator::send_gather(
+        const std::vector<fastdds::rtps::NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        uint32_t segment_size,
+        std::chrono::steady_clock::time_point max_blocking_time_point) const
+{
+    if (general_locator_info_.remote_guid != c_Guid_Unknown && !is_local_reader_)
+    {
+        if (general_locator_info_.unicast.size() > 0)
+        {
+            return participant_owner_->sendSync(buffers, total_bytes, segment_size, owner_->getGuid(),
+                           Locators(general_locator_info_.unicast.begin()), Locators(
+                               general_locator_info_.unicast.end()),
+                           max_blocking_time_point);
+        }
+        else
+        {
+            return participant_owner_->sendSync(buffers, total_bytes, segment_size, owner_->getGuid(),
+                           Locators(general_locator_info_.multicast.begin()),
+                           Locators(general_locator_info_.multicast.end()),
+                           max_blocking_time_point);
+        }
+    }
+
+    return true;
+}
+
 RTPSReader* ReaderLocator::local_reader()
 {
     if (!local_reader_)
@@ -724,6 +724,25 @@ bool StatelessWriter::send_nts(
                    max_blocking_time_point);
 }
 
+bool StatelessWriter::send_gather_nts(
+        const std::vector<fastdds::rtps::NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        uint32_t segment_size,
+        const LocatorSelectorSender& locator_selector,
+        std::chrono::steady_clock::time_point& max_blocking_time_point) const
+{
+    if (!RTPSWriter::send_gather_nts(buffers, total_bytes, segment_size, locator_selector,
+            max_blocking_time_point))
+    {
+        return false;
+    }
+
+    return fixed_locators_.empty() ||
+           mp_RTPSParticipant->sendSync(buffers, total_bytes, segment_size, m_guid,
+                   Locators(fixed_locators_.begin()), Locators(fixed_locators_.end()),
+                   max_blocking_time_point);
+}
+
 DeliveryRetCode StatelessWriter::deliver_sample_nts(
         CacheChange_t* cache_change,
         RTPSMessageGroup& group,
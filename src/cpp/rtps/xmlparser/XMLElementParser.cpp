@@ -2137,6 +2137,7 @@ XMLP_ret XMLParser::getXMLDataSharingQos(
                 </xs:element>
                 <xs:element name="max_domains" type="uint32" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="data_sharing_listener_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="spin_duration" type="durationType" minOccurs="0" maxOccurs="1"/>
             </xs:all>
         </xs:complexType>
      */
@@ -2248,6 +2249,14 @@ XMLP_ret XMLParser::getXMLDataSharingQos(
                 return XMLP_ret::XML_ERROR;
             }
         }
+        else if (strcmp(name, DATA_SHARING_SPIN_DURATION) == 0)
+        {
+            // spin_duration
+            if (XMLP_ret::XML_OK != getXMLDuration(p_aux0, data_sharing.spin_duration(), ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
         else
         {
             EPROSIMA_LOG_ERROR(XMLPARSER, "Invalid element found in 'data_sharing'. Name: " << name);
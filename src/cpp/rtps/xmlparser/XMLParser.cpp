@@ -26,6 +26,7 @@
 #include <fastdds/dds/log/StdoutErrConsumer.hpp>
 #include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/rtps/transport/shared_mem/SharedMemTransportDescriptor.h>
+#include <fastdds/rtps/transport/UDPv4UringTransportDescriptor.h>
 #include <fastrtps/transport/TCPv4TransportDescriptor.h>
 #include <fastrtps/transport/TCPv6TransportDescriptor.h>
 #include <fastrtps/transport/UDPv4TransportDescriptor.h>
@@ -234,6 +235,15 @@ XMLP_ret XMLParser::parseXMLTransportData(
                 <xs:element name="receiveBufferSize" type="int32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="TTL" type="uint8Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="non_blocking_send" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="send_ring_entries" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="receive_ring_buffers" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="receive_batch_size" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="segmentation_offload" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="receive_shards" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="zero_copy_send_threshold" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="busy_poll_budget_us" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="receive_timestamps" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="max_connected_sockets" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="maxMessageSize" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="maxInitialPeersRange" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="interfaceWhiteList" type="stringListType" minOccurs="0" maxOccurs="1"/>
@@ -291,13 +301,36 @@ XMLP_ret XMLParser::parseXMLTransportData(
         return XMLP_ret::XML_ERROR;
     }
 
-    if (sType == UDPv4 || sType == UDPv6)
+    if (sType == UDPv4 || sType == UDPv6 || sType == UDPv4_URING)
     {
         std::shared_ptr<rtps::UDPTransportDescriptor> pUDPDesc;
         if (sType == UDPv4)
         {
             pDescriptor = pUDPDesc = std::make_shared<rtps::UDPv4TransportDescriptor>();
         }
+        else if (sType == UDPv4_URING)
+        {
+            std::shared_ptr<fastdds::rtps::UDPv4UringTransportDescriptor> pUringDesc =
+                    std::make_shared<fastdds::rtps::UDPv4UringTransportDescriptor>();
+            pDescriptor = pUDPDesc = pUringDesc;
+
+            // Send ring entries
+            if (nullptr != (p_aux0 = p_root->FirstChildElement(SEND_RING_ENTRIES)))
+            {
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pUringDesc->send_ring_entries, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
+            // Receive ring buffers
+            if (nullptr != (p_aux0 = p_root->FirstChildElement(RECEIVE_RING_BUFFERS)))
+            {
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pUringDesc->receive_ring_buffers, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
+        }
         else
         {
             pDescriptor = pUDPDesc = std::make_shared<rtps::UDPv6TransportDescriptor>();
@@ -321,6 +354,62 @@ XMLP_ret XMLParser::parseXMLTransportData(
                 return XMLP_ret::XML_ERROR;
             }
         }
+        // Receive batch size
+        if (nullptr != (p_aux0 = p_root->FirstChildElement(RECEIVE_BATCH_SIZE)))
+        {
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pUDPDesc->receive_batch_size, 0))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        // Segmentation offload
+        if (nullptr != (p_aux0 = p_root->FirstChildElement(SEGMENTATION_OFFLOAD)))
+        {
+            if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &pUDPDesc->segmentation_offload, 0))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        // Receive shards
+        if (nullptr != (p_aux0 = p_root->FirstChildElement(RECEIVE_SHARDS)))
+        {
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pUDPDesc->receive_shards, 0))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        // Zero-copy send threshold
+        if (nullptr != (p_aux0 = p_root->FirstChildElement(ZERO_COPY_SEND_THRESHOLD)))
+        {
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pUDPDesc->zero_copy_send_threshold, 0))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        // Busy poll budget
+        if (nullptr != (p_aux0 = p_root->FirstChildElement(BUSY_POLL_BUDGET_US)))
+        {
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pUDPDesc->busy_poll_budget_us, 0))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        // Receive timestamps
+        if (nullptr != (p_aux0 = p_root->FirstChildElement(RECEIVE_TIMESTAMPS)))
+        {
+            if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &pUDPDesc->receive_timestamps, 0))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        // Maximum connected sockets
+        if (nullptr != (p_aux0 = p_root->FirstChildElement(MAX_CONNECTED_SOCKETS)))
+        {
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pUDPDesc->max_connected_sockets, 0))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
     }
     else if (sType == TCPv4)
     {
@@ -418,6 +507,15 @@ XMLP_ret XMLParser::validateXMLTransportElements(
                 strcmp(name, TTL) == 0 ||
                 strcmp(name, NON_BLOCKING_SEND) == 0 ||
                 strcmp(name, UDP_OUTPUT_PORT) == 0 ||
+                strcmp(name, SEND_RING_ENTRIES) == 0 ||
+                strcmp(name, RECEIVE_RING_BUFFERS) == 0 ||
+                strcmp(name, RECEIVE_BATCH_SIZE) == 0 ||
+                strcmp(name, SEGMENTATION_OFFLOAD) == 0 ||
+                strcmp(name, RECEIVE_SHARDS) == 0 ||
+                strcmp(name, ZERO_COPY_SEND_THRESHOLD) == 0 ||
+                strcmp(name, BUSY_POLL_BUDGET_US) == 0 ||
+                strcmp(name, RECEIVE_TIMESTAMPS) == 0 ||
+                strcmp(name, MAX_CONNECTED_SOCKETS) == 0 ||
                 strcmp(name, TCP_WAN_ADDR) == 0 ||
                 strcmp(name, KEEP_ALIVE_FREQUENCY) == 0 ||
                 strcmp(name, KEEP_ALIVE_TIMEOUT) == 0 ||
@@ -429,11 +527,18 @@ XMLP_ret XMLParser::validateXMLTransportElements(
                 strcmp(name, CHECK_CRC) == 0 ||
                 strcmp(name, KEEP_ALIVE_THREAD) == 0 ||
                 strcmp(name, ACCEPT_THREAD) == 0 ||
+                strcmp(name, REACTOR_THREADS) == 0 ||
+                strcmp(name, REACTOR_THREAD) == 0 ||
+                strcmp(name, SEND_QUEUE_SIZE) == 0 ||
+                strcmp(name, CONNECTION_STREAMS) == 0 ||
                 strcmp(name, ENABLE_TCP_NODELAY) == 0 ||
                 strcmp(name, TLS) == 0 ||
                 strcmp(name, SEGMENT_SIZE) == 0 ||
                 strcmp(name, PORT_QUEUE_CAPACITY) == 0 ||
                 strcmp(name, HEALTHY_CHECK_TIMEOUT_MS) == 0 ||
+                strcmp(name, HUGE_PAGES) == 0 ||
+                strcmp(name, NUMA_NODE) == 0 ||
+                strcmp(name, MAX_SEGMENT_SIZE) == 0 ||
                 strcmp(name, RTPS_DUMP_FILE) == 0 ||
                 strcmp(name, DEFAULT_RECEPTION_THREADS) == 0 ||
                 strcmp(name, RECEPTION_THREADS) == 0 ||
@@ -638,6 +743,10 @@ XMLP_ret XMLParser::parseXMLCommonTCPTransportData(
                 <xs:element name="tls" type="tlsConfigType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="keep_alive_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="accept_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="reactor_threads" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="reactor_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="send_queue_size" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="connection_streams" type="uint16Type" minOccurs="0" maxOccurs="1"/>
             </xs:all>
         </xs:complexType>
      */
@@ -763,6 +872,38 @@ XMLP_ret XMLParser::parseXMLCommonTCPTransportData(
                     return XMLP_ret::XML_ERROR;
                 }
             }
+            else if (strcmp(name, REACTOR_THREADS) == 0)
+            {
+                // reactor_threads - uint32Type
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pTCPDesc->reactor_threads, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
+            else if (strcmp(name, REACTOR_THREAD) == 0)
+            {
+                if (getXMLThreadSettings(*p_aux0, pTCPDesc->reactor_thread) != XMLP_ret::XML_OK)
+                {
+                    EPROSIMA_LOG_ERROR(XMLPARSER, "Incorrect thread settings");
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
+            else if (strcmp(name, SEND_QUEUE_SIZE) == 0)
+            {
+                // send_queue_size - uint32Type
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pTCPDesc->send_queue_size, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
+            else if (strcmp(name, CONNECTION_STREAMS) == 0)
+            {
+                // connection_streams - uint16Type
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pTCPDesc->connection_streams, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
         }
     }
     else
@@ -788,6 +929,10 @@ XMLP_ret XMLParser::parseXMLCommonSharedMemTransportData(
                 <xs:element name="healthy_check_timeout_ms" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="rtps_dump_file" type="stringType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="dump_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="busy_poll_budget_us" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="huge_pages" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="numa_node" type="int32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="max_segment_size" type="uint32Type" minOccurs="0" maxOccurs="1"/>
             </xs:all>
         </xs:complexType>
      */
@@ -846,6 +991,40 @@ XMLP_ret XMLParser::parseXMLCommonSharedMemTransportData(
                 }
                 transport_descriptor->dump_thread(thread_settings);
             }
+            else if (strcmp(name, BUSY_POLL_BUDGET_US) == 0)
+            {
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &aux, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->busy_poll_budget_us(static_cast<uint32_t>(aux));
+            }
+            else if (strcmp(name, HUGE_PAGES) == 0)
+            {
+                bool b = false;
+                if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &b, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->huge_pages(b);
+            }
+            else if (strcmp(name, NUMA_NODE) == 0)
+            {
+                int i = 0;
+                if (XMLP_ret::XML_OK != getXMLInt(p_aux0, &i, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->numa_node(static_cast<int32_t>(i));
+            }
+            else if (strcmp(name, MAX_SEGMENT_SIZE) == 0)
+            {
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &aux, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->max_segment_size(static_cast<uint32_t>(aux));
+            }
             // Do not parse nor fail on unkown tags; these may be parsed elsewhere
         }
     }
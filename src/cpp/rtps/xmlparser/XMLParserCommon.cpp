@@ -47,6 +47,15 @@ const char* RECEIVE_BUFFER_SIZE = "receiveBufferSize";
 const char* SEND_BUFFER_SIZE = "sendBufferSize";
 const char* TTL = "TTL";
 const char* NON_BLOCKING_SEND = "non_blocking_send";
+const char* SEND_RING_ENTRIES = "send_ring_entries";
+const char* RECEIVE_RING_BUFFERS = "receive_ring_buffers";
+const char* RECEIVE_BATCH_SIZE = "receive_batch_size";
+const char* SEGMENTATION_OFFLOAD = "segmentation_offload";
+const char* RECEIVE_SHARDS = "receive_shards";
+const char* ZERO_COPY_SEND_THRESHOLD = "zero_copy_send_threshold";
+const char* BUSY_POLL_BUDGET_US = "busy_poll_budget_us";
+const char* RECEIVE_TIMESTAMPS = "receive_timestamps";
+const char* MAX_CONNECTED_SOCKETS = "max_connected_sockets";
 const char* WHITE_LIST = "interfaceWhiteList";
 const char* INTERFACE = "interface";
 const char* MAX_MESSAGE_SIZE = "maxMessageSize";
@@ -63,11 +72,18 @@ const char* CALCULATE_CRC = "calculate_crc";
 const char* CHECK_CRC = "check_crc";
 const char* KEEP_ALIVE_THREAD = "keep_alive_thread";
 const char* ACCEPT_THREAD = "accept_thread";
+const char* REACTOR_THREADS = "reactor_threads";
+const char* REACTOR_THREAD = "reactor_thread";
+const char* SEND_QUEUE_SIZE = "send_queue_size";
+const char* CONNECTION_STREAMS = "connection_streams";
 const char* SEGMENT_SIZE = "segment_size";
 const char* PORT_QUEUE_CAPACITY = "port_queue_capacity";
 const char* PORT_OVERFLOW_POLICY = "port_overflow_policy";
 const char* SEGMENT_OVERFLOW_POLICY = "segment_overflow_policy";
 const char* HEALTHY_CHECK_TIMEOUT_MS = "healthy_check_timeout_ms";
+const char* HUGE_PAGES = "huge_pages";
+const char* NUMA_NODE = "numa_node";
+const char* MAX_SEGMENT_SIZE = "max_segment_size";
 const char* DISCARD = "DISCARD";
 const char* FAIL = "FAIL";
 const char* RTPS_DUMP_FILE = "rtps_dump_file";
@@ -159,6 +175,7 @@ const char* ENTITY_ID = "entityID";
 const char* MATCHED_SUBSCRIBERS_ALLOCATION = "matchedSubscribersAllocation";
 const char* MATCHED_PUBLISHERS_ALLOCATION = "matchedPublishersAllocation";
 const char* DATA_SHARING_LISTENER_THREAD = "data_sharing_listener_thread";
+const char* DATA_SHARING_SPIN_DURATION = "spin_duration";
 
 ///
 const char* IGN_NON_MATCHING_LOCS = "ignore_non_matching_locators";
@@ -183,6 +200,7 @@ const char* WAN_ADDRESS = "wan_address";
 const char* RESERVED = "RESERVED";
 const char* UDPv4 = "UDPv4";
 const char* UDPv6 = "UDPv6";
+const char* UDPv4_URING = "UDPv4_URING";
 const char* TCPv4 = "TCPv4";
 const char* TCPv6 = "TCPv6";
 const char* SHM = "SHM";
@@ -22,11 +22,13 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <vector>
 
 #include <fastdds/rtps/common/CDRMessage_t.h>
 #include <fastdds/rtps/common/Types.h>
 #include <fastdds/rtps/messages/CDRMessage.h>
 #include <fastdds/rtps/messages/RTPSMessageCreator.h>
+#include <fastdds/rtps/transport/NetworkBuffer.hpp>
 
 #define FASTDDS_STATISTICS_NETWORK_SUBMESSAGE 0x80
 
@@ -170,6 +172,73 @@ inline uint32_t get_statistics_message_pos(
 
 #endif // FASTDDS_STATISTICS
 
+#ifdef FASTDDS_STATISTICS
+/**
+ * @brief Fills a statistics submessage with the current timestamp and sequencing information.
+ * @param destination Locator the message is being sent to.
+ * @param submessage Pointer to the beginning of the statistics submessage.
+ * @param message_size Size of the whole message, statistics submessage included.
+ * @param sequence Sequencing information of the destination.
+ */
+inline void write_statistics_submessage(
+        const eprosima::fastrtps::rtps::Locator_t& destination,
+        const eprosima::fastrtps::rtps::octet* submessage,
+        uint32_t message_size,
+        StatisticsSubmessageData::Sequence& sequence)
+{
+    using namespace eprosima::fastrtps::rtps;
+
+    // Accumulate bytes on sequence
+    sequence.add_message(message_size);
+
+    // Skip the submessage header
+    auto current_pos = submessage + RTPSMESSAGE_SUBMESSAGEHEADER_SIZE;
+
+    // Set current timestamp and sequence
+    Time_t ts;
+    Time_t::now(ts);
+
+    /*
+     * This set of memcpy blocks is intended to prevent an undefined behavior caused when casting from an octet* to a StatisticsSubmessageData*
+     * since these classes have different alignment.
+     */
+
+    memcpy((char*)current_pos + offsetof(StatisticsSubmessageData, destination), &destination, sizeof(destination));
+    memcpy((char*)current_pos + offsetof(StatisticsSubmessageData, ts.seconds), &ts.seconds(),
+            sizeof(StatisticsSubmessageData::ts.seconds));
+    memcpy((char*)current_pos + offsetof(StatisticsSubmessageData, ts.fraction), &ts.fraction(),
+            sizeof(StatisticsSubmessageData::ts.fraction));
+    memcpy((char*)current_pos + offsetof(StatisticsSubmessageData, seq.sequence), &sequence.sequence,
+            sizeof(sequence.sequence));
+    memcpy((char*)current_pos + offsetof(StatisticsSubmessageData, seq.bytes), &sequence.bytes,
+            sizeof(sequence.bytes));
+    memcpy((char*)current_pos + offsetof(StatisticsSubmessageData, seq.bytes_high), &sequence.bytes_high,
+            sizeof(sequence.bytes_high));
+}
+
+/**
+ * @brief Finds the statistics submessage of a message given as a list of slices.
+ * The statistics submessage, when present, is at the end of the last slice.
+ * @return Pointer to the beginning of the statistics submessage, or nullptr when the message has none.
+ */
+inline const eprosima::fastrtps::rtps::octet* get_statistics_submessage(
+        const std::vector<eprosima::fastdds::rtps::NetworkBuffer>& buffers,
+        uint32_t total_bytes)
+{
+    // Message should contain RTPS header and statistic submessage
+    if (buffers.empty() || total_bytes < statistics_submessage_length + RTPSMESSAGE_HEADER_SIZE ||
+            buffers.back().size < statistics_submessage_length)
+    {
+        return nullptr;
+    }
+
+    const eprosima::fastrtps::rtps::octet* submessage =
+            buffers.back().buffer + buffers.back().size - statistics_submessage_length;
+    return FASTDDS_STATISTICS_NETWORK_SUBMESSAGE == submessage[0] ? submessage : nullptr;
+}
+
+#endif // FASTDDS_STATISTICS
+
 inline void set_statistics_submessage_from_transport(
         const eprosima::fastrtps::rtps::Locator_t& destination,
         const eprosima::fastrtps::rtps::octet* send_buffer,
@@ -182,39 +251,31 @@ inline void set_statistics_submessage_from_transport(
     static_cast<void>(sequence);
 
 #ifdef FASTDDS_STATISTICS
-    using namespace eprosima::fastrtps::rtps;
-
     uint32_t statistics_pos = get_statistics_message_pos(send_buffer, send_buffer_size);
 
     if ( 0 != statistics_pos )
     {
-        // Accumulate bytes on sequence
-        sequence.add_message(send_buffer_size);
-
-        // Skip the submessage header
-        statistics_pos += RTPSMESSAGE_SUBMESSAGEHEADER_SIZE;
-
-        // Set current timestamp and sequence
-        auto current_pos = &send_buffer[statistics_pos];
-        Time_t ts;
-        Time_t::now(ts);
-
-        /*
-         * This set of memcpy blocks is intended to prevent an undefined behavior caused when casting from an octet* to a StatisticsSubmessageData*
-         * since these classes have different alignment.
-         */
-
-        memcpy((char*)current_pos + offsetof(StatisticsSubmessageData, destination), &destination, sizeof(destination));
-        memcpy((char*)current_pos + offsetof(StatisticsSubmessageData, ts.seconds), &ts.seconds(),
-                sizeof(StatisticsSubmessageData::ts.seconds));
-        memcpy((char*)current_pos + offsetof(StatisticsSubmessageData, ts.fraction), &ts.fraction(),
-                sizeof(StatisticsSubmessageData::ts.fraction));
-        memcpy((char*)current_pos + offsetof(StatisticsSubmessageData, seq.sequence), &sequence.sequence,
-                sizeof(sequence.sequence));
-        memcpy((char*)current_pos + offsetof(StatisticsSubmessageData, seq.bytes), &sequence.bytes,
-                sizeof(sequence.bytes));
-        memcpy((char*)current_pos + offsetof(StatisticsSubmessageData, seq.bytes_high), &sequence.bytes_high,
-                sizeof(sequence.bytes_high));
+        write_statistics_submessage(destination, &send_buffer[statistics_pos], send_buffer_size, sequence);
+    }
+#endif // FASTDDS_STATISTICS
+}
+
+inline void set_statistics_submessage_from_transport(
+        const eprosima::fastrtps::rtps::Locator_t& destination,
+        const std::vector<eprosima::fastdds::rtps::NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        StatisticsSubmessageData::Sequence& sequence)
+{
+    static_cast<void>(destination);
+    static_cast<void>(buffers);
+    static_cast<void>(total_bytes);
+    static_cast<void>(sequence);
+
+#ifdef FASTDDS_STATISTICS
+    const eprosima::fastrtps::rtps::octet* submessage = get_statistics_submessage(buffers, total_bytes);
+    if (nullptr != submessage)
+    {
+        write_statistics_submessage(destination, submessage, total_bytes, sequence);
     }
 #endif // FASTDDS_STATISTICS
 }
@@ -235,6 +296,21 @@ inline void remove_statistics_submessage(
 #endif // FASTDDS_STATISTICS
 }
 
+inline void remove_statistics_submessage(
+        const std::vector<eprosima::fastdds::rtps::NetworkBuffer>& buffers,
+        uint32_t& total_bytes)
+{
+    static_cast<void>(buffers);
+    static_cast<void>(total_bytes);
+
+#ifdef FASTDDS_STATISTICS
+    if (nullptr != get_statistics_submessage(buffers, total_bytes))
+    {
+        total_bytes -= statistics_submessage_length;
+    }
+#endif // FASTDDS_STATISTICS
+}
+
 } // namespace rtps
 } // namespace statistics
 } // namespace fastdds
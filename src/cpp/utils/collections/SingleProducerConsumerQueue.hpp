@@ -0,0 +1,154 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SingleProducerConsumerQueue.hpp
+ *
+ */
+
+#ifndef FASTDDS_UTILS_COLLECTIONS_SINGLEPRODUCERCONSUMERQUEUE_HPP_
+#define FASTDDS_UTILS_COLLECTIONS_SINGLEPRODUCERCONSUMERQUEUE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+
+/**
+ * A lock-free bounded queue for exactly one producer thread and one consumer thread.
+ *
+ * The capacity is rounded up to a power of two, and the storage is preallocated on construction.
+ * Pushing to a full queue fails without blocking, as does popping from an empty one.
+ *
+ * @tparam _Ty  Element type. Should be default constructible and copy assignable.
+ *
+ * @ingroup UTILITIES_MODULE
+ */
+template <typename _Ty>
+class SingleProducerConsumerQueue
+{
+public:
+
+    using value_type = _Ty;
+    using size_type = std::size_t;
+
+    /**
+     * Construct a SingleProducerConsumerQueue.
+     *
+     * @param capacity  Minimum number of elements the queue should be able to hold.
+     */
+    explicit SingleProducerConsumerQueue(
+            size_type capacity)
+    {
+        size_type size = 1;
+        while (size < capacity)
+        {
+            size <<= 1;
+        }
+        buffer_.resize(size);
+        mask_ = size - 1;
+    }
+
+    /**
+     * Add an element at the end of the queue. Should only be called from the producer thread.
+     *
+     * @param value  Element to add.
+     *
+     * @return true if the element was added, false if the queue was full.
+     */
+    bool push(
+            const value_type& value)
+    {
+        size_type tail = tail_.value.load(std::memory_order_relaxed);
+        if (tail - head_.value.load(std::memory_order_acquire) > mask_)
+        {
+            return false;
+        }
+
+        buffer_[tail & mask_] = value;
+        tail_.value.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Take the element at the front of the queue. Should only be called from the consumer thread.
+     *
+     * @param [out] value  Element taken from the queue.
+     *
+     * @return true if an element was taken, false if the queue was empty.
+     */
+    bool pop(
+            value_type& value)
+    {
+        size_type head = head_.value.load(std::memory_order_relaxed);
+        if (head == tail_.value.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        value = buffer_[head & mask_];
+        head_.value.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Get the number of elements on the queue.
+     * The value may be outdated as soon as it is returned when called concurrently with push or pop.
+     */
+    size_type size() const
+    {
+        size_type head = head_.value.load(std::memory_order_acquire);
+        return tail_.value.load(std::memory_order_acquire) - head;
+    }
+
+    //! Whether the queue is empty.
+    bool empty() const
+    {
+        return 0 == size();
+    }
+
+    //! Maximum number of elements the queue is able to hold.
+    size_type capacity() const
+    {
+        return buffer_.size();
+    }
+
+private:
+
+    //! Preallocated storage
+    std::vector<value_type> buffer_;
+
+    //! Mask to convert a position into an index on the storage
+    size_type mask_ = 0;
+
+    //! Position on the queue, padded to keep the producer and consumer positions on different cache lines
+    struct Position
+    {
+        std::atomic<size_type> value {0};
+        char padding[64 - sizeof(std::atomic<size_type>)];
+    };
+
+    //! Position of the next element to pop, only written by the consumer
+    Position head_;
+
+    //! Position of the next element to push, only written by the producer
+    Position tail_;
+};
+
+} // namespace fastdds
+} // namespace eprosima
+
+#endif /* FASTDDS_UTILS_COLLECTIONS_SINGLEPRODUCERCONSUMERQUEUE_HPP_ */
@@ -0,0 +1,77 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTDDS_SHAREDMEM_FUTEX_H_
+#define _FASTDDS_SHAREDMEM_FUTEX_H_
+
+#if defined(__linux__)
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <ctime>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "Futex words should be plain 32-bit words");
+
+/**
+ * Sleep while a 32-bit word in shared memory holds an expected value.
+ * The futex is not private, so the word can be waited and woken from different processes.
+ * @param word Word to wait on.
+ * @param expected Value of the word the caller saw before deciding to sleep.
+ * @param timeout Maximum time sleeping.
+ * @return false if the timeout expired, true if the caller was woken or the word did not hold the expected value.
+ */
+inline bool futex_wait(
+        std::atomic<uint32_t>* word,
+        uint32_t expected,
+        const std::chrono::microseconds& timeout)
+{
+    struct timespec timeout_spec;
+    timeout_spec.tv_sec = static_cast<time_t>(timeout.count() / 1000000);
+    timeout_spec.tv_nsec = static_cast<long>((timeout.count() % 1000000) * 1000);
+
+    long ret = syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT, expected, &timeout_spec,
+                    nullptr, 0);
+    return 0 == ret || ETIMEDOUT != errno;
+}
+
+/**
+ * Wake the processes sleeping on a 32-bit word in shared memory.
+ * @param word Word the processes sleep on.
+ * @param count Maximum number of processes woken.
+ */
+inline void futex_wake(
+        std::atomic<uint32_t>* word,
+        int count = INT_MAX)
+{
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE, count, nullptr, nullptr, 0);
+}
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // if defined(__linux__)
+
+#endif // _FASTDDS_SHAREDMEM_FUTEX_H_
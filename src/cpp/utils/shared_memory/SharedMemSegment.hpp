@@ -40,6 +40,15 @@
 #include <boost/interprocess/offset_ptr.hpp>
 #include <boost/thread/thread_time.hpp>
 
+#if defined(__linux__)
+#include <fstream>
+#include <string>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // if defined(__linux__)
+
 #include "BoostAtExitRegistry.hpp"
 #include "RobustInterprocessCondition.hpp"
 #include "SharedMemUUID.hpp"
@@ -458,6 +467,69 @@ public:
         return segment_->get_size();
     }
 
+    /**
+     * Ask the system to back the segment with huge pages.
+     * Only the pages not accessed yet are affected, so it should be called right after the segment is created.
+     * @return true if the segment may be given huge pages, false if they are not available on the system.
+     */
+    bool advise_huge_pages()
+    {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        // Transparent huge pages on shared memory are disabled unless the system administrator enables them
+        std::ifstream shmem_enabled("/sys/kernel/mm/transparent_hugepage/shmem_enabled");
+        std::string setting;
+        if (!std::getline(shmem_enabled, setting) ||
+                std::string::npos != setting.find("[never]") ||
+                std::string::npos != setting.find("[deny]"))
+        {
+            return false;
+        }
+
+        return 0 == madvise(segment_->get_address(), segment_->get_size(), MADV_HUGEPAGE);
+#else
+        return false;
+#endif // if defined(__linux__) && defined(MADV_HUGEPAGE)
+    }
+
+    /**
+     * Place the pages of the segment on a NUMA node, falling back to other nodes when it runs out of memory.
+     * Only the pages not accessed yet are affected, so it should be called right after the segment is created.
+     * @param node NUMA node, or a negative value for the node the calling thread is running on.
+     * @return true if the placement was set, false if it is not supported on the system.
+     */
+    bool bind_to_numa_node(
+            int32_t node)
+    {
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_getcpu)
+        static constexpr int mpol_preferred = 1;
+        static constexpr unsigned long max_nodes = 8 * sizeof(unsigned long);
+
+        if (0 > node)
+        {
+            unsigned cpu = 0;
+            unsigned current_node = 0;
+            if (0 != syscall(SYS_getcpu, &cpu, &current_node, nullptr))
+            {
+                return false;
+            }
+            node = static_cast<int32_t>(current_node);
+        }
+
+        if (static_cast<unsigned long>(node) >= max_nodes)
+        {
+            return false;
+        }
+
+        // The kernel takes the number of bits of the mask plus one
+        unsigned long node_mask = 1ul << node;
+        return 0 == syscall(SYS_mbind, segment_->get_address(), segment_->get_size(), mpol_preferred,
+                       &node_mask, max_nodes + 1, 0);
+#else
+        static_cast<void>(node);
+        return false;
+#endif // if defined(__linux__) && defined(SYS_mbind) && defined(SYS_getcpu)
+    }
+
 private:
 
     std::unique_ptr<managed_shared_memory_type> segment_;
@@ -1471,6 +1471,13 @@ public:
         return *this;
     }
 
+    PubSubReader& datasharing_spin_duration(
+            const eprosima::fastrtps::Duration_t& spin_duration)
+    {
+        datareader_qos_.data_sharing().spin_duration(spin_duration);
+        return *this;
+    }
+
 #if HAVE_SQLITE3
     PubSubReader& make_persistent(
             const std::string& filename,
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <chrono>
 #include <fstream>
 #include <sstream>
 #include <thread>
@@ -127,6 +128,107 @@ TEST_P(DDSDataSharing, BasicCommunication)
 }
 
 
+TEST_P(DDSDataSharing, SharedListenerCommunication)
+{
+    PubSubReader<FixedSizedPubSubType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<FixedSizedPubSubType> writer(TEST_TOPIC_NAME);
+
+    // Disable transports to ensure we are using datasharing
+    auto testTransport = std::make_shared<test_UDPv4TransportDescriptor>();
+    testTransport->dropDataMessagesPercentage = 100;
+
+    // The reader notifications are waited by a participant-wide dispatcher
+    PropertyPolicy properties;
+    properties.properties().emplace_back("fastdds.shared_datasharing_listener", "true");
+
+    reader.history_depth(100)
+            .property_policy(properties)
+            .add_user_transport_to_pparams(testTransport)
+            .disable_builtin_transport()
+            .datasharing_on(".")
+            .reliability(RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.history_depth(100)
+            .add_user_transport_to_pparams(testTransport)
+            .disable_builtin_transport()
+            .datasharing_on(".")
+            .reliability(RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    // The notification of the dispatcher is named after the participant of the reader
+    GUID_t dispatcher_guid(reader.datareader_guid().guidPrefix, c_EntityId_RTPSParticipant);
+    ASSERT_TRUE(check_shared_file(".", dispatcher_guid));
+
+    auto data = default_fixed_sized_data_generator();
+    reader.startReception(data);
+
+    writer.send(data);
+    ASSERT_TRUE(data.empty());
+    reader.block_for_all();
+
+    reader.destroy();
+    writer.destroy();
+
+    ASSERT_FALSE(check_shared_file(".", dispatcher_guid));
+    ASSERT_FALSE(check_shared_file(".", reader.datareader_guid()));
+}
+
+
+TEST_P(DDSDataSharing, SpinningListenerCommunication)
+{
+    PubSubReader<FixedSizedPubSubType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<FixedSizedPubSubType> writer(TEST_TOPIC_NAME);
+
+    // Disable transports to ensure we are using datasharing
+    auto testTransport = std::make_shared<test_UDPv4TransportDescriptor>();
+    testTransport->dropDataMessagesPercentage = 100;
+
+    // The reader polls for new samples during 1 ms before blocking
+    reader.history_depth(100)
+            .add_user_transport_to_pparams(testTransport)
+            .disable_builtin_transport()
+            .datasharing_on(".")
+            .datasharing_spin_duration({0, 1000000})
+            .reliability(RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.history_depth(100)
+            .add_user_transport_to_pparams(testTransport)
+            .disable_builtin_transport()
+            .datasharing_on(".")
+            .reliability(RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_fixed_sized_data_generator();
+    reader.startReception(data);
+
+    // Samples sent one by one, so some of them arrive while the reader is polling and some after it blocked
+    for (auto& sample : data)
+    {
+        std::list<FixedSized> single_sample{sample};
+        writer.send(single_sample);
+        ASSERT_TRUE(single_sample.empty());
+        std::this_thread::sleep_for(std::chrono::microseconds(500 * (sample.index() % 4)));
+    }
+    reader.block_for_all();
+
+    reader.destroy();
+    writer.destroy();
+
+    ASSERT_FALSE(check_shared_file(".", reader.datareader_guid()));
+}
+
 TEST(DDSDataSharing, TransientReader)
 {
     PubSubReader<FixedSizedPubSubType> reader(TEST_TOPIC_NAME);
@@ -69,6 +69,14 @@ public:
     {
     }
 
+    virtual void processCDRMsg(
+            const Locator_t& /*source_locator*/,
+            const Locator_t& /*reception_locator*/,
+            CDRMessage_t* /*msg*/,
+            const Time_t& /*reception_timestamp*/ = c_RTPSTimeZero)
+    {
+    }
+
     void setReceiverResource(
             ReceiverResource* /*receiverResource*/)
     {
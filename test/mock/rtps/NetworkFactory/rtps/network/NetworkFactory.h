@@ -72,6 +72,11 @@ public:
         return 65536;
     }
 
+    uint32_t get_max_segmented_message_size() const
+    {
+        return 0;
+    }
+
     bool is_local_locator(
             const Locator_t&) const
     {
@@ -288,6 +288,11 @@ public:
         return 65536;
     }
 
+    uint32_t get_max_segmented_message_size() const
+    {
+        return 0;
+    }
+
     const RTPSParticipantAttributes& getRTPSParticipantAttributes() const
     {
         return attr_;
@@ -153,6 +153,13 @@ public:
             const LocatorSelectorSender&,
             std::chrono::steady_clock::time_point&));
 
+    MOCK_METHOD5(send_gather_nts, bool(
+            const std::vector<fastdds::rtps::NetworkBuffer>&,
+            uint32_t,
+            uint32_t,
+            const LocatorSelectorSender&,
+            std::chrono::steady_clock::time_point&));
+
     MOCK_CONST_METHOD0(is_datasharing_compatible, bool());
 
     MOCK_CONST_METHOD1(is_datasharing_compatible_with, bool(
@@ -101,18 +101,20 @@ protected:
     ReceiverResource(
             TransportInterface& transport,
             const Locator_t& locator,
-            uint32_t max_recv_buffer_size)
+            uint32_t max_recv_buffer_size,
+            uint32_t pipeline_depth = 0)
         : mValid(false)
         , m_maxMsgSize(max_recv_buffer_size)
     {
+        static_cast<void>(pipeline_depth);
         mValid = transport.OpenInputChannel(locator, this, m_maxMsgSize);
         if (!mValid)
         {
             return;
         }
-        Cleanup = [&transport, locator]()
+        Cleanup = [&transport, locator, this]()
                 {
-                    transport.CloseInputChannel(locator);
+                    transport.close_input_channel_shard(locator, this);
                 };
         LocatorMapsToManagedChannel = [&transport, locator](const Locator_t& locatorToCheck) -> bool
                 {
@@ -34,6 +34,9 @@ class TransportInterface;
  */
 typedef struct SharedMemTransportDescriptor : public PortBasedTransportDescriptor
 {
+    static constexpr int32_t numa_node_none = -1;
+    static constexpr int32_t numa_node_local = -2;
+
     virtual ~SharedMemTransportDescriptor()
     {
 
@@ -123,12 +126,60 @@ typedef struct SharedMemTransportDescriptor : public PortBasedTransportDescripto
         dump_thread_ = dump_thread;
     }
 
+    RTPS_DllAPI uint32_t busy_poll_budget_us() const
+    {
+        return busy_poll_budget_us_;
+    }
+
+    RTPS_DllAPI void busy_poll_budget_us(
+            uint32_t busy_poll_budget_us)
+    {
+        busy_poll_budget_us_ = busy_poll_budget_us;
+    }
+
+    RTPS_DllAPI uint32_t max_segment_size() const
+    {
+        return max_segment_size_;
+    }
+
+    RTPS_DllAPI void max_segment_size(
+            uint32_t max_segment_size)
+    {
+        max_segment_size_ = max_segment_size;
+    }
+
+    RTPS_DllAPI bool huge_pages() const
+    {
+        return huge_pages_;
+    }
+
+    RTPS_DllAPI void huge_pages(
+            bool huge_pages)
+    {
+        huge_pages_ = huge_pages;
+    }
+
+    RTPS_DllAPI int32_t numa_node() const
+    {
+        return numa_node_;
+    }
+
+    RTPS_DllAPI void numa_node(
+            int32_t numa_node)
+    {
+        numa_node_ = numa_node;
+    }
+
 private:
 
     uint32_t segment_size_;
+    uint32_t max_segment_size_ = 0;
     uint32_t port_queue_capacity_;
     uint32_t healthy_check_timeout_ms_;
     std::string rtps_dump_file_;
+    uint32_t busy_poll_budget_us_ = 0;
+    bool huge_pages_ = false;
+    int32_t numa_node_ = numa_node_none;
     ThreadSettings dump_thread_;
 
 }SharedMemTransportDescriptor;
@@ -177,6 +177,10 @@ typedef struct TCPTransportDescriptor : public SocketTransportDescriptor
 
     fastdds::rtps::ThreadSettings keep_alive_thread;
     fastdds::rtps::ThreadSettings accept_thread;
+    uint32_t reactor_threads = 0;
+    fastdds::rtps::ThreadSettings reactor_thread;
+    uint32_t send_queue_size = 0;
+    uint16_t connection_streams = 1;
 
     void add_listener_port(
             uint16_t port)
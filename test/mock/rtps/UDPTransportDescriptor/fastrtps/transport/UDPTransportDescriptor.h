@@ -54,6 +54,20 @@ typedef struct UDPTransportDescriptor: public SocketTransportDescriptor
    uint16_t m_output_udp_socket;
    
    bool non_blocking_send = false;
+
+   uint32_t receive_batch_size = 1;
+
+   bool segmentation_offload = false;
+
+   uint32_t receive_shards = 1;
+
+   uint32_t zero_copy_send_threshold = 0;
+
+   uint32_t busy_poll_budget_us = 0;
+
+   bool receive_timestamps = false;
+
+   uint32_t max_connected_sockets = 0;
 } UDPTransportDescriptor;
 
 } // namespace rtps
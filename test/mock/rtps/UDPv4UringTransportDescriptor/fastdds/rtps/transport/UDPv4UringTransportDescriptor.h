@@ -0,0 +1,53 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTDDS_UDPV4_URING_TRANSPORT_DESCRIPTOR
+#define _FASTDDS_UDPV4_URING_TRANSPORT_DESCRIPTOR
+
+#include <cstdint>
+
+#include <fastrtps/transport/UDPv4TransportDescriptor.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * UDPv4 Transport configuration for the io_uring based implementation.
+ *
+ * @ingroup TRANSPORT_MODULE
+ */
+struct UDPv4UringTransportDescriptor : public fastrtps::rtps::UDPv4TransportDescriptor
+{
+    virtual ~UDPv4UringTransportDescriptor()
+    {
+
+    }
+
+    RTPS_DllAPI UDPv4UringTransportDescriptor()
+        : fastrtps::rtps::UDPv4TransportDescriptor()
+    {
+
+    }
+
+    uint32_t send_ring_entries = 256;
+
+    uint32_t receive_ring_buffers = 64;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_UDPV4_URING_TRANSPORT_DESCRIPTOR
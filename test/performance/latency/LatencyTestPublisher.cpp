@@ -36,6 +36,7 @@
 #include <fastdds/dds/subscriber/DataReader.hpp>
 #include <fastdds/rtps/transport/shared_mem/SharedMemTransportDescriptor.h>
 #include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
+#include <fastdds/rtps/transport/UDPv4UringTransportDescriptor.h>
 #include <fastrtps/xmlparser/XMLProfileManager.h>
 
 
@@ -101,8 +102,10 @@ bool LatencyTestPublisher::init(
         const std::string& xml_config_file,
         bool dynamic_data,
         Arg::EnablerValue data_sharing,
+        uint32_t data_sharing_spin,
         bool data_loans,
         Arg::EnablerValue shared_memory,
+        Arg::EnablerValue io_uring,
         int forced_domain,
         LatencyDataSizes& latency_data_sizes)
 {
@@ -115,8 +118,10 @@ bool LatencyTestPublisher::init(
     reliable_ = reliable;
     dynamic_types_ = dynamic_data;
     data_sharing_ = data_sharing;
+    data_sharing_spin_ = data_sharing_spin;
     data_loans_ = data_loans;
     shared_memory_ = shared_memory;
+    io_uring_ = io_uring;
     forced_domain_ = forced_domain;
     raw_data_file_ = raw_data_file;
     pid_ = pid;
@@ -191,21 +196,25 @@ bool LatencyTestPublisher::init(
         pqos.properties(part_property_policy);
     }
 
-    // Set shared memory transport if it was enable/disable explicitly.
-    if (Arg::EnablerValue::ON == shared_memory_)
+    // Set shared memory and io_uring transports if they were enable/disable explicitly.
+    if (Arg::EnablerValue::NO_SET != shared_memory_ || Arg::EnablerValue::ON == io_uring_)
     {
-        std::shared_ptr<eprosima::fastdds::rtps::SharedMemTransportDescriptor> shm_transport =
-                std::make_shared<eprosima::fastdds::rtps::SharedMemTransportDescriptor>();
-        std::shared_ptr<eprosima::fastdds::rtps::UDPv4TransportDescriptor> udp_transport =
-                std::make_shared<eprosima::fastdds::rtps::UDPv4TransportDescriptor>();
-        pqos.transport().user_transports.push_back(shm_transport);
-        pqos.transport().user_transports.push_back(udp_transport);
-        pqos.transport().use_builtin_transports = false;
-    }
-    else if (Arg::EnablerValue::OFF == shared_memory_)
-    {
-        std::shared_ptr<eprosima::fastdds::rtps::UDPv4TransportDescriptor> udp_transport =
-                std::make_shared<eprosima::fastdds::rtps::UDPv4TransportDescriptor>();
+        if (Arg::EnablerValue::OFF != shared_memory_)
+        {
+            std::shared_ptr<eprosima::fastdds::rtps::SharedMemTransportDescriptor> shm_transport =
+                    std::make_shared<eprosima::fastdds::rtps::SharedMemTransportDescriptor>();
+            pqos.transport().user_transports.push_back(shm_transport);
+        }
+
+        std::shared_ptr<eprosima::fastdds::rtps::UDPv4TransportDescriptor> udp_transport;
+        if (Arg::EnablerValue::ON == io_uring_)
+        {
+            udp_transport = std::make_shared<eprosima::fastdds::rtps::UDPv4UringTransportDescriptor>();
+        }
+        else
+        {
+            udp_transport = std::make_shared<eprosima::fastdds::rtps::UDPv4TransportDescriptor>();
+        }
         pqos.transport().user_transports.push_back(udp_transport);
         pqos.transport().use_builtin_transports = false;
     }
@@ -296,6 +305,9 @@ bool LatencyTestPublisher::init(
         {
             DataSharingQosPolicy dsp;
             dsp.on("");
+            // Only used by the readers
+            dsp.spin_duration(eprosima::fastrtps::Duration_t(
+                        static_cast<int32_t>(data_sharing_spin_ / 1000000), (data_sharing_spin_ % 1000000) * 1000));
             dw_qos_.data_sharing(dsp);
             dr_qos_.data_sharing(dsp);
         }
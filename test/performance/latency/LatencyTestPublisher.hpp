@@ -100,8 +100,10 @@ public:
             const std::string& xml_config_file,
             bool dynamic_data,
             Arg::EnablerValue data_sharing,
+            uint32_t data_sharing_spin,
             bool data_loans,
             Arg::EnablerValue shared_memory,
+            Arg::EnablerValue io_uring,
             int forced_domain,
             LatencyDataSizes& latency_data_sizes);
 
@@ -203,8 +205,10 @@ private:
     bool reliable_ = false;
     bool dynamic_types_ = false;
     Arg::EnablerValue data_sharing_ = Arg::EnablerValue::NO_SET;
+    uint32_t data_sharing_spin_ = 0;
     bool data_loans_ = false;
     Arg::EnablerValue shared_memory_ = Arg::EnablerValue::NO_SET;
+    Arg::EnablerValue io_uring_ = Arg::EnablerValue::NO_SET;
     int forced_domain_ = -1;
     int subscribers_ = 0;
     unsigned int samples_ = 0;
@@ -61,8 +61,10 @@ public:
             const std::string& xml_config_file,
             bool dynamic_data,
             Arg::EnablerValue data_sharing,
+            uint32_t data_sharing_spin,
             bool data_loans,
             Arg::EnablerValue shared_memory,
+            Arg::EnablerValue io_uring,
             int forced_domain,
             LatencyDataSizes& latency_data_sizes);
 
@@ -132,8 +134,10 @@ private:
     int samples_ = 0;
     bool dynamic_types_ = false;
     Arg::EnablerValue data_sharing_ = Arg::EnablerValue::NO_SET;
+    uint32_t data_sharing_spin_ = 0;
     bool data_loans_ = false;
     Arg::EnablerValue shared_memory_ = Arg::EnablerValue::NO_SET;
+    Arg::EnablerValue io_uring_ = Arg::EnablerValue::NO_SET;
     int forced_domain_ = -1;
     bool hostname_ = false;
     uint32_t pid_ = 0;
@@ -61,6 +61,12 @@ if __name__ == '__main__':
         help='Explicitly enable/disable data sharing. (Defaults: Fast-DDS default settings)',
         required=False
     )
+    parser.add_argument(
+        '--data_sharing_spin',
+        type=int,
+        help='Microseconds data sharing readers poll for new samples before blocking (Defaults: 0)',
+        required=False
+    )
     parser.add_argument(
         '-l',
         '--data_loans',
@@ -81,6 +87,12 @@ if __name__ == '__main__':
         help='Explicitly enable/disable shared memory transport. (Defaults: Fast-DDS default settings)',
         required=False
         )
+    parser.add_argument(
+        '--io_uring',
+        choices=['on', 'off'],
+        help='Use the io_uring based UDPv4 transport. (Defaults: off)',
+        required=False
+        )
 
     # Parse arguments
     args = parser.parse_args()
@@ -138,6 +150,9 @@ if __name__ == '__main__':
     elif args.data_loans:
         filename_options += '_data_loans'
 
+    if args.data_sharing_spin:
+        filename_options += '_spin'
+
     # add flags to the command line
     data_options = []
 
@@ -147,6 +162,9 @@ if __name__ == '__main__':
         else:
             data_options += ['--data_sharing=off']
 
+    if args.data_sharing_spin:
+        data_options += ['--data_sharing_spin={}'.format(args.data_sharing_spin)]
+
     if args.data_loans:
         data_options += ['--data_loans']
 
@@ -162,6 +180,9 @@ if __name__ == '__main__':
         else:
             data_options += ['--shared_memory=off']
 
+    if args.io_uring:
+        data_options += ['--io_uring={}'.format(args.io_uring)]
+
     # Environment variables
     executable = os.environ.get('LATENCY_TEST_BIN')
     certs_path = os.environ.get('CERTS_PATH')
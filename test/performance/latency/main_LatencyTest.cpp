@@ -64,8 +64,10 @@ enum  optionIndex
     FORCED_DOMAIN,
     FILE_R,
     DATA_SHARING,
+    DATA_SHARING_SPIN,
     DATA_LOAN,
-    SHARED_MEMORY
+    SHARED_MEMORY,
+    IO_URING
 };
 
 enum TestAgent
@@ -97,10 +99,14 @@ const option::Descriptor usage[] = {
       "               --dynamic_types       Use dynamic types." },
     { DATA_SHARING,  0, "d", "data_sharing",    Arg::Enabler,
       "               --data_sharing=[on|off]             Explicitly enable/disable data sharing feature." },
+    { DATA_SHARING_SPIN, 0, "", "data_sharing_spin", Arg::Numeric,
+      "               --data_sharing_spin=<us>  Time data sharing readers poll for new samples before blocking." },
     { DATA_LOAN,        0, "l", "data_loans",            Arg::None,
       "               --data_loans          Use loan sample API." },
     { SHARED_MEMORY,    0, "", "shared_memory", Arg::Enabler,
       "               --shared_memory=[on|off]             Explicitly enable/disable shared memory transport." },
+    { IO_URING,         0, "", "io_uring", Arg::Enabler,
+      "               --io_uring=[on|off]                  Use the io_uring based UDPv4 transport." },
 #if HAVE_SECURITY
     {
         USE_SECURITY,    0, "",  "security",        Arg::Required,
@@ -228,8 +234,10 @@ int main(
     int forced_domain = -1;
     std::string demands_file = "";
     Arg::EnablerValue data_sharing = Arg::EnablerValue::NO_SET;
+    uint32_t data_sharing_spin = 0;
     bool data_loans = false;
     Arg::EnablerValue shared_memory = Arg::EnablerValue::NO_SET;
+    Arg::EnablerValue io_uring = Arg::EnablerValue::NO_SET;
 
     argc -= (argc > 0);
     argv += (argc > 0); // skip program name argv[0] if present
@@ -394,6 +402,9 @@ int main(
                 }
                 break;
                 break;
+            case DATA_SHARING_SPIN:
+                data_sharing_spin = strtol(opt.arg, nullptr, 10);
+                break;
             case DATA_LOAN:
                 data_loans = true;
                 break;
@@ -407,6 +418,16 @@ int main(
                     shared_memory = Arg::EnablerValue::OFF;
                 }
                 break;
+            case IO_URING:
+                if (0 == strncasecmp(opt.arg, "on", 2))
+                {
+                    io_uring = Arg::EnablerValue::ON;
+                }
+                else
+                {
+                    io_uring = Arg::EnablerValue::OFF;
+                }
+                break;
             case UNKNOWN_OPT:
             default:
                 option::printUsage(fwrite, stdout, usage, columns);
@@ -501,7 +522,8 @@ int main(
         LatencyTestPublisher latency_publisher;
         if (latency_publisher.init(subscribers, samples, reliable, seed, hostname, export_csv, export_prefix,
                 raw_data_file, pub_part_property_policy, pub_property_policy, xml_config_file,
-                dynamic_types, data_sharing, data_loans, shared_memory, forced_domain, data_sizes))
+                dynamic_types, data_sharing, data_sharing_spin, data_loans, shared_memory, io_uring, forced_domain,
+                data_sizes))
         {
             latency_publisher.run();
         }
@@ -516,7 +538,8 @@ int main(
         LatencyTestSubscriber latency_subscriber;
         if (latency_subscriber.init(echo, samples, reliable, seed, hostname, sub_part_property_policy,
                 sub_property_policy,
-                xml_config_file, dynamic_types, data_sharing, data_loans, shared_memory, forced_domain, data_sizes))
+                xml_config_file, dynamic_types, data_sharing, data_sharing_spin, data_loans, shared_memory, io_uring, forced_domain,
+                data_sizes))
         {
             latency_subscriber.run();
         }
@@ -535,8 +558,8 @@ int main(
         LatencyTestPublisher latency_publisher;
         bool pub_init = latency_publisher.init(subscribers, samples, reliable, seed, hostname, export_csv,
                         export_prefix, raw_data_file, pub_part_property_policy, pub_property_policy,
-                        xml_config_file, dynamic_types, data_sharing, data_loans, shared_memory, forced_domain,
-                        data_sizes);
+                        xml_config_file, dynamic_types, data_sharing, data_sharing_spin, data_loans, shared_memory, io_uring,
+                        forced_domain, data_sizes);
 
         // Initialize subscribers
         std::vector<std::shared_ptr<LatencyTestSubscriber>> latency_subscribers;
@@ -547,8 +570,8 @@ int main(
             latency_subscribers.push_back(std::make_shared<LatencyTestSubscriber>());
             sub_init &= latency_subscribers.back()->init(echo, samples, reliable, seed, hostname,
                             sub_part_property_policy,
-                            sub_property_policy, xml_config_file, dynamic_types, data_sharing, data_loans,
-                            shared_memory,
+                            sub_property_policy, xml_config_file, dynamic_types, data_sharing, data_sharing_spin, data_loans,
+                            shared_memory, io_uring,
                             forced_domain, data_sizes);
         }
 
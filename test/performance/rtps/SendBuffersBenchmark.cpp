@@ -0,0 +1,184 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SendBuffersBenchmark.cpp
+ *
+ * Measures the publication rate of several best-effort writers of the same participant, each one publishing
+ * from its own thread. Every publication gets a send buffer from the participant and returns it, so the rate
+ * with many threads shows the contention on the pool of send buffers.
+ *
+ * Usage: SendBuffersBenchmark [max_threads] [samples_per_thread]
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/attributes/WriterAttributes.h>
+#include <fastdds/rtps/builtin/data/ReaderProxyData.h>
+#include <fastdds/rtps/history/WriterHistory.h>
+#include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/writer/RTPSWriter.h>
+#include <fastrtps/utils/IPLocator.h>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+static constexpr uint32_t sample_size = 64;
+
+struct BenchmarkWriter
+{
+    RTPSWriter* writer = nullptr;
+    std::unique_ptr<WriterHistory> history;
+};
+
+static bool create_writer(
+        RTPSParticipant* participant,
+        uint16_t port,
+        BenchmarkWriter& benchmark_writer)
+{
+    HistoryAttributes hatt;
+    hatt.payloadMaxSize = sample_size;
+    benchmark_writer.history.reset(new WriterHistory(hatt));
+
+    WriterAttributes watt;
+    watt.endpoint.reliabilityKind = BEST_EFFORT;
+    benchmark_writer.writer = RTPSDomain::createRTPSWriter(participant, watt, benchmark_writer.history.get());
+    if (nullptr == benchmark_writer.writer)
+    {
+        return false;
+    }
+
+    // Nobody listens on the destination, as only the sending side is measured
+    ReaderProxyData ratt(4u, 1u);
+    ratt.guid({c_GuidPrefix_Unknown, 0x304});
+    Locator_t loc;
+    IPLocator::setIPv4(loc, 127, 0, 0, 1);
+    loc.port = port;
+    ratt.add_unicast_locator(loc);
+    return benchmark_writer.writer->matched_reader_add(ratt);
+}
+
+static void publish(
+        BenchmarkWriter& benchmark_writer,
+        uint64_t samples)
+{
+    for (uint64_t i = 0; i < samples; ++i)
+    {
+        CacheChange_t* change = benchmark_writer.writer->new_change([]() -> uint32_t
+                        {
+                            return sample_size;
+                        }, ALIVE);
+        if (nullptr == change)
+        {
+            benchmark_writer.history->remove_min_change();
+            continue;
+        }
+
+        memset(change->serializedPayload.data, 0, sample_size);
+        change->serializedPayload.length = sample_size;
+        benchmark_writer.history->add_change(change);
+        benchmark_writer.history->remove_min_change();
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t max_threads = 16;
+    uint64_t samples = 100000;
+    if (1 < argc)
+    {
+        max_threads = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (2 < argc)
+    {
+        samples = std::strtoull(argv[2], nullptr, 10);
+    }
+    if (0 == max_threads || 0 == samples)
+    {
+        std::cerr << "Usage: " << argv[0] << " [max_threads] [samples_per_thread]" << std::endl;
+        return 1;
+    }
+
+    RTPSParticipantAttributes patt;
+    patt.builtin.discovery_config.discoveryProtocol = DiscoveryProtocol::NONE;
+    patt.builtin.use_WriterLivelinessProtocol = false;
+    RTPSParticipant* participant = RTPSDomain::createParticipant(0, patt);
+    if (nullptr == participant)
+    {
+        std::cerr << "Cannot create the participant" << std::endl;
+        return 1;
+    }
+
+    std::vector<BenchmarkWriter> writers(max_threads);
+    for (uint32_t i = 0; i < max_threads; ++i)
+    {
+        if (!create_writer(participant, static_cast<uint16_t>(7399 + i), writers[i]))
+        {
+            std::cerr << "Cannot create the writers" << std::endl;
+            RTPSDomain::removeRTPSParticipant(participant);
+            return 1;
+        }
+    }
+
+    for (uint32_t num_threads = 1; num_threads <= max_threads; num_threads *= 2)
+    {
+        std::atomic<bool> start(false);
+        std::vector<std::thread> threads;
+        for (uint32_t i = 0; i < num_threads; ++i)
+        {
+            threads.emplace_back([&, i]()
+                    {
+                        while (!start.load())
+                        {
+                            std::this_thread::yield();
+                        }
+                        publish(writers[i], samples);
+                    });
+        }
+
+        auto begin = std::chrono::steady_clock::now();
+        start.store(true);
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        auto elapsed = std::chrono::steady_clock::now() - begin;
+
+        double elapsed_s = static_cast<double>(
+            std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()) / 1000000.0;
+        double total_samples = static_cast<double>(samples) * num_threads;
+        std::cout << num_threads << " writer threads: " << (total_samples / elapsed_s) << " samples/s ("
+                  << (elapsed_s * 1000000000.0 / total_samples) << " ns/sample)" << std::endl;
+    }
+
+    for (BenchmarkWriter& benchmark_writer : writers)
+    {
+        RTPSDomain::removeRTPSWriter(benchmark_writer.writer);
+    }
+    RTPSDomain::removeRTPSParticipant(participant);
+    return 0;
+}
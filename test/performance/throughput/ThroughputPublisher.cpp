@@ -34,6 +34,7 @@
 #include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
 #include <fastdds/rtps/transport/shared_mem/SharedMemTransportDescriptor.h>
 #include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
+#include <fastdds/rtps/transport/UDPv4UringTransportDescriptor.h>
 #include <fastrtps/utils/TimeConversion.h>
 #include <fastrtps/xmlparser/XMLProfileManager.h>
 
@@ -127,6 +128,7 @@ bool ThroughputPublisher::init(
         Arg::EnablerValue data_sharing,
         bool data_loans,
         Arg::EnablerValue shared_memory,
+        Arg::EnablerValue io_uring,
         int forced_domain)
 {
     pid_ = pid;
@@ -135,6 +137,7 @@ bool ThroughputPublisher::init(
     data_sharing_ = data_sharing;
     data_loans_ = data_loans;
     shared_memory_ = shared_memory;
+    io_uring_ = io_uring;
     reliable_ = reliable;
     forced_domain_ = forced_domain;
     demands_file_ = demands_file;
@@ -178,21 +181,25 @@ bool ThroughputPublisher::init(
         pqos.properties(part_property_policy);
     }
 
-    // Set shared memory transport if it was enable/disable explicitly.
-    if (Arg::EnablerValue::ON == shared_memory_)
+    // Set shared memory and io_uring transports if they were enable/disable explicitly.
+    if (Arg::EnablerValue::NO_SET != shared_memory_ || Arg::EnablerValue::ON == io_uring_)
     {
-        std::shared_ptr<eprosima::fastdds::rtps::SharedMemTransportDescriptor> shm_transport =
-                std::make_shared<eprosima::fastdds::rtps::SharedMemTransportDescriptor>();
-        std::shared_ptr<eprosima::fastdds::rtps::UDPv4TransportDescriptor> udp_transport =
-                std::make_shared<eprosima::fastdds::rtps::UDPv4TransportDescriptor>();
-        pqos.transport().user_transports.push_back(shm_transport);
-        pqos.transport().user_transports.push_back(udp_transport);
-        pqos.transport().use_builtin_transports = false;
-    }
-    else if (Arg::EnablerValue::OFF == shared_memory_)
-    {
-        std::shared_ptr<eprosima::fastdds::rtps::UDPv4TransportDescriptor> udp_transport =
-                std::make_shared<eprosima::fastdds::rtps::UDPv4TransportDescriptor>();
+        if (Arg::EnablerValue::OFF != shared_memory_)
+        {
+            std::shared_ptr<eprosima::fastdds::rtps::SharedMemTransportDescriptor> shm_transport =
+                    std::make_shared<eprosima::fastdds::rtps::SharedMemTransportDescriptor>();
+            pqos.transport().user_transports.push_back(shm_transport);
+        }
+
+        std::shared_ptr<eprosima::fastdds::rtps::UDPv4TransportDescriptor> udp_transport;
+        if (Arg::EnablerValue::ON == io_uring_)
+        {
+            udp_transport = std::make_shared<eprosima::fastdds::rtps::UDPv4UringTransportDescriptor>();
+        }
+        else
+        {
+            udp_transport = std::make_shared<eprosima::fastdds::rtps::UDPv4TransportDescriptor>();
+        }
         pqos.transport().user_transports.push_back(udp_transport);
         pqos.transport().use_builtin_transports = false;
     }
@@ -69,6 +69,7 @@ public:
             Arg::EnablerValue data_sharing,
             bool data_loans,
             Arg::EnablerValue shared_memory,
+            Arg::EnablerValue io_uring,
             int forced_domain);
 
     ~ThroughputPublisher();
@@ -148,6 +149,7 @@ private:
     Arg::EnablerValue data_sharing_ = Arg::EnablerValue::NO_SET;
     bool data_loans_ = false;
     Arg::EnablerValue shared_memory_ = Arg::EnablerValue::NO_SET;
+    Arg::EnablerValue io_uring_ = Arg::EnablerValue::NO_SET;
     bool ready_ = true;
     bool reliable_ = false;
     bool hostname_ = false;
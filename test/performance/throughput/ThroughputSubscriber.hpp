@@ -63,6 +63,7 @@ public:
             Arg::EnablerValue data_sharing,
             bool data_loans,
             Arg::EnablerValue shared_memory,
+            Arg::EnablerValue io_uring,
             int forced_domain);
 
     ~ThroughputSubscriber();
@@ -129,6 +130,7 @@ private:
     Arg::EnablerValue data_sharing_ = Arg::EnablerValue::NO_SET;
     bool data_loans_ = false;
     Arg::EnablerValue shared_memory_ = Arg::EnablerValue::NO_SET;
+    Arg::EnablerValue io_uring_ = Arg::EnablerValue::NO_SET;
     bool ready_ = true;
     bool reliable_ = false;
     bool hostname_ = false;
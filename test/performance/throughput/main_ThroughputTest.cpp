@@ -64,7 +64,8 @@ enum  optionIndex
     SUBSCRIBERS,
     DATA_SHARING,
     DATA_LOAN,
-    SHARED_MEMORY
+    SHARED_MEMORY,
+    IO_URING
 };
 
 enum TestAgent
@@ -97,6 +98,8 @@ const option::Descriptor usage[] = {
       "               --data_loans          Use loan sample API." },
     { SHARED_MEMORY,    0, "", "shared_memory", Arg::Enabler,
       "               --shared_memory=[on|off]             Explicitly enable/disable shared memory transport." },
+    { IO_URING,         0, "", "io_uring", Arg::Enabler,
+      "               --io_uring=[on|off]                  Use the io_uring based UDPv4 transport." },
 #if HAVE_SECURITY
     {
         USE_SECURITY,  0, "",  "security",        Arg::Required,
@@ -174,6 +177,7 @@ int main(
     Arg::EnablerValue data_sharing = Arg::EnablerValue::NO_SET;
     bool data_loans = false;
     Arg::EnablerValue shared_memory = Arg::EnablerValue::NO_SET;
+    Arg::EnablerValue io_uring = Arg::EnablerValue::NO_SET;
 
     argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
     if (argc)
@@ -353,6 +357,16 @@ int main(
                     shared_memory = Arg::EnablerValue::OFF;
                 }
                 break;
+            case IO_URING:
+                if (0 == strncasecmp(opt.arg, "on", 2))
+                {
+                    io_uring = Arg::EnablerValue::ON;
+                }
+                else
+                {
+                    io_uring = Arg::EnablerValue::OFF;
+                }
+                break;
             case UNKNOWN_OPT:
                 option::printUsage(fwrite, stdout, usage, columns);
                 return 0;
@@ -482,6 +496,7 @@ int main(
                     data_sharing,
                     data_loans,
                     shared_memory,
+                    io_uring,
                     forced_domain)
                 )
         {
@@ -508,6 +523,7 @@ int main(
                     data_sharing,
                     data_loans,
                     shared_memory,
+                    io_uring,
                     forced_domain))
         {
             throughput_subscriber.run();
@@ -539,6 +555,7 @@ int main(
                     data_sharing,
                     data_loans,
                     shared_memory,
+                    io_uring,
                     forced_domain))
         {
             return_code = 1;
@@ -564,6 +581,7 @@ int main(
                 data_sharing,
                 data_loans,
                 shared_memory,
+                io_uring,
                 forced_domain);
         }
 
@@ -89,6 +89,12 @@ if __name__ == '__main__':
         help='Explicitly enable/disable shared memory transport. (Defaults: Fast-DDS default settings)',
         required=False
         )
+    parser.add_argument(
+        '--io_uring',
+        choices=['on', 'off'],
+        help='Use the io_uring based UDPv4 transport. (Defaults: off)',
+        required=False
+        )
 
     # Parse arguments
     args = parser.parse_args()
@@ -171,6 +177,9 @@ if __name__ == '__main__':
         else:
             data_options += ['--shared_memory=off']
 
+    if args.io_uring:
+        data_options += ['--io_uring={}'.format(args.io_uring)]
+
     # Recoveries files options
     recoveries_options = []
     if args.recoveries_file:
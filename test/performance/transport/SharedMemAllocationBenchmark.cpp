@@ -0,0 +1,125 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SharedMemAllocationBenchmark.cpp
+ *
+ * Measures the cost of allocating buffers on a shared memory segment from several writer threads at once.
+ * Each writer keeps a few buffers alive, as a writer whose samples are still being delivered does, and
+ * releases the oldest one before every allocation.
+ *
+ * Usage: SharedMemAllocationBenchmark [max_writers] [allocations_per_writer] [buffer_size]
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <rtps/transport/shared_mem/SharedMemManager.hpp>
+
+using namespace eprosima::fastdds::rtps;
+
+//! Buffers each writer keeps alive
+static constexpr uint32_t live_buffers = 16;
+
+static void run(
+        const std::shared_ptr<SharedMemManager>& manager,
+        uint32_t writers,
+        uint64_t allocations,
+        uint32_t buffer_size)
+{
+    auto segment = manager->create_segment(2 * writers * live_buffers * buffer_size, writers * live_buffers);
+
+    std::atomic<uint64_t> failures(0);
+    std::vector<std::thread> threads;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t w = 0; w < writers; ++w)
+    {
+        threads.emplace_back([&]()
+                {
+                    std::vector<std::shared_ptr<SharedMemManager::Buffer>> buffers(live_buffers);
+                    for (uint64_t i = 0; i < allocations; ++i)
+                    {
+                        auto& buffer = buffers[i % live_buffers];
+                        buffer.reset();
+                        try
+                        {
+                            buffer = segment->alloc_buffer(buffer_size,
+                                            std::chrono::steady_clock::now() + std::chrono::milliseconds(100));
+                            memset(buffer->data(), 0, 8);
+                        }
+                        catch (const std::exception&)
+                        {
+                            failures.fetch_add(1, std::memory_order_relaxed);
+                        }
+                    }
+                });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    double total = static_cast<double>(allocations * writers);
+    std::cout << writers << " writer(s): " << (ns / total) << " ns/allocation, "
+              << (total * 1e9 / ns) << " allocations/s, " << failures.load() << " failed" << std::endl;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t max_writers = 8;
+    uint64_t allocations = 200000;
+    uint32_t buffer_size = 1024;
+    if (1 < argc)
+    {
+        max_writers = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (2 < argc)
+    {
+        allocations = std::strtoull(argv[2], nullptr, 10);
+    }
+    if (3 < argc)
+    {
+        buffer_size = static_cast<uint32_t>(std::strtoul(argv[3], nullptr, 10));
+    }
+    if (0 == max_writers || 0 == allocations || 0 == buffer_size)
+    {
+        std::cerr << "Usage: " << argv[0] << " [max_writers] [allocations_per_writer] [buffer_size]" << std::endl;
+        return 1;
+    }
+
+    auto manager = SharedMemManager::create("fastdds_alloc_bench");
+    if (!manager)
+    {
+        std::cerr << "Cannot create the shared memory manager" << std::endl;
+        return 1;
+    }
+
+    for (uint32_t writers = 1; writers <= max_writers; writers *= 2)
+    {
+        run(manager, writers, allocations, buffer_size);
+    }
+    return 0;
+}
@@ -0,0 +1,111 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SharedMemSegmentBenchmark.cpp
+ *
+ * Compares the cost of touching and randomly reading a big shared memory segment backed with default pages,
+ * with huge pages, and with huge pages placed on the NUMA node of the benchmark thread.
+ * Random reads over a big segment are dominated by TLB misses, which huge pages reduce.
+ *
+ * Usage: SharedMemSegmentBenchmark [segment_size_mb] [reads]
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+
+#include <rtps/transport/shared_mem/SharedMemManager.hpp>
+
+using namespace eprosima::fastdds::rtps;
+
+static void run(
+        const std::shared_ptr<SharedMemManager>& manager,
+        const char* name,
+        bool huge_pages,
+        bool local_numa_node,
+        uint32_t segment_size,
+        uint64_t reads)
+{
+    auto segment = manager->create_segment(segment_size, 1);
+
+    bool huge_pages_used = huge_pages && segment->use_huge_pages();
+    bool numa_node_used = local_numa_node && segment->bind_to_numa_node(-1);
+
+    auto buffer = segment->alloc_buffer(segment_size, std::chrono::steady_clock::now() + std::chrono::seconds(1));
+
+    auto start = std::chrono::steady_clock::now();
+    memset(buffer->data(), 1, segment_size);
+    auto touch_elapsed = std::chrono::steady_clock::now() - start;
+
+    // Reads on pseudo-random positions, so neither the caches nor the TLB can hold the working set
+    const uint8_t* data = static_cast<const uint8_t*>(buffer->data());
+    uint64_t state = 88172645463325252ull;
+    uint64_t sum = 0;
+    start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < reads; ++i)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        sum += data[state % segment_size];
+    }
+    auto read_elapsed = std::chrono::steady_clock::now() - start;
+
+    double touch_ms = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::microseconds>(touch_elapsed).count()) / 1000.0;
+    double read_ns = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(read_elapsed).count());
+    std::cout << name << ": touch " << touch_ms << " ms, " << (read_ns / static_cast<double>(reads))
+              << " ns/read (huge pages " << (huge_pages_used ? "on" : "off")
+              << ", NUMA placement " << (numa_node_used ? "on" : "off") << ", checksum " << sum << ")"
+              << std::endl;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t segment_size_mb = 256;
+    uint64_t reads = 20000000;
+    if (1 < argc)
+    {
+        segment_size_mb = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (2 < argc)
+    {
+        reads = std::strtoull(argv[2], nullptr, 10);
+    }
+    if (0 == segment_size_mb || 2048 <= segment_size_mb || 0 == reads)
+    {
+        std::cerr << "Usage: " << argv[0] << " [segment_size_mb] [reads]" << std::endl;
+        return 1;
+    }
+
+    auto manager = SharedMemManager::create("fastdds_segment_bench");
+    if (!manager)
+    {
+        std::cerr << "Cannot create the shared memory manager" << std::endl;
+        return 1;
+    }
+
+    uint32_t segment_size = segment_size_mb * 1024 * 1024;
+    run(manager, "Default pages         ", false, false, segment_size, reads);
+    run(manager, "Huge pages            ", true, false, segment_size, reads);
+    run(manager, "Huge pages, local node", true, true, segment_size, reads);
+    return 0;
+}
@@ -0,0 +1,139 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file UDPConnectedSocketsBenchmark.cpp
+ *
+ * Compares the cost of sending unicast datagrams on loopback through the unconnected output socket of a
+ * UDPv4 transport with the cost of sending them through the connected sockets of the transport.
+ *
+ * Usage: UDPConnectedSocketsBenchmark [datagrams] [datagram_size]
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <fastdds/rtps/common/LocatorList.hpp>
+#include <fastdds/rtps/transport/SenderResource.h>
+#include <fastdds/rtps/transport/TransportReceiverInterface.h>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
+#include <fastrtps/utils/IPLocator.h>
+
+#include <rtps/transport/UDPv4Transport.h>
+
+using namespace eprosima::fastdds::rtps;
+using IPLocator = eprosima::fastrtps::rtps::IPLocator;
+
+static constexpr uint16_t benchmark_port = 7411 + 1000;
+
+class CountingReceiver : public TransportReceiverInterface
+{
+public:
+
+    void OnDataReceived(
+            const eprosima::fastrtps::rtps::octet*,
+            const uint32_t,
+            const Locator&,
+            const Locator&) override
+    {
+        received.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::atomic<uint64_t> received {0};
+};
+
+static void run(
+        const char* name,
+        uint32_t max_connected_sockets,
+        uint64_t datagrams,
+        uint32_t datagram_size)
+{
+    UDPv4TransportDescriptor descriptor;
+    descriptor.max_connected_sockets = max_connected_sockets;
+    descriptor.receiveBufferSize = 8 * 1024 * 1024;
+    UDPv4Transport transport(descriptor);
+    if (!transport.init())
+    {
+        std::cerr << "Cannot initialize the transport" << std::endl;
+        return;
+    }
+
+    Locator locator;
+    locator.kind = LOCATOR_KIND_UDPv4;
+    locator.port = benchmark_port;
+    IPLocator::setIPv4(locator, 127, 0, 0, 1);
+
+    CountingReceiver receiver;
+    SendResourceList send_resources;
+    if (!transport.OpenInputChannel(locator, &receiver, descriptor.maxMessageSize) ||
+            !transport.OpenOutputChannel(send_resources, locator) || send_resources.empty())
+    {
+        std::cerr << "Cannot open the channels on " << locator << std::endl;
+        return;
+    }
+
+    std::vector<eprosima::fastrtps::rtps::octet> data(datagram_size, 0xAA);
+    LocatorList destinations;
+    destinations.push_back(locator);
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < datagrams; ++i)
+    {
+        Locators begin(destinations.begin());
+        Locators end(destinations.end());
+        send_resources.at(0)->send(data.data(), datagram_size, &begin, &end,
+                std::chrono::steady_clock::now() + std::chrono::milliseconds(100));
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    // Let the listening thread drain the socket
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    std::cout << name << ": " << (ns / static_cast<double>(datagrams)) << " ns/datagram, "
+              << receiver.received.load() << "/" << datagrams << " datagrams received" << std::endl;
+
+    send_resources.clear();
+    transport.CloseInputChannel(locator);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint64_t datagrams = 200000;
+    uint32_t datagram_size = 64;
+    if (1 < argc)
+    {
+        datagrams = std::strtoull(argv[1], nullptr, 10);
+    }
+    if (2 < argc)
+    {
+        datagram_size = static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10));
+    }
+    if (0 == datagrams || 0 == datagram_size)
+    {
+        std::cerr << "Usage: " << argv[0] << " [datagrams] [datagram_size]" << std::endl;
+        return 1;
+    }
+
+    run("Unconnected socket", 0, datagrams, datagram_size);
+    run("Connected sockets ", 4, datagrams, datagram_size);
+    return 0;
+}
@@ -132,6 +132,51 @@ TEST(CacheChange, FragmentManagement)
     }
 }
 
+/*!
+ * @fn TEST(CacheChange, FragmentManagementManyFragments)
+ * @brief This test checks the fragment management of CacheChange_t when the missing fragments span several words.
+ */
+TEST(CacheChange, FragmentManagementManyFragments)
+{
+    const uint32_t num_fragments = 100;
+    CacheChange_t uut(num_fragments);
+    uut.serializedPayload.length = num_fragments;
+    uut.setFragmentSize(1, true);
+    ASSERT_EQ(num_fragments, uut.getFragmentCount());
+
+    SerializedPayload_t payload(num_fragments);
+    payload.length = num_fragments;
+
+    // Receive every fragment except those multiple of 30, starting from the end
+    for (uint32_t fragment = num_fragments; fragment > 0; --fragment)
+    {
+        if (0 != fragment % 30)
+        {
+            uut.add_fragments(payload, fragment, 1);
+        }
+    }
+
+    FragmentNumberSet_t fns;
+    uut.get_missing_fragments(fns);
+    EXPECT_EQ(30u, fns.base());
+    for (FragmentNumber_t i = 1; i <= num_fragments; i++)
+    {
+        EXPECT_EQ(0 == i % 30, fns.is_set(i)) << "  index: " << i;
+    }
+    EXPECT_FALSE(uut.is_fully_assembled());
+    EXPECT_TRUE(uut.contains_first_fragment());
+
+    // Receive a range covering the missing fragments 30 and 60, crossing a word boundary
+    uut.add_fragments(payload, 29, 32);
+    uut.get_missing_fragments(fns);
+    EXPECT_EQ(90u, fns.base());
+    EXPECT_TRUE(fns.is_set(90));
+    EXPECT_FALSE(uut.is_fully_assembled());
+
+    EXPECT_TRUE(uut.add_fragments(payload, 90, 1));
+    EXPECT_TRUE(uut.is_fully_assembled());
+}
+
 int main(
         int argc,
         char **argv)
@@ -0,0 +1,282 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/common/CDRMessage_t.h>
+#include <fastdds/rtps/common/Locator.h>
+#include <fastdds/rtps/messages/RTPS_messages.h>
+#include <fastdds/rtps/messages/RTPSMessageCreator.h>
+#include <fastdds/rtps/resources/ResourceEvent.h>
+
+#include <rtps/messages/ControlMessagesAggregator.hpp>
+#include <statistics/rtps/messages/RTPSStatisticsMessages.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+//! Size of an INFO_DST submessage
+static constexpr uint32_t info_dst_size = RTPSMESSAGE_SUBMESSAGEHEADER_SIZE + 12u;
+//! Size of a HEARTBEAT submessage
+static constexpr uint32_t heartbeat_size = RTPSMESSAGE_SUBMESSAGEHEADER_SIZE + 28u;
+//! Size of the statistics submessage added to every message sent
+#ifdef FASTDDS_STATISTICS
+static constexpr uint32_t statistics_size = fastdds::statistics::rtps::statistics_submessage_length;
+#else
+static constexpr uint32_t statistics_size = 0u;
+#endif // ifdef FASTDDS_STATISTICS
+
+class ControlMessagesAggregatorTests : public ::testing::Test
+{
+protected:
+
+    struct SentMessage
+    {
+        std::vector<octet> data;
+        std::vector<Locator_t> locators;
+    };
+
+    void SetUp() override
+    {
+        event_resource_.init_thread();
+
+        Locator_t locator;
+        locator.kind = LOCATOR_KIND_UDPv4;
+        locator.port = 7410;
+        locators_a_.push_back(locator);
+        locator.port = 7411;
+        locators_b_.push_back(locator);
+
+        local_prefix_.value[0] = 1;
+        remote_prefix_.value[0] = 2;
+    }
+
+    void TearDown() override
+    {
+        event_resource_.stop_thread();
+    }
+
+    std::unique_ptr<ControlMessagesAggregator> create_aggregator(
+            uint32_t max_message_size = 65500,
+            uint32_t period_us = 10000)
+    {
+        return std::unique_ptr<ControlMessagesAggregator>(new ControlMessagesAggregator(event_resource_,
+                       max_message_size, period_us,
+                       [this](CDRMessage_t* message, const std::vector<Locator_t>& locators)
+                       {
+                           std::lock_guard<std::mutex> guard(mutex_);
+                           SentMessage sent;
+                           sent.data.assign(message->buffer, message->buffer + message->length);
+                           sent.locators = locators;
+                           sent_.push_back(std::move(sent));
+                           cv_.notify_all();
+                       }));
+    }
+
+    void create_heartbeat(
+            CDRMessage_t& message,
+            bool with_info_dst,
+            Count_t count = 1)
+    {
+        EntityId_t writer_id(0x00000102);
+        if (with_info_dst)
+        {
+            RTPSMessageCreator::addMessageHeartbeat(&message, local_prefix_, remote_prefix_, c_EntityId_Unknown,
+                    writer_id, SequenceNumber_t(0, 1), SequenceNumber_t(0, 1), count, false, false);
+        }
+        else
+        {
+            RTPSMessageCreator::addMessageHeartbeat(&message, local_prefix_, c_EntityId_Unknown,
+                    writer_id, SequenceNumber_t(0, 1), SequenceNumber_t(0, 1), count, false, false);
+        }
+    }
+
+    bool wait_sent(
+            size_t num_messages)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, std::chrono::seconds(2), [&]()
+                       {
+                           return sent_.size() >= num_messages;
+                       });
+    }
+
+    size_t num_sent()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return sent_.size();
+    }
+
+    ResourceEvent event_resource_;
+    std::vector<Locator_t> locators_a_;
+    std::vector<Locator_t> locators_b_;
+    GuidPrefix_t local_prefix_;
+    GuidPrefix_t remote_prefix_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<SentMessage> sent_;
+};
+
+TEST_F(ControlMessagesAggregatorTests, is_control_message)
+{
+    bool starts_with_info_dst = false;
+    uint32_t submessages_end = 0;
+
+    CDRMessage_t heartbeat(RTPSMESSAGE_DEFAULT_SIZE);
+    create_heartbeat(heartbeat, false);
+    EXPECT_TRUE(ControlMessagesAggregator::is_control_message(&heartbeat, starts_with_info_dst, submessages_end));
+    EXPECT_FALSE(starts_with_info_dst);
+    EXPECT_EQ(heartbeat.length, submessages_end);
+
+    CDRMessage_t heartbeat_to_participant(RTPSMESSAGE_DEFAULT_SIZE);
+    create_heartbeat(heartbeat_to_participant, true);
+    EXPECT_TRUE(ControlMessagesAggregator::is_control_message(&heartbeat_to_participant, starts_with_info_dst,
+            submessages_end));
+    EXPECT_TRUE(starts_with_info_dst);
+    EXPECT_EQ(heartbeat_to_participant.length, submessages_end);
+
+    CDRMessage_t acknack(RTPSMESSAGE_DEFAULT_SIZE);
+    SequenceNumberSet_t sn_set(SequenceNumber_t(0, 1));
+    RTPSMessageCreator::addMessageAcknack(&acknack, local_prefix_, remote_prefix_, c_EntityId_Unknown,
+            EntityId_t(0x00000102), sn_set, 1, false);
+    EXPECT_TRUE(ControlMessagesAggregator::is_control_message(&acknack, starts_with_info_dst, submessages_end));
+
+    // A GAP is sent along with data, so it is not kept
+    CDRMessage_t gap(RTPSMESSAGE_DEFAULT_SIZE);
+    RTPSMessageCreator::addMessageGap(&gap, local_prefix_, remote_prefix_, SequenceNumber_t(0, 1), sn_set,
+            c_EntityId_Unknown, EntityId_t(0x00000102));
+    EXPECT_FALSE(ControlMessagesAggregator::is_control_message(&gap, starts_with_info_dst, submessages_end));
+
+    // Only INFO_DST
+    CDRMessage_t info_dst(RTPSMESSAGE_DEFAULT_SIZE);
+    RTPSMessageCreator::addHeader(&info_dst, local_prefix_);
+    RTPSMessageCreator::addSubmessageInfoDST(&info_dst, remote_prefix_);
+    EXPECT_FALSE(ControlMessagesAggregator::is_control_message(&info_dst, starts_with_info_dst, submessages_end));
+
+    // Truncated submessage
+    heartbeat.length -= 1;
+    EXPECT_FALSE(ControlMessagesAggregator::is_control_message(&heartbeat, starts_with_info_dst, submessages_end));
+}
+
+TEST_F(ControlMessagesAggregatorTests, same_destination_sent_together)
+{
+    auto aggregator = create_aggregator();
+
+    CDRMessage_t first(RTPSMESSAGE_DEFAULT_SIZE);
+    create_heartbeat(first, true, 1);
+    CDRMessage_t second(RTPSMESSAGE_DEFAULT_SIZE);
+    create_heartbeat(second, true, 2);
+
+    EXPECT_TRUE(aggregator->add(&first, locators_a_.cbegin(), locators_a_.cend()));
+    EXPECT_TRUE(aggregator->add(&second, locators_a_.cbegin(), locators_a_.cend()));
+
+    ASSERT_TRUE(wait_sent(1));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_EQ(1u, num_sent());
+
+    const SentMessage& sent = sent_[0];
+    EXPECT_EQ(locators_a_, sent.locators);
+    ASSERT_EQ(RTPSMESSAGE_HEADER_SIZE + 2 * (info_dst_size + heartbeat_size) + statistics_size, sent.data.size());
+    EXPECT_EQ(0, memcmp(sent.data.data(), first.buffer, first.length));
+    EXPECT_EQ(0, memcmp(&sent.data[first.length], &second.buffer[RTPSMESSAGE_HEADER_SIZE],
+            second.length - RTPSMESSAGE_HEADER_SIZE));
+}
+
+TEST_F(ControlMessagesAggregatorTests, different_destinations_sent_apart)
+{
+    auto aggregator = create_aggregator();
+
+    CDRMessage_t message(RTPSMESSAGE_DEFAULT_SIZE);
+    create_heartbeat(message, true);
+
+    EXPECT_TRUE(aggregator->add(&message, locators_a_.cbegin(), locators_a_.cend()));
+    EXPECT_TRUE(aggregator->add(&message, locators_b_.cbegin(), locators_b_.cend()));
+
+    ASSERT_TRUE(wait_sent(2));
+    for (const SentMessage& sent : sent_)
+    {
+        EXPECT_EQ(message.length + statistics_size, sent.data.size());
+    }
+    EXPECT_NE(sent_[0].locators, sent_[1].locators);
+}
+
+TEST_F(ControlMessagesAggregatorTests, info_dst_added_when_missing)
+{
+    auto aggregator = create_aggregator();
+
+    CDRMessage_t to_participant(RTPSMESSAGE_DEFAULT_SIZE);
+    create_heartbeat(to_participant, true);
+    CDRMessage_t to_all(RTPSMESSAGE_DEFAULT_SIZE);
+    create_heartbeat(to_all, false);
+
+    EXPECT_TRUE(aggregator->add(&to_participant, locators_a_.cbegin(), locators_a_.cend()));
+    EXPECT_TRUE(aggregator->add(&to_all, locators_a_.cbegin(), locators_a_.cend()));
+
+    ASSERT_TRUE(wait_sent(1));
+    const SentMessage& sent = sent_[0];
+    ASSERT_EQ(RTPSMESSAGE_HEADER_SIZE + 2 * (info_dst_size + heartbeat_size) + statistics_size, sent.data.size());
+
+    // The second heartbeat is addressed to every participant
+    uint32_t info_dst_pos = to_participant.length;
+    EXPECT_EQ(INFO_DST, sent.data[info_dst_pos]);
+    GuidPrefix_t destination;
+    memcpy(destination.value, &sent.data[info_dst_pos + RTPSMESSAGE_SUBMESSAGEHEADER_SIZE], 12);
+    EXPECT_EQ(c_GuidPrefix_Unknown, destination);
+}
+
+TEST_F(ControlMessagesAggregatorTests, full_group_sent_right_away)
+{
+    // Only room for one heartbeat on each message
+    uint32_t max_message_size = RTPSMESSAGE_HEADER_SIZE + info_dst_size + heartbeat_size + statistics_size;
+    auto aggregator = create_aggregator(max_message_size, 1000000);
+
+    CDRMessage_t message(RTPSMESSAGE_DEFAULT_SIZE);
+    create_heartbeat(message, true);
+
+    EXPECT_TRUE(aggregator->add(&message, locators_a_.cbegin(), locators_a_.cend()));
+    EXPECT_EQ(0u, num_sent());
+    EXPECT_TRUE(aggregator->add(&message, locators_a_.cbegin(), locators_a_.cend()));
+    EXPECT_EQ(1u, num_sent());
+
+    aggregator->flush();
+    EXPECT_EQ(2u, num_sent());
+
+    // Messages bigger than the limit are sent by the caller
+    CDRMessage_t big_message(RTPSMESSAGE_DEFAULT_SIZE);
+    create_heartbeat(big_message, true);
+    RTPSMessageCreator::addSubmessageHeartbeat(&big_message, c_EntityId_Unknown, EntityId_t(0x00000102),
+            SequenceNumber_t(0, 1), SequenceNumber_t(0, 1), 2, false, false);
+    EXPECT_FALSE(aggregator->add(&big_message, locators_a_.cbegin(), locators_a_.cend()));
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
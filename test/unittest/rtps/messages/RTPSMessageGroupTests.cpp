@@ -0,0 +1,296 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/attributes/WriterAttributes.h>
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/CDRMessage_t.h>
+#include <fastdds/rtps/history/WriterHistory.h>
+#include <fastdds/rtps/messages/RTPS_messages.h>
+#include <fastdds/rtps/messages/RTPSMessageCreator.h>
+#include <fastdds/rtps/messages/RTPSMessageGroup.h>
+#include <fastdds/rtps/messages/RTPSMessageSenderInterface.hpp>
+#include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/transport/NetworkBuffer.hpp>
+#include <fastdds/rtps/writer/RTPSWriter.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Sender keeping a copy of every message, telling apart the ones sent as a list of slices.
+ */
+class CapturingSender : public RTPSMessageSenderInterface
+{
+public:
+
+    struct SentMessage
+    {
+        std::vector<octet> data;
+        bool gathered = false;
+    };
+
+    bool destinations_have_changed() const override
+    {
+        return false;
+    }
+
+    GuidPrefix_t destination_guid_prefix() const override
+    {
+        return c_GuidPrefix_Unknown;
+    }
+
+    const std::vector<GuidPrefix_t>& remote_participants() const override
+    {
+        return remote_participants_;
+    }
+
+    const std::vector<GUID_t>& remote_guids() const override
+    {
+        return remote_guids_;
+    }
+
+    bool send(
+            CDRMessage_t* message,
+            std::chrono::steady_clock::time_point /*max_blocking_time_point*/) const override
+    {
+        SentMessage sent;
+        sent.data.assign(message->buffer, message->buffer + message->length);
+        sent_.push_back(std::move(sent));
+        return true;
+    }
+
+    bool send_gather(
+            const std::vector<fastdds::rtps::NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            uint32_t /*segment_size*/,
+            std::chrono::steady_clock::time_point /*max_blocking_time_point*/) const override
+    {
+        SentMessage sent;
+        sent.data.resize(total_bytes);
+        fastdds::rtps::copy_network_buffers(buffers, total_bytes, sent.data.data());
+        sent.gathered = true;
+        sent_.push_back(std::move(sent));
+        return true;
+    }
+
+    void lock() override
+    {
+        mutex_.lock();
+    }
+
+    void unlock() override
+    {
+        mutex_.unlock();
+    }
+
+    mutable std::vector<SentMessage> sent_;
+
+private:
+
+    std::vector<GuidPrefix_t> remote_participants_;
+    std::vector<GUID_t> remote_guids_;
+    std::mutex mutex_;
+};
+
+class RTPSMessageGroupTests : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        RTPSParticipantAttributes p_attr;
+        participant_ = RTPSDomain::createParticipant(0, true, p_attr);
+        ASSERT_NE(nullptr, participant_);
+
+        history_ = new WriterHistory(HistoryAttributes());
+        WriterAttributes w_attr;
+        writer_ = RTPSDomain::createRTPSWriter(participant_, w_attr, history_);
+        ASSERT_NE(nullptr, writer_);
+    }
+
+    void TearDown() override
+    {
+        if (nullptr != writer_)
+        {
+            RTPSDomain::removeRTPSWriter(writer_);
+        }
+        if (nullptr != participant_)
+        {
+            RTPSDomain::removeRTPSParticipant(participant_);
+        }
+        delete history_;
+    }
+
+    void fill_change(
+            CacheChange_t& change,
+            uint32_t payload_size)
+    {
+        change.kind = ALIVE;
+        change.writerGUID = writer_->getGuid();
+        change.sequenceNumber = SequenceNumber_t(0, 1);
+        change.serializedPayload.reserve(payload_size);
+        change.serializedPayload.length = payload_size;
+        for (uint32_t i = 0; i < payload_size; ++i)
+        {
+            change.serializedPayload.data[i] = static_cast<octet>(i * 7 + 3);
+        }
+    }
+
+    /**
+     * Walk the submessages of a message, checking all of them are aligned and their lengths add up to the
+     * size of the message, and return the bytes of the first one with the given id.
+     */
+    static bool find_submessage(
+            const std::vector<octet>& message,
+            octet submessage_id,
+            std::vector<octet>& submessage)
+    {
+        bool found = false;
+        uint32_t length = static_cast<uint32_t>(message.size());
+        uint32_t pos = RTPSMESSAGE_HEADER_SIZE;
+        while (pos < length)
+        {
+            if (0 != pos % 4 || length - pos < RTPSMESSAGE_SUBMESSAGEHEADER_SIZE)
+            {
+                return false;
+            }
+
+            const octet* header = &message[pos];
+            uint16_t size = (header[1] & BIT(0)) ?
+                    static_cast<uint16_t>(header[2] | (header[3] << 8)) :
+                    static_cast<uint16_t>((header[2] << 8) | header[3]);
+            uint32_t next_pos = pos + RTPSMESSAGE_SUBMESSAGEHEADER_SIZE + size;
+            if (next_pos > length)
+            {
+                return false;
+            }
+
+            if (!found && submessage_id == header[0])
+            {
+                submessage.assign(header, &message[0] + next_pos);
+                found = true;
+            }
+
+            pos = next_pos;
+        }
+
+        return found && pos == length;
+    }
+
+    RTPSParticipant* participant_ = nullptr;
+    WriterHistory* history_ = nullptr;
+    RTPSWriter* writer_ = nullptr;
+    CapturingSender sender_;
+};
+
+TEST_F(RTPSMessageGroupTests, referenced_data_matches_copied_data)
+{
+    // Payloads of every padding length, above and below the size from which they are referenced
+    for (uint32_t payload_size : {20000u, 20001u, 20002u, 20003u, 1001u})
+    {
+        sender_.sent_.clear();
+
+        CacheChange_t change;
+        fill_change(change, payload_size);
+
+        {
+            RTPSMessageGroup group(writer_->getRTPSParticipant(), writer_, &sender_);
+            ASSERT_TRUE(group.add_data(change, false));
+        }
+
+        ASSERT_FALSE(sender_.sent_.empty());
+        const CapturingSender::SentMessage& sent = sender_.sent_.front();
+        EXPECT_EQ(16 * 1024 <= payload_size, sent.gathered);
+
+        std::vector<octet> sent_submessage;
+        ASSERT_TRUE(find_submessage(sent.data, DATA, sent_submessage)) << "Payload size " << payload_size;
+
+        CDRMessage_t expected(65500);
+        bool is_big_submessage = false;
+        ASSERT_TRUE(RTPSMessageCreator::addSubmessageData(&expected, &change, writer_->getAttributes().topicKind,
+                c_EntityId_Unknown, false, nullptr, &is_big_submessage));
+
+        ASSERT_EQ(expected.length, sent_submessage.size()) << "Payload size " << payload_size;
+        EXPECT_EQ(0, memcmp(expected.buffer, sent_submessage.data(), expected.length))
+            << "Payload size " << payload_size;
+    }
+}
+
+TEST_F(RTPSMessageGroupTests, referenced_data_frag_matches_copied_data_frag)
+{
+    // Two referenced fragments and a shorter last one, which is copied
+    const uint16_t fragment_size = 20001;
+    const uint32_t payload_size = 50003;
+
+    CacheChange_t change;
+    fill_change(change, payload_size);
+    change.setFragmentSize(fragment_size);
+    ASSERT_EQ(3u, change.getFragmentCount());
+
+    for (uint32_t fragment_number = 1; fragment_number <= change.getFragmentCount(); ++fragment_number)
+    {
+        sender_.sent_.clear();
+
+        {
+            RTPSMessageGroup group(writer_->getRTPSParticipant(), writer_, &sender_);
+            ASSERT_TRUE(group.add_data_frag(change, fragment_number, false));
+        }
+
+        ASSERT_FALSE(sender_.sent_.empty());
+        const CapturingSender::SentMessage& sent = sender_.sent_.front();
+        EXPECT_EQ(fragment_number < change.getFragmentCount(), sent.gathered);
+
+        std::vector<octet> sent_submessage;
+        ASSERT_TRUE(find_submessage(sent.data, DATA_FRAG, sent_submessage)) << "Fragment " << fragment_number;
+
+        uint32_t fragment_start = fragment_size * (fragment_number - 1);
+        SerializedPayload_t fragment;
+        fragment.data = change.serializedPayload.data + fragment_start;
+        fragment.length = (std::min)(static_cast<uint32_t>(fragment_size), payload_size - fragment_start);
+
+        CDRMessage_t expected(65500);
+        bool added = RTPSMessageCreator::addSubmessageDataFrag(&expected, &change, fragment_number, fragment,
+                        writer_->getAttributes().topicKind, c_EntityId_Unknown, false, nullptr);
+        fragment.data = nullptr;
+        ASSERT_TRUE(added);
+
+        ASSERT_EQ(expected.length, sent_submessage.size()) << "Fragment " << fragment_number;
+        EXPECT_EQ(0, memcmp(expected.buffer, sent_submessage.data(), expected.length))
+            << "Fragment " << fragment_number;
+    }
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
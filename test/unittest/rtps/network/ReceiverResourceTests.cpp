@@ -0,0 +1,270 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/messages/MessageReceiver.h>
+
+#include <MockTransport.h>
+#include <rtps/network/NetworkFactory.h>
+#include <rtps/network/ReceiverResource.h>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+/**
+ * Message receiver counting the messages it processes, which can be held on the processing call to make the
+ * receive pipeline fill up.
+ */
+class BlockingMessageReceiver : public MessageReceiver
+{
+public:
+
+    BlockingMessageReceiver()
+        : MessageReceiver(nullptr, nullptr)
+    {
+    }
+
+    void processCDRMsg(
+            const Locator_t& /*source_locator*/,
+            const Locator_t& /*reception_locator*/,
+            CDRMessage_t* msg,
+            const Time_t& /*reception_timestamp*/) override
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        processing = true;
+        cv.notify_all();
+        cv.wait(lock, [this]()
+                {
+                    return !blocked;
+                });
+        processing = false;
+        ++processed;
+        last_size = msg->length;
+        last_thread = std::this_thread::get_id();
+        cv.notify_all();
+    }
+
+    bool wait_processing()
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        return cv.wait_for(lock, std::chrono::seconds(2), [this]()
+                       {
+                           return processing;
+                       });
+    }
+
+    bool wait_processed(
+            uint32_t num_messages)
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        return cv.wait_for(lock, std::chrono::seconds(2), [&]()
+                       {
+                           return processed >= num_messages;
+                       });
+    }
+
+    void block()
+    {
+        std::lock_guard<std::mutex> guard(mtx);
+        blocked = true;
+    }
+
+    void release()
+    {
+        std::lock_guard<std::mutex> guard(mtx);
+        blocked = false;
+        cv.notify_all();
+    }
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool blocked = false;
+    bool processing = false;
+    uint32_t processed = 0;
+    uint32_t last_size = 0;
+    std::thread::id last_thread;
+};
+
+class ReceiverResourceTests : public ::testing::Test
+{
+public:
+
+    std::shared_ptr<ReceiverResource> build_resource(
+            const std::string& pipeline_depth)
+    {
+        RTPSParticipantAttributes attributes;
+        if (!pipeline_depth.empty())
+        {
+            attributes.properties.properties().emplace_back("fastdds.receive_pipeline_depth", pipeline_depth);
+        }
+        network_factory.reset(new NetworkFactory(attributes));
+
+        MockTransportDescriptor descriptor;
+        descriptor.supportedKind = kind;
+        descriptor.maximumChannels = 10;
+        network_factory->RegisterTransport(&descriptor);
+
+        locator.kind = kind;
+        locator.port = 7400;
+        std::vector<std::shared_ptr<ReceiverResource>> resources;
+        EXPECT_TRUE(network_factory->BuildReceiverResources(locator, resources, 0x8FFF));
+        EXPECT_EQ(1u, resources.size());
+        return resources.empty() ? nullptr : resources.front();
+    }
+
+    void receive(
+            ReceiverResource& resource,
+            uint32_t size = 16)
+    {
+        std::vector<octet> data(size, 0xAB);
+        resource.OnDataReceived(data.data(), size, locator, remote_locator);
+    }
+
+    const int32_t kind = 3;
+    Locator_t locator;
+    Locator_t remote_locator;
+    std::unique_ptr<NetworkFactory> network_factory;
+    BlockingMessageReceiver message_receiver;
+};
+
+TEST_F(ReceiverResourceTests, messages_processed_on_transport_thread_without_pipeline)
+{
+    auto resource = build_resource("");
+    ASSERT_NE(nullptr, resource);
+    EXPECT_FALSE(resource->pipeline_enabled());
+    resource->RegisterReceiver(&message_receiver);
+
+    receive(*resource, 32);
+    EXPECT_EQ(1u, message_receiver.processed);
+    EXPECT_EQ(32u, message_receiver.last_size);
+    EXPECT_EQ(std::this_thread::get_id(), message_receiver.last_thread);
+
+    ReceiverResource::PipelineStatistics statistics = resource->pipeline_statistics();
+    EXPECT_EQ(0u, statistics.queue_depth);
+    EXPECT_EQ(0u, statistics.max_queue_depth);
+    EXPECT_EQ(0u, statistics.dropped);
+
+    resource->disable();
+}
+
+TEST_F(ReceiverResourceTests, messages_processed_on_pipeline_thread)
+{
+    auto resource = build_resource("4");
+    ASSERT_NE(nullptr, resource);
+    EXPECT_TRUE(resource->pipeline_enabled());
+    resource->RegisterReceiver(&message_receiver);
+
+    const uint32_t num_messages = 20;
+    for (uint32_t i = 0; i < num_messages; ++i)
+    {
+        receive(*resource, 32);
+        // Give the pipeline thread time to keep up, so no message is dropped
+        ASSERT_TRUE(message_receiver.wait_processed(i + 1));
+    }
+
+    EXPECT_EQ(32u, message_receiver.last_size);
+    EXPECT_NE(std::this_thread::get_id(), message_receiver.last_thread);
+
+    ReceiverResource::PipelineStatistics statistics = resource->pipeline_statistics();
+    EXPECT_EQ(0u, statistics.queue_depth);
+    EXPECT_LE(1u, statistics.max_queue_depth);
+    EXPECT_EQ(0u, statistics.dropped);
+
+    resource->disable();
+}
+
+TEST_F(ReceiverResourceTests, messages_dropped_when_pipeline_full)
+{
+    auto resource = build_resource("2");
+    ASSERT_NE(nullptr, resource);
+    resource->RegisterReceiver(&message_receiver);
+
+    // The first message keeps its buffer while the pipeline thread is stuck processing it
+    message_receiver.block();
+    receive(*resource);
+    ASSERT_TRUE(message_receiver.wait_processing());
+
+    // Only one buffer is left for the next messages
+    receive(*resource);
+    receive(*resource);
+    receive(*resource);
+
+    ReceiverResource::PipelineStatistics statistics = resource->pipeline_statistics();
+    EXPECT_EQ(1u, statistics.queue_depth);
+    EXPECT_EQ(1u, statistics.max_queue_depth);
+    EXPECT_EQ(2u, statistics.dropped);
+
+    // Messages bigger than the pipeline buffers are dropped too
+    receive(*resource, 0x8FFF + 1);
+    EXPECT_EQ(3u, resource->pipeline_statistics().dropped);
+
+    message_receiver.release();
+    ASSERT_TRUE(message_receiver.wait_processed(2));
+
+    // The buffers are given back once processed
+    receive(*resource);
+    ASSERT_TRUE(message_receiver.wait_processed(3));
+
+    statistics = resource->pipeline_statistics();
+    EXPECT_EQ(0u, statistics.queue_depth);
+    EXPECT_EQ(1u, statistics.max_queue_depth);
+    EXPECT_EQ(3u, statistics.dropped);
+
+    resource->disable();
+    EXPECT_EQ(3u, message_receiver.processed);
+}
+
+TEST_F(ReceiverResourceTests, pipeline_moved_along_with_resource)
+{
+    auto resource = build_resource("2");
+    ASSERT_NE(nullptr, resource);
+    resource->RegisterReceiver(&message_receiver);
+
+    // One dropped message, to check the counters are kept
+    message_receiver.block();
+    receive(*resource);
+    ASSERT_TRUE(message_receiver.wait_processing());
+    receive(*resource);
+    receive(*resource);
+    message_receiver.release();
+    ASSERT_TRUE(message_receiver.wait_processed(2));
+
+    ReceiverResource moved(std::move(*resource));
+    EXPECT_FALSE(resource->pipeline_enabled());
+    EXPECT_TRUE(moved.pipeline_enabled());
+    EXPECT_EQ(1u, moved.pipeline_statistics().dropped);
+
+    receive(moved);
+    ASSERT_TRUE(message_receiver.wait_processed(3));
+    EXPECT_NE(std::this_thread::get_id(), message_receiver.last_thread);
+
+    moved.disable();
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
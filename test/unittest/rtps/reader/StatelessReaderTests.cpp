@@ -0,0 +1,341 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/ReaderAttributes.h>
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/builtin/data/WriterProxyData.h>
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/history/IPayloadPool.h>
+#include <fastdds/rtps/history/ReaderHistory.h>
+#include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/reader/ReaderListener.h>
+#include <fastdds/rtps/reader/RTPSReader.h>
+#include <fastdds/rtps/RTPSDomain.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Payload pool allocating from the heap, counting the payloads in use.
+ */
+class CountingPayloadPool : public IPayloadPool
+{
+public:
+
+    bool get_payload(
+            uint32_t size,
+            CacheChange_t& cache_change) override
+    {
+        cache_change.serializedPayload.reserve(size);
+        cache_change.payload_owner(this);
+        ++payloads_in_use;
+        return true;
+    }
+
+    bool get_payload(
+            SerializedPayload_t& data,
+            IPayloadPool*& /*data_owner*/,
+            CacheChange_t& cache_change) override
+    {
+        get_payload(data.length, cache_change);
+        cache_change.serializedPayload.copy(&data, false);
+        return true;
+    }
+
+    bool release_payload(
+            CacheChange_t& cache_change) override
+    {
+        cache_change.serializedPayload.empty();
+        cache_change.payload_owner(nullptr);
+        --payloads_in_use;
+        return true;
+    }
+
+    int32_t payloads_in_use = 0;
+};
+
+/**
+ * Listener keeping the sequence number and payload of the samples notified, and taking them out of the history.
+ */
+class ReceivedSamplesListener : public ReaderListener
+{
+public:
+
+    void onNewCacheChangeAdded(
+            RTPSReader* reader,
+            const CacheChange_t* const change) override
+    {
+        sequence_numbers.push_back(change->sequenceNumber);
+        payloads.emplace_back(change->serializedPayload.data,
+                change->serializedPayload.data + change->serializedPayload.length);
+        reader->getHistory()->remove_change(const_cast<CacheChange_t*>(change));
+    }
+
+    std::vector<SequenceNumber_t> sequence_numbers;
+    std::vector<std::vector<octet>> payloads;
+};
+
+class StatelessReaderTests : public ::testing::Test
+{
+protected:
+
+    //! Size of the fragments sent by the writer
+    static constexpr uint16_t fragment_size = 100;
+    //! Size of the samples sent by the writer, split into three fragments
+    static constexpr uint32_t sample_size = 250;
+
+    void SetUp() override
+    {
+        RTPSParticipantAttributes p_attr;
+        participant_ = RTPSDomain::createParticipant(0, true, p_attr);
+        ASSERT_NE(nullptr, participant_);
+
+        writer_guid_.guidPrefix.value[0] = 0x0F;
+        writer_guid_.guidPrefix.value[11] = 0x01;
+        writer_guid_.entityId = 0x00000102;
+
+        other_writer_guid_ = writer_guid_;
+        other_writer_guid_.guidPrefix.value[11] = 0x02;
+    }
+
+    void TearDown() override
+    {
+        if (nullptr != reader_)
+        {
+            RTPSDomain::removeRTPSReader(reader_);
+        }
+        if (nullptr != participant_)
+        {
+            RTPSDomain::removeRTPSParticipant(participant_);
+        }
+        delete history_;
+    }
+
+    void create_reader(
+            int32_t max_samples)
+    {
+        history_ = new ReaderHistory(HistoryAttributes(DYNAMIC_RESERVE_MEMORY_MODE, sample_size, 1, max_samples));
+
+        ReaderAttributes r_attr;
+        r_attr.endpoint.reliabilityKind = BEST_EFFORT;
+        reader_ = RTPSDomain::createRTPSReader(participant_, r_attr, pool_, history_, &listener_);
+        ASSERT_NE(nullptr, reader_);
+
+        WriterProxyData writer_data(1, 1);
+        writer_data.guid(writer_guid_);
+        ASSERT_TRUE(reader_->matched_writer_add(writer_data));
+        writer_data.guid(other_writer_guid_);
+        ASSERT_TRUE(reader_->matched_writer_add(writer_data));
+    }
+
+    static std::vector<octet> sample_payload(
+            uint32_t sequence_number)
+    {
+        std::vector<octet> payload(sample_size);
+        for (uint32_t i = 0; i < sample_size; ++i)
+        {
+            payload[i] = static_cast<octet>(i + sequence_number * 31);
+        }
+        return payload;
+    }
+
+    //! Sends the given fragment (1 based) of a sample, as the message receiver does
+    void send_fragment(
+            uint32_t sequence_number,
+            uint32_t fragment_number)
+    {
+        send_fragment(writer_guid_, sequence_number, fragment_number);
+    }
+
+    void send_fragment(
+            const GUID_t& writer_guid,
+            uint32_t sequence_number,
+            uint32_t fragment_number)
+    {
+        std::vector<octet> payload = sample_payload(sequence_number);
+        uint32_t fragment_start = fragment_size * (fragment_number - 1);
+
+        CacheChange_t incoming;
+        incoming.kind = ALIVE;
+        incoming.writerGUID = writer_guid;
+        incoming.sequenceNumber = SequenceNumber_t(0, sequence_number);
+        incoming.setFragmentSize(fragment_size);
+        incoming.serializedPayload.data = payload.data() + fragment_start;
+        incoming.serializedPayload.length = (std::min)(static_cast<uint32_t>(fragment_size),
+                        sample_size - fragment_start);
+
+        reader_->processDataFragMsg(&incoming, sample_size, fragment_number, 1);
+
+        incoming.serializedPayload.data = nullptr;
+    }
+
+    void check_received(
+            const std::vector<uint32_t>& sequence_numbers)
+    {
+        ASSERT_EQ(sequence_numbers.size(), listener_.sequence_numbers.size());
+        for (size_t i = 0; i < sequence_numbers.size(); ++i)
+        {
+            EXPECT_EQ(SequenceNumber_t(0, sequence_numbers[i]), listener_.sequence_numbers[i]);
+            EXPECT_EQ(sample_payload(sequence_numbers[i]), listener_.payloads[i]);
+        }
+    }
+
+    RTPSParticipant* participant_ = nullptr;
+    ReaderHistory* history_ = nullptr;
+    RTPSReader* reader_ = nullptr;
+    std::shared_ptr<CountingPayloadPool> pool_ = std::make_shared<CountingPayloadPool>();
+    ReceivedSamplesListener listener_;
+    GUID_t writer_guid_;
+    GUID_t other_writer_guid_;
+};
+
+constexpr uint16_t StatelessReaderTests::fragment_size;
+constexpr uint32_t StatelessReaderTests::sample_size;
+
+TEST_F(StatelessReaderTests, interleaved_fragments_complete_every_sample)
+{
+    create_reader(10);
+
+    for (uint32_t fragment_number = 1; fragment_number <= 3; ++fragment_number)
+    {
+        send_fragment(1, fragment_number);
+        send_fragment(2, fragment_number);
+    }
+
+    check_received({1, 2});
+    EXPECT_EQ(0, pool_->payloads_in_use);
+}
+
+TEST_F(StatelessReaderTests, reordered_fragments_complete_every_sample)
+{
+    create_reader(10);
+
+    // The fragments of each sample arrive out of order, and the newer sample is started first
+    send_fragment(2, 3);
+    send_fragment(1, 2);
+    send_fragment(2, 1);
+    send_fragment(1, 3);
+    EXPECT_EQ(2, pool_->payloads_in_use);
+    check_received({});
+
+    send_fragment(1, 1);
+    check_received({1});
+
+    // Repeated fragments are ignored
+    send_fragment(2, 1);
+    send_fragment(2, 2);
+    check_received({1, 2});
+    EXPECT_EQ(0, pool_->payloads_in_use);
+
+    // Samples older than the last one notified are not reassembled
+    send_fragment(1, 1);
+    EXPECT_EQ(0, pool_->payloads_in_use);
+}
+
+TEST_F(StatelessReaderTests, pending_samples_released_on_unmatch)
+{
+    create_reader(10);
+
+    send_fragment(1, 1);
+    send_fragment(2, 2);
+    EXPECT_EQ(2, pool_->payloads_in_use);
+
+    EXPECT_TRUE(reader_->matched_writer_remove(writer_guid_));
+    EXPECT_EQ(0, pool_->payloads_in_use);
+    check_received({});
+
+    // Fragments from the unmatched writer are ignored
+    send_fragment(1, 2);
+    EXPECT_EQ(0, pool_->payloads_in_use);
+}
+
+TEST_F(StatelessReaderTests, pending_samples_limited_per_reader)
+{
+    create_reader(10);
+
+    // Only four samples are reassembled at the same time, so the oldest one is dropped
+    for (uint32_t sequence_number = 1; sequence_number <= 5; ++sequence_number)
+    {
+        send_fragment(sequence_number, 1);
+    }
+    EXPECT_EQ(4, pool_->payloads_in_use);
+
+    // Fragments of a sample older than the ones pending are dropped
+    send_fragment(1, 2);
+    send_fragment(1, 3);
+    EXPECT_EQ(4, pool_->payloads_in_use);
+
+    for (uint32_t sequence_number = 2; sequence_number <= 5; ++sequence_number)
+    {
+        send_fragment(sequence_number, 2);
+        send_fragment(sequence_number, 3);
+    }
+
+    check_received({2, 3, 4, 5});
+    EXPECT_EQ(0, pool_->payloads_in_use);
+}
+
+TEST_F(StatelessReaderTests, pending_samples_limit_shared_by_writers)
+{
+    create_reader(10);
+
+    for (uint32_t sequence_number = 1; sequence_number <= 4; ++sequence_number)
+    {
+        send_fragment(writer_guid_, sequence_number, 1);
+    }
+    EXPECT_EQ(4, pool_->payloads_in_use);
+
+    // A sample from another writer takes the place of the oldest sample of the first writer
+    send_fragment(other_writer_guid_, 1, 1);
+    EXPECT_EQ(4, pool_->payloads_in_use);
+
+    for (uint32_t fragment_number = 2; fragment_number <= 3; ++fragment_number)
+    {
+        send_fragment(writer_guid_, 1, fragment_number);
+    }
+    check_received({});
+    EXPECT_EQ(4, pool_->payloads_in_use);
+
+    for (uint32_t sequence_number = 2; sequence_number <= 4; ++sequence_number)
+    {
+        send_fragment(writer_guid_, sequence_number, 2);
+        send_fragment(writer_guid_, sequence_number, 3);
+    }
+    send_fragment(other_writer_guid_, 1, 2);
+    send_fragment(other_writer_guid_, 1, 3);
+
+    check_received({2, 3, 4, 1});
+    EXPECT_EQ(0, pool_->payloads_in_use);
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -357,6 +357,53 @@ TEST_F(SHMRingBuffer, listeners_register_unregister)
     listener2->pop();
 }
 
+TEST_F(SHMRingBuffer, batch_push_pop)
+{
+    auto listener1 = ring_buffer_->register_listener();
+    auto listener2 = ring_buffer_->register_listener();
+
+    std::vector<MyData> data(buffer_size_);
+    std::vector<MyData> popped(buffer_size_);
+    std::unique_ptr<bool[]> freed(new bool[buffer_size_]);
+
+    uint32_t w = 0;
+    uint32_t r = 0;
+    uint32_t batch = buffer_size_ - 1;
+
+    // Batches not aligned with the buffer size, so they go around the end of the buffer
+    for (uint32_t loop = 0; loop < 3; loop++)
+    {
+        for (uint32_t i = 0; i < batch; i++)
+        {
+            data[i] = {0, w++};
+        }
+        ASSERT_TRUE(ring_buffer_->push(data.data(), batch));
+
+        // No room for the whole batch, so nothing is pushed
+        ASSERT_THROW(ring_buffer_->push(data.data(), batch), std::exception);
+
+        ASSERT_EQ(listener1->pop(popped.data(), freed.get(), buffer_size_), batch);
+        for (uint32_t i = 0; i < batch; i++)
+        {
+            EXPECT_EQ(popped[i].counter, r + i);
+            EXPECT_FALSE(freed[i]);
+        }
+
+        // The cells are freed by the last listener popping them
+        ASSERT_EQ(listener2->pop(popped.data(), freed.get(), 2), 2u);
+        ASSERT_EQ(listener2->pop(popped.data() + 2, freed.get() + 2, buffer_size_), batch - 2);
+        for (uint32_t i = 0; i < batch; i++)
+        {
+            EXPECT_EQ(popped[i].counter, r + i);
+            EXPECT_TRUE(freed[i]);
+        }
+        r += batch;
+
+        ASSERT_TRUE(ring_buffer_->is_buffer_empty());
+        ASSERT_EQ(listener1->pop(popped.data(), freed.get(), buffer_size_), 0u);
+    }
+}
+
 TEST_F(SHMCondition, wait_notify)
 {
     SharedMemSegment::condition_variable cv;
@@ -765,6 +812,152 @@ TEST_F(SHMTransportTests, send_and_receive_between_ports)
     sender_thread->join();
 }
 
+TEST_F(SHMTransportTests, send_and_receive_with_busy_poll)
+{
+    SharedMemTransportDescriptor busy_poll_descriptor;
+    busy_poll_descriptor.busy_poll_budget_us(20000);
+
+    SharedMemTransport transportUnderTest(busy_poll_descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    Locator_t unicastLocator;
+    unicastLocator.kind = LOCATOR_KIND_SHM;
+    unicastLocator.port = g_default_port;
+
+    Locator_t outputChannelLocator;
+    outputChannelLocator.kind = LOCATOR_KIND_SHM;
+    outputChannelLocator.port = g_default_port + 1;
+
+    Semaphore sem;
+    MockReceiverResource receiver(transportUnderTest, unicastLocator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+
+    eprosima::fastrtps::rtps::SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, outputChannelLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+    ASSERT_TRUE(transportUnderTest.IsInputChannelOpen(unicastLocator));
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+
+    std::function<void()> recCallback = [&]()
+            {
+                EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+                sem.post();
+            };
+    msg_recv->setCallback(recCallback);
+
+    LocatorList locator_list;
+    locator_list.push_back(unicastLocator);
+
+    // Messages found while polling, and after the listener gave up polling and blocked on the port
+    for (auto delay : { std::chrono::milliseconds(1), std::chrono::milliseconds(50) })
+    {
+        std::this_thread::sleep_for(delay);
+
+        Locators locators_begin(locator_list.begin());
+        Locators locators_end(locator_list.end());
+        EXPECT_TRUE(send_resource_list.at(0)->send(message, 5, &locators_begin, &locators_end,
+                (std::chrono::steady_clock::now() + std::chrono::microseconds(100))));
+        sem.wait();
+    }
+}
+
+TEST_F(SHMTransportTests, send_and_receive_segmented)
+{
+    SharedMemTransport transportUnderTest(descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    Locator_t unicastLocator;
+    unicastLocator.kind = LOCATOR_KIND_SHM;
+    unicastLocator.port = g_default_port;
+
+    Locator_t outputChannelLocator;
+    outputChannelLocator.kind = LOCATOR_KIND_SHM;
+    outputChannelLocator.port = g_default_port + 1;
+
+    Semaphore sem;
+    MockReceiverResource receiver(transportUnderTest, unicastLocator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+
+    eprosima::fastrtps::rtps::SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, outputChannelLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+    ASSERT_TRUE(send_resource_list.at(0)->supports_gather_send(4));
+
+    // Three messages of 4 bytes and a shorter last one
+    octet message[14] = { 1, 'a', 'b', 'c', 2, 'd', 'e', 'f', 3, 'g', 'h', 'i', 4, 'j' };
+    std::vector<octet> received;
+
+    std::function<void()> recCallback = [&]()
+            {
+                received.push_back(msg_recv->data[0]);
+                sem.post();
+            };
+    msg_recv->setCallback(recCallback);
+
+    LocatorList locator_list;
+    locator_list.push_back(unicastLocator);
+
+    Locators locators_begin(locator_list.begin());
+    Locators locators_end(locator_list.end());
+    std::vector<NetworkBuffer> buffers;
+    buffers.emplace_back(message, sizeof(message));
+    EXPECT_TRUE(send_resource_list.at(0)->send_gather(buffers, sizeof(message), 4, &locators_begin,
+            &locators_end, (std::chrono::steady_clock::now() + std::chrono::microseconds(100))));
+
+    // Each message is received on its own, in order
+    for (int i = 0; i < 4; ++i)
+    {
+        sem.wait();
+    }
+    EXPECT_EQ(received, std::vector<octet>({ 1, 2, 3, 4 }));
+}
+
+TEST_F(SHMTransportTests, send_and_receive_with_huge_pages_on_local_numa_node)
+{
+    // The segment falls back to default pages and system placement when these are not available
+    SharedMemTransportDescriptor huge_pages_descriptor;
+    huge_pages_descriptor.huge_pages(true);
+    huge_pages_descriptor.numa_node(SharedMemTransportDescriptor::numa_node_local);
+    huge_pages_descriptor.segment_size(4 * 1024 * 1024);
+
+    SharedMemTransport transportUnderTest(huge_pages_descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    Locator_t unicastLocator;
+    unicastLocator.kind = LOCATOR_KIND_SHM;
+    unicastLocator.port = g_default_port;
+
+    Locator_t outputChannelLocator;
+    outputChannelLocator.kind = LOCATOR_KIND_SHM;
+    outputChannelLocator.port = g_default_port + 1;
+
+    Semaphore sem;
+    MockReceiverResource receiver(transportUnderTest, unicastLocator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+
+    eprosima::fastrtps::rtps::SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, outputChannelLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+    ASSERT_TRUE(transportUnderTest.IsInputChannelOpen(unicastLocator));
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+
+    std::function<void()> recCallback = [&]()
+            {
+                EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+                sem.post();
+            };
+    msg_recv->setCallback(recCallback);
+
+    LocatorList locator_list;
+    locator_list.push_back(unicastLocator);
+
+    Locators locators_begin(locator_list.begin());
+    Locators locators_end(locator_list.end());
+    EXPECT_TRUE(send_resource_list.at(0)->send(message, 5, &locators_begin, &locators_end,
+            (std::chrono::steady_clock::now() + std::chrono::microseconds(100))));
+    sem.wait();
+}
+
 TEST_F(SHMTransportTests, port_and_segment_overflow_discard)
 {
     SharedMemTransportDescriptor my_descriptor;
@@ -856,6 +1049,71 @@ TEST_F(SHMTransportTests, port_and_segment_overflow_discard)
     sem.disable();
 }
 
+TEST_F(SHMTransportTests, segment_growth_keeps_enqueued_buffers)
+{
+    SharedMemTransportDescriptor my_descriptor;
+
+    // Room for two messages on each segment of the chain
+    my_descriptor.segment_size(1024);
+    my_descriptor.max_segment_size(8 * 1024);
+    my_descriptor.max_message_size(512);
+    my_descriptor.port_queue_capacity(16);
+
+    SharedMemTransport transportUnderTest(my_descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    Locator_t unicastLocator;
+    unicastLocator.kind = LOCATOR_KIND_SHM;
+    unicastLocator.port = g_default_port;
+
+    Semaphore sem;
+    MockReceiverResource receiver(transportUnderTest, unicastLocator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+
+    // The receiver is blocked on the first message, so the rest of the burst stays enqueued
+    std::atomic<uint32_t> received(0u);
+    std::function<void()> recCallback = [&]()
+            {
+                if (0u == received.fetch_add(1u))
+                {
+                    sem.wait();
+                }
+            };
+    msg_recv->setCallback(recCallback);
+
+    Locator_t outputChannelLocator;
+    outputChannelLocator.kind = LOCATOR_KIND_SHM;
+    outputChannelLocator.port = g_default_port + 1;
+
+    eprosima::fastrtps::rtps::SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, outputChannelLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    LocatorList locator_list;
+    locator_list.push_back(unicastLocator);
+
+    constexpr uint32_t burst = 12u;
+    octet message[512] = { 'H', 'e', 'l', 'l', 'o' };
+    for (uint32_t i = 0; i < burst; i++)
+    {
+        Locators locators_begin(locator_list.begin());
+        Locators locators_end(locator_list.end());
+        EXPECT_TRUE(send_resource_list.at(0)->send(message, sizeof(message), &locators_begin, &locators_end,
+                (std::chrono::steady_clock::now() + std::chrono::microseconds(100))));
+    }
+
+    sem.post();
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (received.load() < burst && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // No buffer was invalidated to make room for the burst
+    EXPECT_EQ(received.load(), burst);
+}
+
 TEST_F(SHMTransportTests, port_mutex_deadlock_recover)
 {
     auto shared_mem_manager = SharedMemManager::create(domain_name);
@@ -1246,6 +1504,60 @@ TEST_F(SHMTransportTests, port_listener_dead_recover)
     thread_listener1.join();
 }
 
+TEST_F(SHMTransportTests, sleeping_listeners_woken_on_push)
+{
+    auto shared_mem_manager = SharedMemManager::create(domain_name);
+    auto segment = shared_mem_manager->create_segment(1024, 16);
+
+    // Sleeping listeners only wake up on their own every third of this timeout
+    constexpr uint32_t healthy_check_timeout_ms = 30000u;
+
+    shared_mem_manager->remove_port(1);
+    auto port_writer = shared_mem_manager->open_port(1, 8, healthy_check_timeout_ms,
+                    SharedMemGlobal::Port::OpenMode::Write);
+    auto port_reader = shared_mem_manager->open_port(1, 8, healthy_check_timeout_ms,
+                    SharedMemGlobal::Port::OpenMode::ReadShared);
+
+    std::vector<std::shared_ptr<SharedMemManager::Listener>> listeners;
+    listeners.push_back(port_reader->create_listener());
+    listeners.push_back(port_reader->create_listener());
+
+    std::atomic<uint32_t> received(0u);
+    std::vector<std::thread> threads;
+    for (auto& listener : listeners)
+    {
+        threads.emplace_back([&received, listener]()
+                {
+                    auto buffer = listener->pop();
+                    if (buffer && *static_cast<uint8_t*>(buffer->data()) == 7u)
+                    {
+                        received.fetch_add(1u);
+                    }
+                });
+    }
+
+    // Let the listeners go to sleep on the port
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    auto start = std::chrono::steady_clock::now();
+    {
+        auto buf = segment->alloc_buffer(1, std::chrono::steady_clock::now() + std::chrono::milliseconds(100));
+        ASSERT_TRUE(buf != nullptr);
+        *static_cast<uint8_t*>(buf->data()) = 7u;
+        bool is_port_ok = false;
+        ASSERT_TRUE(port_writer->try_push(buf, is_port_ok));
+        ASSERT_TRUE(is_port_ok);
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(received.load(), 2u);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(healthy_check_timeout_ms / 6));
+}
+
 TEST_F(SHMTransportTests, empty_cv_mutex_deadlocked_try_push)
 {
     auto shared_mem_manager = SharedMemManager::create(domain_name);
@@ -1548,6 +1860,153 @@ TEST_F(SHMTransportTests, buffer_recover)
     thread_listener2.join();
 }
 
+TEST_F(SHMTransportTests, port_batch_push_pop)
+{
+    auto shared_mem_manager = SharedMemManager::create(domain_name);
+
+    auto segment = shared_mem_manager->create_segment(1024, 16);
+
+    shared_mem_manager->remove_port(1);
+    auto port_write = shared_mem_manager->open_port(1, 8, 1000, SharedMemGlobal::Port::OpenMode::Write);
+    auto port_read = shared_mem_manager->open_port(1, 8, 1000, SharedMemGlobal::Port::OpenMode::ReadExclusive);
+
+    auto listener = port_read->create_listener();
+
+    std::vector<std::shared_ptr<SharedMemManager::Buffer>> buffers;
+    for (uint8_t i = 0; i < 6; i++)
+    {
+        buffers.push_back(segment->alloc_buffer(1, std::chrono::steady_clock::now() + std::chrono::milliseconds(100)));
+        *static_cast<uint8_t*>(buffers.back()->data()) = i;
+    }
+
+    bool is_port_ok = false;
+    ASSERT_TRUE(port_write->try_push(buffers, is_port_ok));
+    ASSERT_TRUE(is_port_ok);
+
+    // No room on the port for all the buffers, so none of them is enqueued
+    ASSERT_FALSE(port_write->try_push(buffers, is_port_ok));
+    ASSERT_TRUE(is_port_ok);
+
+    // The enqueued buffers are kept valid by the port
+    buffers.clear();
+
+    for (uint8_t i = 0; i < 6; i++)
+    {
+        auto buffer = listener->pop();
+        ASSERT_TRUE(buffer);
+        EXPECT_EQ(*static_cast<uint8_t*>(buffer->data()), i);
+    }
+}
+
+TEST_F(SHMTransportTests, popped_descriptors_recoverable)
+{
+    auto shared_mem_manager = SharedMemManager::create(domain_name);
+    SharedMemGlobal* shared_mem_global = shared_mem_manager->global_segment();
+
+    shared_mem_manager->remove_port(1);
+    uint32_t listener_index;
+    auto global_port = shared_mem_global->open_port(1, 8, 1000);
+    auto listener = global_port->create_listener(&listener_index);
+
+    SharedMemSegment::Id segment_id;
+    segment_id.generate();
+    std::vector<SharedMemGlobal::BufferDescriptor> pushed;
+    for (uint32_t i = 1; i <= 3; i++)
+    {
+        pushed.push_back({segment_id, 0, i});
+    }
+
+    bool listeners_active = false;
+    ASSERT_TRUE(global_port->try_push(pushed.data(), static_cast<uint32_t>(pushed.size()), &listeners_active));
+    ASSERT_TRUE(listeners_active);
+
+    SharedMemGlobal::BufferDescriptor popped[SharedMemGlobal::PortNode::LISTENER_POP_BATCH_SIZE];
+    bool cells_freed[SharedMemGlobal::PortNode::LISTENER_POP_BATCH_SIZE];
+    ASSERT_EQ(global_port->pop(*listener, listener_index, popped, cells_freed,
+            SharedMemGlobal::PortNode::LISTENER_POP_BATCH_SIZE), 3u);
+
+    // The first one is handed out, so only the other two are recovered
+    global_port->listener_processing_start(listener_index, popped[0], 1);
+
+    SharedMemGlobal::BufferDescriptor recovered;
+    ASSERT_TRUE(global_port->get_and_remove_blocked_popped(recovered));
+    EXPECT_EQ(recovered.validity_id, 2u);
+    ASSERT_TRUE(global_port->get_and_remove_blocked_popped(recovered));
+    EXPECT_EQ(recovered.validity_id, 3u);
+    EXPECT_FALSE(global_port->get_and_remove_blocked_popped(recovered));
+
+    global_port->unregister_listener(&listener, listener_index);
+}
+
+TEST_F(SHMTransportTests, concurrent_buffer_allocation)
+{
+    auto shared_mem_manager = SharedMemManager::create(domain_name);
+
+    constexpr uint32_t writers = 4u;
+    constexpr uint32_t live_buffers = 4u;
+    constexpr uint32_t allocations = 2000u;
+
+    // Room for twice the live buffers, so the segment fragmentation never makes an allocation fail
+    auto segment = shared_mem_manager->create_segment(2 * writers * live_buffers * 1024u, writers * live_buffers);
+
+    std::atomic<uint32_t> failures(0u);
+    std::vector<std::thread> threads;
+    for (uint32_t w = 0; w < writers; ++w)
+    {
+        threads.emplace_back([&, w]()
+                {
+                    std::vector<std::shared_ptr<SharedMemManager::Buffer>> buffers(live_buffers);
+                    std::vector<uint8_t> patterns(live_buffers);
+                    for (uint32_t i = 0; i < allocations; ++i)
+                    {
+                        uint32_t slot = i % live_buffers;
+
+                        // The oldest buffer should keep what was written on it
+                        auto& buffer = buffers[slot];
+                        if (buffer)
+                        {
+                            const uint8_t* data = static_cast<const uint8_t*>(buffer->data());
+                            for (uint32_t b = 0; b < buffer->size(); ++b)
+                            {
+                                if (data[b] != patterns[slot])
+                                {
+                                    failures.fetch_add(1u);
+                                    break;
+                                }
+                            }
+                            buffer.reset();
+                        }
+
+                        uint32_t size = 1u + ((i * 37u + w * 101u) % 700u);
+                        try
+                        {
+                            buffer = segment->alloc_buffer(size,
+                                            std::chrono::steady_clock::now() + std::chrono::milliseconds(100));
+                        }
+                        catch (const std::exception&)
+                        {
+                            failures.fetch_add(1u);
+                            continue;
+                        }
+
+                        if (buffer->size() != size)
+                        {
+                            failures.fetch_add(1u);
+                        }
+                        patterns[slot] = static_cast<uint8_t>(w * 64u + i);
+                        memset(buffer->data(), patterns[slot], size);
+                    }
+                });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(failures.load(), 0u);
+}
+
 TEST_F(SHMTransportTests, remote_segments_free)
 {
     uint32_t num_participants = 100;
@@ -12,8 +12,14 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <condition_variable>
+#include <cstring>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include <asio.hpp>
 #include <gtest/gtest.h>
@@ -164,19 +170,43 @@ TEST_F(TCPv4Tests, opening_and_closing_input_channel)
     ASSERT_FALSE (transportUnderTest.CloseInputChannel(genericInputChannelLocator));
 }
 
+//! Configuration of the transports on each run of the send_and_receive_between_ports test
+struct TCPv4SendReceiveParams
+{
+    //! Size of the messages sent
+    uint32_t message_size;
+    //! reactor_threads of both transports
+    uint32_t reactor_threads;
+    //! send_queue_size of the sending transport
+    uint32_t send_queue_size;
+    //! connection_streams of the sending transport
+    uint32_t connection_streams;
+};
+
+class TCPv4SendReceiveTests : public TCPv4Tests, public ::testing::WithParamInterface<TCPv4SendReceiveParams>
+{
+};
+
 #ifndef __APPLE__
-TEST_F(TCPv4Tests, send_and_receive_between_ports)
+TEST_P(TCPv4SendReceiveTests, send_and_receive_between_ports)
 {
+    const size_t num_messages = 10;
+    const TCPv4SendReceiveParams& params = GetParam();
+
     eprosima::fastdds::dds::Log::SetVerbosity(eprosima::fastdds::dds::Log::Kind::Info);
     std::regex filter("RTCP(?!_SEQ)");
     eprosima::fastdds::dds::Log::SetCategoryFilter(filter);
     TCPv4TransportDescriptor recvDescriptor;
     recvDescriptor.add_listener_port(g_default_port);
-    TCPv4Transport receiveTransportUnderTest(recvDescriptor);
+    recvDescriptor.reactor_threads = params.reactor_threads;
+    MockTCPv4Transport receiveTransportUnderTest(recvDescriptor);
     receiveTransportUnderTest.init();
 
     TCPv4TransportDescriptor sendDescriptor;
-    TCPv4Transport sendTransportUnderTest(sendDescriptor);
+    sendDescriptor.reactor_threads = params.reactor_threads;
+    sendDescriptor.send_queue_size = params.send_queue_size;
+    sendDescriptor.connection_streams = params.connection_streams;
+    MockTCPv4Transport sendTransportUnderTest(sendDescriptor);
     sendTransportUnderTest.init();
 
     Locator_t inputLocator;
@@ -201,37 +231,331 @@ TEST_F(TCPv4Tests, send_and_receive_between_ports)
     SendResourceList send_resource_list;
     ASSERT_TRUE(sendTransportUnderTest.OpenOutputChannel(send_resource_list, outputLocator));
     ASSERT_FALSE(send_resource_list.empty());
-    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+
+    std::shared_ptr<TCPChannelResource> stream;
+    Locator_t physicalLocator = IPLocator::toPhysicalLocator(outputLocator);
+    if (1 < params.connection_streams)
+    {
+        // One additional connection has been opened
+        ASSERT_EQ(1u, sendTransportUnderTest.get_stream_channel_resources().count(physicalLocator));
+        stream = sendTransportUnderTest.get_stream_channel_resources().at(physicalLocator).at(0);
+    }
+
+    std::vector<octet> message(params.message_size);
+    for (size_t i = 0; i < message.size(); ++i)
+    {
+        message[i] = static_cast<octet>(i);
+    }
 
     Semaphore sem;
     std::function<void()> recCallback = [&]()
             {
-                EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+                EXPECT_EQ(memcmp(message.data(), msg_recv->data, message.size()), 0);
                 sem.post();
             };
 
     msg_recv->setCallback(recCallback);
 
-    auto sendThreadFunction = [&]()
+    for (size_t n = 0; n < num_messages; ++n)
+    {
+        bool sent = false;
+        while (!sent)
+        {
+            Locators input_begin(locator_list.begin());
+            Locators input_end(locator_list.end());
+
+            sent =
+                    send_resource_list.at(0)->send(message.data(), params.message_size, &input_begin, &input_end,
+                            (std::chrono::steady_clock::now() + std::chrono::microseconds(100)));
+            if (!sent)
             {
-                bool sent = false;
-                while (!sent)
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
+        }
+        sem.wait();
+    }
+
+    if (stream)
+    {
+        // The additional connection gets established on its own
+        for (size_t i = 0; i < 50 && !stream->connection_established(); ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+        EXPECT_TRUE(stream->connection_established());
+    }
+}
+
+#ifdef INSTANTIATE_TEST_SUITE_P
+#define GTEST_INSTANTIATE_TEST_MACRO(x, y, z, w) INSTANTIATE_TEST_SUITE_P(x, y, z, w)
+#else
+#define GTEST_INSTANTIATE_TEST_MACRO(x, y, z, w) INSTANTIATE_TEST_CASE_P(x, y, z, w)
+#endif // ifdef INSTANTIATE_TEST_SUITE_P
+
+GTEST_INSTANTIATE_TEST_MACRO(
+    TCPv4SendReceiveTests,
+    TCPv4SendReceiveTests,
+    ::testing::Values(
+        TCPv4SendReceiveParams{5, 0, 0, 1},
+        TCPv4SendReceiveParams{20000, 2, 0, 1},
+        TCPv4SendReceiveParams{20000, 0, 1024 * 1024, 1},
+        TCPv4SendReceiveParams{5, 0, 0, 2}),
+    [](const ::testing::TestParamInfo<TCPv4SendReceiveParams>& info)
+    {
+        const TCPv4SendReceiveParams& params = info.param;
+        return 0 < params.reactor_threads ? "reactor" :
+        0 < params.send_queue_size ? "send_queue" :
+        1 < params.connection_streams ? "streams" : "default";
+    });
+
+TEST_F(TCPv4Tests, send_queue_drops_messages_when_reader_is_stalled)
+{
+    const uint32_t message_size = 60000;
+    const uint32_t send_queue_size = 256 * 1024;
+    const uint32_t max_messages = 1000;
+
+    // Small socket buffers, so the send queue is used early
+    TCPv4TransportDescriptor recvDescriptor;
+    recvDescriptor.add_listener_port(g_default_port);
+    recvDescriptor.receiveBufferSize = 65536;
+    recvDescriptor.sendBufferSize = 65536;
+    TCPv4Transport receiveTransportUnderTest(recvDescriptor);
+    receiveTransportUnderTest.init();
+
+    TCPv4TransportDescriptor sendDescriptor;
+    sendDescriptor.receiveBufferSize = 65536;
+    sendDescriptor.sendBufferSize = 65536;
+    sendDescriptor.send_queue_size = send_queue_size;
+    TCPv4Transport sendTransportUnderTest(sendDescriptor);
+    sendTransportUnderTest.init();
+
+    Locator_t inputLocator;
+    inputLocator.kind = LOCATOR_KIND_TCPv4;
+    inputLocator.port = g_default_port;
+    IPLocator::setIPv4(inputLocator, 127, 0, 0, 1);
+    IPLocator::setLogicalPort(inputLocator, 7410);
+
+    LocatorList_t locator_list;
+    locator_list.push_back(inputLocator);
+
+    Locator_t outputLocator;
+    outputLocator.kind = LOCATOR_KIND_TCPv4;
+    IPLocator::setIPv4(outputLocator, 127, 0, 0, 1);
+    outputLocator.port = g_default_port;
+    IPLocator::setLogicalPort(outputLocator, 7410);
+
+    MockReceiverResource receiver(receiveTransportUnderTest, inputLocator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+    ASSERT_TRUE(receiveTransportUnderTest.IsInputChannelOpen(inputLocator));
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(sendTransportUnderTest.OpenOutputChannel(send_resource_list, outputLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    // The reader keeps the number of each message, and gets stuck on the first message while stalled
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool stalled = false;
+    std::vector<uint32_t> received;
+    std::function<void()> recCallback = [&]()
+            {
+                uint32_t number = 0;
+                memcpy(&number, msg_recv->data, sizeof(number));
+
+                std::unique_lock<std::mutex> lock(mtx);
+                received.push_back(number);
+                cv.notify_all();
+                cv.wait(lock, [&]()
+                        {
+                            return !stalled;
+                        });
+            };
+    msg_recv->setCallback(recCallback);
+
+    std::vector<octet> message(message_size, 0);
+    auto send_message = [&](uint32_t number) -> bool
+            {
+                memcpy(message.data(), &number, sizeof(number));
+                Locators input_begin(locator_list.begin());
+                Locators input_end(locator_list.end());
+                return send_resource_list.at(0)->send(message.data(), message_size, &input_begin, &input_end,
+                               (std::chrono::steady_clock::now() + std::chrono::microseconds(100)));
+            };
+
+    // Wait for the connection to be established
+    uint32_t number = 0;
+    while (!send_message(number))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        ASSERT_TRUE(cv.wait_for(lock, std::chrono::seconds(5), [&]()
                 {
-                    Locators input_begin(locator_list.begin());
-                    Locators input_end(locator_list.end());
+                    return 1u == received.size();
+                }));
+        stalled = true;
+    }
 
-                    sent =
-                            send_resource_list.at(0)->send(message, 5, &input_begin, &input_end,
-                                    (std::chrono::steady_clock::now() + std::chrono::microseconds(100)));
-                    std::this_thread::sleep_for(std::chrono::milliseconds(100));
-                }
-                EXPECT_TRUE(sent);
+    // Sends do not block while the reader is stalled: messages are queued until the queue is full,
+    // and then dropped.
+    std::vector<uint32_t> accepted(1, number);
+    bool dropped = false;
+    for (++number; number < max_messages && !dropped; ++number)
+    {
+        if (send_message(number))
+        {
+            accepted.push_back(number);
+        }
+        else
+        {
+            dropped = true;
+        }
+    }
+    EXPECT_TRUE(dropped);
+    EXPECT_LT(1u, accepted.size());
+
+    // Once the reader is back, every accepted message is received in order
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        stalled = false;
+        cv.notify_all();
+        EXPECT_TRUE(cv.wait_for(lock, std::chrono::seconds(10), [&]()
+                {
+                    return received.size() >= accepted.size();
+                }));
+        EXPECT_EQ(accepted, received);
+    }
+}
+
+TEST_F(TCPv4Tests, connection_streams_separate_writers_by_sample_size)
+{
+    TCPv4TransportDescriptor recvDescriptor;
+    recvDescriptor.add_listener_port(g_default_port);
+    MockTCPv4Transport receiveTransportUnderTest(recvDescriptor);
+    receiveTransportUnderTest.init();
+
+    TCPv4TransportDescriptor sendDescriptor;
+    sendDescriptor.connection_streams = 2;
+    MockTCPv4Transport sendTransportUnderTest(sendDescriptor);
+    sendTransportUnderTest.init();
+
+    Locator_t inputLocator;
+    inputLocator.kind = LOCATOR_KIND_TCPv4;
+    inputLocator.port = g_default_port;
+    IPLocator::setIPv4(inputLocator, 127, 0, 0, 1);
+    IPLocator::setLogicalPort(inputLocator, 7410);
+
+    LocatorList_t locator_list;
+    locator_list.push_back(inputLocator);
+
+    Locator_t outputLocator;
+    outputLocator.kind = LOCATOR_KIND_TCPv4;
+    IPLocator::setIPv4(outputLocator, 127, 0, 0, 1);
+    outputLocator.port = g_default_port;
+    IPLocator::setLogicalPort(outputLocator, 7410);
+
+    MockReceiverResource receiver(receiveTransportUnderTest, inputLocator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+    ASSERT_TRUE(receiveTransportUnderTest.IsInputChannelOpen(inputLocator));
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(sendTransportUnderTest.OpenOutputChannel(send_resource_list, outputLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    Locator_t physicalLocator = IPLocator::toPhysicalLocator(outputLocator);
+    ASSERT_EQ(1u, sendTransportUnderTest.get_stream_channel_resources().count(physicalLocator));
+    std::shared_ptr<TCPChannelResource> stream =
+            sendTransportUnderTest.get_stream_channel_resources().at(physicalLocator).at(0);
+
+    Semaphore sem;
+    msg_recv->setCallback([&]()
+            {
+                sem.post();
+            });
+
+    // RTPS messages with a little endian HEARTBEAT or DATA of the given writer
+    const octet small_writer[] = {0x00, 0x00, 0x01, 0x02};
+    const octet bulk_writer[] = {0x00, 0x00, 0x02, 0x02};
+    const octet builtin_writer[] = {0x00, 0x01, 0x00, 0xC2};
+    auto heartbeat = [](const octet* writer_id) -> std::vector<octet>
+            {
+                std::vector<octet> message = {'R', 'T', 'P', 'S', 2, 3, 1, 15};
+                message.resize(20, 1);
+                message.insert(message.end(), {0x07, 0x01, 28, 0, 0, 0, 0, 0});
+                message.insert(message.end(), writer_id, writer_id + 4);
+                message.resize(message.size() + 20, 0);
+                return message;
+            };
+    auto data = [](const octet* writer_id, uint16_t payload_size) -> std::vector<octet>
+            {
+                std::vector<octet> message = {'R', 'T', 'P', 'S', 2, 3, 1, 15};
+                message.resize(20, 1);
+                uint16_t length = static_cast<uint16_t>(20 + payload_size);
+                message.insert(message.end(), {0x15, 0x05, static_cast<octet>(length & 0xFF),
+                                               static_cast<octet>(length >> 8), 0, 0, 16, 0, 0, 0, 0, 0});
+                message.insert(message.end(), writer_id, writer_id + 4);
+                message.resize(message.size() + 8 + payload_size, 0);
+                return message;
+            };
+    auto send_message = [&](const std::vector<octet>& message) -> bool
+            {
+                Locators input_begin(locator_list.begin());
+                Locators input_end(locator_list.end());
+                return send_resource_list.at(0)->send(message.data(), static_cast<uint32_t>(message.size()),
+                               &input_begin, &input_end,
+                               (std::chrono::steady_clock::now() + std::chrono::microseconds(100)));
+            };
+    auto writer_streams = [&]() -> std::map<std::pair<uint32_t, uint16_t>, std::shared_ptr<TCPChannelResource>>
+            {
+                const auto& writers = sendTransportUnderTest.get_writer_stream_channel_resources();
+                auto locator_writers = writers.find(physicalLocator);
+                return locator_writers == writers.end() ?
+                       std::map<std::pair<uint32_t, uint16_t>, std::shared_ptr<TCPChannelResource>>() :
+                       locator_writers->second;
             };
 
-    senderThread.reset(new std::thread(sendThreadFunction));
-    std::this_thread::sleep_for(std::chrono::milliseconds(1));
-    senderThread->join();
+    // Builtin writers use the main connection
+    std::vector<octet> builtin_message = heartbeat(builtin_writer);
+    while (!send_message(builtin_message))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
     sem.wait();
+    EXPECT_TRUE(writer_streams().empty());
+
+    for (size_t i = 0; i < 50 && !stream->is_logical_port_opened(7410); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    ASSERT_TRUE(stream->is_logical_port_opened(7410));
+
+    // A user writer that has not sent any sample yet uses the main connection without being assigned to it
+    ASSERT_TRUE(send_message(heartbeat(small_writer)));
+    sem.wait();
+    EXPECT_TRUE(writer_streams().empty());
+
+    // A writer of small samples is assigned to the main connection
+    ASSERT_TRUE(send_message(data(small_writer, 64)));
+    sem.wait();
+    ASSERT_EQ(1u, writer_streams().size());
+    EXPECT_EQ(nullptr, writer_streams().begin()->second);
+
+    // A writer of big samples is assigned to the additional connection and keeps using it
+    std::vector<octet> bulk_message = data(bulk_writer, 10000);
+    for (size_t n = 0; n < 3; ++n)
+    {
+        ASSERT_TRUE(send_message(bulk_message));
+        sem.wait();
+
+        auto writers = writer_streams();
+        ASSERT_EQ(2u, writers.size());
+        uint32_t bulk_writer_id = 0;
+        memcpy(&bulk_writer_id, bulk_writer, sizeof(bulk_writer_id));
+        auto writer = writers.find(std::make_pair(bulk_writer_id, static_cast<uint16_t>(7410)));
+        ASSERT_NE(writers.end(), writer);
+        EXPECT_EQ(stream, writer->second);
+    }
 }
 #endif // ifndef __APPLE__
 
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <memory>
+#include <set>
 #include <thread>
 
 #include <asio.hpp>
@@ -25,10 +26,14 @@
 
 #include <MockReceiverResource.h>
 #include <rtps/transport/UDPv4Transport.h>
+#include <rtps/transport/uring/UDPv4UringTransport.h>
 
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
 using UDPv4Transport = eprosima::fastdds::rtps::UDPv4Transport;
+using UDPv4UringTransport = eprosima::fastdds::rtps::UDPv4UringTransport;
+using UDPv4UringTransportDescriptor = eprosima::fastdds::rtps::UDPv4UringTransportDescriptor;
+using NetworkBuffer = eprosima::fastdds::rtps::NetworkBuffer;
 
 #ifndef __APPLE__
 const uint32_t ReceiveBufferCapacity = 65536;
@@ -704,6 +709,637 @@ TEST_F(UDPv4Tests, simple_throughput)
             , std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count() / (num_samples_per_batch * 1000.0));
 }
 
+#if defined(__linux__)
+TEST_F(UDPv4Tests, send_and_receive_with_batched_receive)
+{
+    const int num_messages = 100;
+
+    UDPv4TransportDescriptor batch_descriptor;
+    batch_descriptor.receive_batch_size = 16;
+
+    UDPv4Transport transportUnderTest(batch_descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    Locator_t unicastLocator;
+    unicastLocator.kind = LOCATOR_KIND_UDPv4;
+    unicastLocator.port = g_default_port;
+    IPLocator::setIPv4(unicastLocator, 127, 0, 0, 1);
+
+    MockReceiverResource receiver(transportUnderTest, unicastLocator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+    ASSERT_TRUE(transportUnderTest.IsInputChannelOpen(unicastLocator));
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, unicastLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+
+    std::atomic<int> messages_received(0);
+    Semaphore sem;
+    std::function<void()> recCallback = [&]()
+            {
+                EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+                if (num_messages == messages_received.fetch_add(1) + 1)
+                {
+                    sem.post();
+                }
+            };
+
+    msg_recv->setCallback(recCallback);
+
+    LocatorList_t locator_list;
+    locator_list.push_back(unicastLocator);
+
+    // Burst of messages, so several of them are retrieved on each receive operation
+    for (int i = 0; i < num_messages; ++i)
+    {
+        Locators locators_begin(locator_list.begin());
+        Locators locators_end(locator_list.end());
+        EXPECT_TRUE(send_resource_list.at(0)->send(message, 5, &locators_begin, &locators_end,
+                (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+    }
+
+    sem.wait();
+    EXPECT_EQ(num_messages, messages_received.load());
+}
+
+TEST_F(UDPv4Tests, send_and_receive_with_receive_shards)
+{
+    const int num_messages = 100;
+
+    UDPv4TransportDescriptor shards_descriptor;
+    shards_descriptor.receive_shards = 2;
+
+    UDPv4Transport transportUnderTest(shards_descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    Locator_t unicastLocator;
+    unicastLocator.kind = LOCATOR_KIND_UDPv4;
+    unicastLocator.port = g_default_port;
+    IPLocator::setIPv4(unicastLocator, 127, 0, 0, 1);
+    ASSERT_EQ(2u, transportUnderTest.input_channel_shards(unicastLocator));
+
+    // One receiver per shard can be attached to the channel
+    MockReceiverResource receiver_1(transportUnderTest, unicastLocator);
+    ASSERT_TRUE(receiver_1.is_valid());
+    MockReceiverResource receiver_2(transportUnderTest, unicastLocator);
+    ASSERT_TRUE(receiver_2.is_valid());
+    MockReceiverResource receiver_3(transportUnderTest, unicastLocator);
+    ASSERT_FALSE(receiver_3.is_valid());
+
+    // Sockets of other transports are not allowed to join the port
+    UDPv4Transport other_transport(descriptor);
+    ASSERT_TRUE(other_transport.init());
+    MockReceiverResource other_receiver(other_transport, unicastLocator);
+    ASSERT_FALSE(other_receiver.is_valid());
+
+    // Not even when they shard their input channels too, as the first socket of a port is bound exclusively
+    UDPv4Transport other_shards_transport(shards_descriptor);
+    ASSERT_TRUE(other_shards_transport.init());
+    MockReceiverResource other_shards_receiver(other_shards_transport, unicastLocator);
+    ASSERT_FALSE(other_shards_receiver.is_valid());
+
+    MockMessageReceiver* msg_recv_1 = dynamic_cast<MockMessageReceiver*>(receiver_1.CreateMessageReceiver());
+    MockMessageReceiver* msg_recv_2 = dynamic_cast<MockMessageReceiver*>(receiver_2.CreateMessageReceiver());
+
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+
+    std::atomic<int> messages_received(0);
+    Semaphore sem;
+    auto make_callback = [&](MockMessageReceiver* msg_recv)
+            {
+                return [&, msg_recv]()
+                       {
+                           EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+                           if (num_messages == messages_received.fetch_add(1) + 1)
+                           {
+                               sem.post();
+                           }
+                       };
+            };
+
+    msg_recv_1->setCallback(make_callback(msg_recv_1));
+    msg_recv_2->setCallback(make_callback(msg_recv_2));
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(other_transport.OpenOutputChannel(send_resource_list, unicastLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    LocatorList_t locator_list;
+    locator_list.push_back(unicastLocator);
+
+    for (int i = 0; i < num_messages; ++i)
+    {
+        Locators locators_begin(locator_list.begin());
+        Locators locators_end(locator_list.end());
+        EXPECT_TRUE(send_resource_list.at(0)->send(message, 5, &locators_begin, &locators_end,
+                (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+    }
+
+    sem.wait();
+    EXPECT_EQ(num_messages, messages_received.load());
+
+    // Closing a shard leaves the rest of the channel receiving
+    ASSERT_TRUE(transportUnderTest.close_input_channel_shard(unicastLocator, &receiver_2));
+    ASSERT_TRUE(transportUnderTest.IsInputChannelOpen(unicastLocator));
+    messages_received = 0;
+
+    for (int i = 0; i < num_messages; ++i)
+    {
+        Locators locators_begin(locator_list.begin());
+        Locators locators_end(locator_list.end());
+        EXPECT_TRUE(send_resource_list.at(0)->send(message, 5, &locators_begin, &locators_end,
+                (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+    }
+
+    sem.wait();
+    EXPECT_EQ(num_messages, messages_received.load());
+
+    ASSERT_TRUE(transportUnderTest.close_input_channel_shard(unicastLocator, &receiver_1));
+    EXPECT_FALSE(transportUnderTest.IsInputChannelOpen(unicastLocator));
+}
+
+#endif // if defined(__linux__)
+
+#if defined(FASTDDS_UDP_SEGMENTATION_OFFLOAD)
+TEST_F(UDPv4Tests, send_and_receive_with_segmentation_offload)
+{
+    const uint32_t segment_size = 1000;
+    const uint32_t num_segments = 10;
+
+    UDPv4TransportDescriptor gso_descriptor;
+    gso_descriptor.segmentation_offload = true;
+
+    UDPv4Transport transportUnderTest(gso_descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    Locator_t unicastLocator;
+    unicastLocator.kind = LOCATOR_KIND_UDPv4;
+    unicastLocator.port = g_default_port;
+    IPLocator::setIPv4(unicastLocator, 127, 0, 0, 1);
+
+    MockReceiverResource receiver(transportUnderTest, unicastLocator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+    ASSERT_TRUE(transportUnderTest.IsInputChannelOpen(unicastLocator));
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, unicastLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+    ASSERT_TRUE(send_resource_list.at(0)->supports_gather_send(segment_size));
+
+    // Each segment starts with its own index
+    std::vector<octet> buffer(segment_size * num_segments, 0);
+    for (uint32_t i = 0; i < num_segments; ++i)
+    {
+        buffer[i * segment_size] = static_cast<octet>(i);
+    }
+
+    std::atomic<uint32_t> segments_received(0);
+    Semaphore sem;
+    std::function<void()> recCallback = [&]()
+            {
+                // Segments are received in order and split with their original size
+                EXPECT_EQ(segments_received.load(), static_cast<uint32_t>(msg_recv->data[0]));
+                if (num_segments == segments_received.fetch_add(1) + 1)
+                {
+                    sem.post();
+                }
+            };
+
+    msg_recv->setCallback(recCallback);
+
+    LocatorList_t locator_list;
+    locator_list.push_back(unicastLocator);
+    Locators locators_begin(locator_list.begin());
+    Locators locators_end(locator_list.end());
+    std::vector<NetworkBuffer> buffers;
+    buffers.emplace_back(buffer.data(), static_cast<uint32_t>(buffer.size()));
+    EXPECT_TRUE(send_resource_list.at(0)->send_gather(buffers, static_cast<uint32_t>(buffer.size()),
+            segment_size, &locators_begin, &locators_end,
+            (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+
+    sem.wait();
+    EXPECT_EQ(num_segments, segments_received.load());
+}
+
+#endif // if defined(FASTDDS_UDP_SEGMENTATION_OFFLOAD)
+
+#if defined(FASTDDS_UDP_ZERO_COPY)
+TEST_F(UDPv4Tests, send_and_receive_with_zero_copy)
+{
+    const size_t num_destinations = 2;
+
+    UDPv4TransportDescriptor zero_copy_descriptor;
+    zero_copy_descriptor.zero_copy_send_threshold = 1024;
+
+    UDPv4Transport transportUnderTest(zero_copy_descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    std::vector<octet> message(10000);
+    for (size_t i = 0; i < message.size(); ++i)
+    {
+        message[i] = static_cast<octet>(i);
+    }
+
+    LocatorList_t locator_list;
+    std::vector<std::unique_ptr<MockReceiverResource>> receivers;
+    std::atomic<size_t> messages_received(0);
+    Semaphore sem;
+    for (size_t i = 0; i < num_destinations; ++i)
+    {
+        Locator_t unicastLocator;
+        unicastLocator.kind = LOCATOR_KIND_UDPv4;
+        unicastLocator.port = static_cast<uint16_t>(g_default_port + i);
+        IPLocator::setIPv4(unicastLocator, 127, 0, 0, 1);
+        locator_list.push_back(unicastLocator);
+
+        receivers.emplace_back(new MockReceiverResource(transportUnderTest, unicastLocator));
+        MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receivers.back()->CreateMessageReceiver());
+        msg_recv->setCallback([&, msg_recv]()
+                {
+                    EXPECT_EQ(memcmp(message.data(), msg_recv->data, message.size()), 0);
+                    messages_received.fetch_add(1);
+                    sem.post();
+                });
+    }
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, *locator_list.begin()));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    // Several destinations
+    {
+        Locators locators_begin(locator_list.begin());
+        Locators locators_end(locator_list.end());
+        EXPECT_TRUE(send_resource_list.at(0)->send(message.data(), static_cast<uint32_t>(message.size()),
+                &locators_begin, &locators_end, (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+        // Sends only return once the kernel has released the buffer
+        EXPECT_EQ(num_destinations, transportUnderTest.zero_copy_completed_sends());
+        for (size_t i = 0; i < num_destinations; ++i)
+        {
+            sem.wait();
+        }
+    }
+
+    // Single destination
+    {
+        LocatorList_t single_locator_list;
+        single_locator_list.push_back(*locator_list.begin());
+        Locators locators_begin(single_locator_list.begin());
+        Locators locators_end(single_locator_list.end());
+        EXPECT_TRUE(send_resource_list.at(0)->send(message.data(), static_cast<uint32_t>(message.size()),
+                &locators_begin, &locators_end, (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+        EXPECT_EQ(num_destinations + 1, transportUnderTest.zero_copy_completed_sends());
+        sem.wait();
+    }
+
+    EXPECT_EQ(num_destinations + 1, messages_received.load());
+}
+
+#endif // if defined(FASTDDS_UDP_ZERO_COPY)
+
+TEST_F(UDPv4Tests, send_and_receive_with_busy_poll)
+{
+    UDPv4TransportDescriptor busy_poll_descriptor;
+    busy_poll_descriptor.busy_poll_budget_us = 20000;
+
+    UDPv4Transport transportUnderTest(busy_poll_descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    Locator_t unicastLocator;
+    unicastLocator.kind = LOCATOR_KIND_UDPv4;
+    unicastLocator.port = g_default_port;
+    IPLocator::setIPv4(unicastLocator, 127, 0, 0, 1);
+
+    MockReceiverResource receiver(transportUnderTest, unicastLocator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+    ASSERT_TRUE(transportUnderTest.IsInputChannelOpen(unicastLocator));
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, unicastLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+
+    Semaphore sem;
+    std::function<void()> recCallback = [&]()
+            {
+                EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+                sem.post();
+            };
+    msg_recv->setCallback(recCallback);
+
+    LocatorList_t locator_list;
+    locator_list.push_back(unicastLocator);
+
+    // Messages found while polling, and after the listener gave up polling and blocked on the socket
+    for (auto delay : { std::chrono::milliseconds(1), std::chrono::milliseconds(50) })
+    {
+        std::this_thread::sleep_for(delay);
+
+        Locators locators_begin(locator_list.begin());
+        Locators locators_end(locator_list.end());
+        EXPECT_TRUE(send_resource_list.at(0)->send(message, 5, &locators_begin, &locators_end,
+                (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+        sem.wait();
+    }
+}
+
+TEST_F(UDPv4Tests, send_and_receive_with_receive_timestamps)
+{
+    using RTPSTime = eprosima::fastrtps::rtps::Time_t;
+
+    class TimestampReceiver : public eprosima::fastdds::rtps::TransportReceiverInterface
+    {
+    public:
+
+        void OnDataReceived(
+                const octet*,
+                const uint32_t,
+                const Locator_t&,
+                const Locator_t&) override
+        {
+            sem.post();
+        }
+
+        void OnTimestampedDataReceived(
+                const octet*,
+                const uint32_t,
+                const Locator_t&,
+                const Locator_t&,
+                const RTPSTime& reception_timestamp) override
+        {
+            timestamp = reception_timestamp;
+            sem.post();
+        }
+
+        RTPSTime timestamp;
+        Semaphore sem;
+    };
+
+    // Outlives the transport, which stops the listening threads on destruction
+    TimestampReceiver receiver;
+
+    UDPv4TransportDescriptor timestamps_descriptor;
+    timestamps_descriptor.receive_timestamps = true;
+
+    UDPv4Transport transportUnderTest(timestamps_descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    Locator_t unicastLocator;
+    unicastLocator.kind = LOCATOR_KIND_UDPv4;
+    unicastLocator.port = g_default_port;
+    IPLocator::setIPv4(unicastLocator, 127, 0, 0, 1);
+
+    ASSERT_TRUE(transportUnderTest.OpenInputChannel(unicastLocator, &receiver, 0x8FFF));
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, unicastLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+    LocatorList_t locator_list;
+    locator_list.push_back(unicastLocator);
+    Locators locators_begin(locator_list.begin());
+    Locators locators_end(locator_list.end());
+
+    RTPSTime before;
+    RTPSTime::now(before);
+    EXPECT_TRUE(send_resource_list.at(0)->send(message, 5, &locators_begin, &locators_end,
+            (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+    receiver.sem.wait();
+    RTPSTime after;
+    RTPSTime::now(after);
+
+#if defined(FASTDDS_UDP_RECEIVE_TIMESTAMPS)
+    // Taken by the kernel, before the listening thread got the datagram
+    EXPECT_LE(before.to_ns(), receiver.timestamp.to_ns());
+    EXPECT_GE(after.to_ns(), receiver.timestamp.to_ns());
+#endif // if defined(FASTDDS_UDP_RECEIVE_TIMESTAMPS)
+}
+
+TEST_F(UDPv4Tests, send_and_receive_with_connected_sockets)
+{
+    const size_t num_messages = 50;
+
+    UDPv4TransportDescriptor connected_descriptor;
+    connected_descriptor.max_connected_sockets = 1;
+
+    UDPv4Transport transportUnderTest(connected_descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    // Two destinations competing for the connected socket, so it is moved from one to the other
+    LocatorList_t locator_list;
+    std::vector<std::unique_ptr<MockReceiverResource>> receivers;
+    std::atomic<size_t> messages_received(0);
+    Semaphore sem;
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+    std::set<uint32_t> source_ports;
+    for (uint16_t i = 0; i < 2; ++i)
+    {
+        Locator_t unicastLocator;
+        unicastLocator.kind = LOCATOR_KIND_UDPv4;
+        unicastLocator.port = static_cast<uint16_t>(g_default_port + i);
+        IPLocator::setIPv4(unicastLocator, 127, 0, 0, 1);
+        locator_list.push_back(unicastLocator);
+
+        receivers.emplace_back(new MockReceiverResource(transportUnderTest, unicastLocator));
+        MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receivers.back()->CreateMessageReceiver());
+        msg_recv->setCallback([&, msg_recv]()
+                {
+                    EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+                    source_ports.insert(msg_recv->remote_locator.port);
+                    messages_received.fetch_add(1);
+                    sem.post();
+                });
+    }
+
+    SendResourceList send_resource_list;
+    for (const Locator_t& locator : locator_list)
+    {
+        ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, locator));
+    }
+    ASSERT_FALSE(send_resource_list.empty());
+
+    for (const Locator_t& locator : locator_list)
+    {
+        LocatorList_t destination;
+        destination.push_back(locator);
+        for (size_t n = 0; n < num_messages; ++n)
+        {
+            Locators locators_begin(destination.begin());
+            Locators locators_end(destination.end());
+            EXPECT_TRUE(send_resource_list.at(0)->send(message, 5, &locators_begin, &locators_end,
+                    (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+            sem.wait();
+        }
+    }
+
+    EXPECT_EQ(2 * num_messages, messages_received.load());
+
+    // Connected or not, all the datagrams come from the port of the output channel
+    EXPECT_EQ(1u, source_ports.size());
+}
+
+TEST_F(UDPv4Tests, send_to_several_destinations)
+{
+    const size_t num_destinations = 4;
+
+    UDPv4Transport transportUnderTest(descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+
+    LocatorList_t locator_list;
+    std::vector<std::unique_ptr<MockReceiverResource>> receivers;
+    std::atomic<size_t> messages_received(0);
+    Semaphore sem;
+    for (size_t i = 0; i < num_destinations; ++i)
+    {
+        Locator_t unicastLocator;
+        unicastLocator.kind = LOCATOR_KIND_UDPv4;
+        unicastLocator.port = static_cast<uint16_t>(g_default_port + i);
+        IPLocator::setIPv4(unicastLocator, 127, 0, 0, 1);
+        locator_list.push_back(unicastLocator);
+
+        receivers.emplace_back(new MockReceiverResource(transportUnderTest, unicastLocator));
+        MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receivers.back()->CreateMessageReceiver());
+        msg_recv->setCallback([&, msg_recv]()
+                {
+                    EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+                    if (num_destinations == messages_received.fetch_add(1) + 1)
+                    {
+                        sem.post();
+                    }
+                });
+    }
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, *locator_list.begin()));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    // A single send call reaches all the destinations
+    Locators locators_begin(locator_list.begin());
+    Locators locators_end(locator_list.end());
+    EXPECT_TRUE(send_resource_list.at(0)->send(message, 5, &locators_begin, &locators_end,
+            (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+
+    sem.wait();
+    EXPECT_EQ(num_destinations, messages_received.load());
+}
+
+TEST_F(UDPv4Tests, send_gather_to_several_destinations)
+{
+    const size_t num_destinations = 4;
+
+    UDPv4Transport transportUnderTest(descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    // The message is given as several slices, and received as a single one
+    octet header[5] = { 'H', 'e', 'l', 'l', 'o' };
+    octet payload[1] = { ' ' };
+    octet tail[5] = { 'W', 'o', 'r', 'l', 'd' };
+    octet message[11] = { 'H', 'e', 'l', 'l', 'o', ' ', 'W', 'o', 'r', 'l', 'd' };
+    std::vector<NetworkBuffer> buffers;
+    buffers.emplace_back(header, 5);
+    buffers.emplace_back(payload, 1);
+    buffers.emplace_back(tail, 5);
+
+    LocatorList_t locator_list;
+    std::vector<std::unique_ptr<MockReceiverResource>> receivers;
+    std::atomic<size_t> messages_received(0);
+    Semaphore sem;
+    for (size_t i = 0; i < num_destinations; ++i)
+    {
+        Locator_t unicastLocator;
+        unicastLocator.kind = LOCATOR_KIND_UDPv4;
+        unicastLocator.port = static_cast<uint16_t>(g_default_port + i);
+        IPLocator::setIPv4(unicastLocator, 127, 0, 0, 1);
+        locator_list.push_back(unicastLocator);
+
+        receivers.emplace_back(new MockReceiverResource(transportUnderTest, unicastLocator));
+        MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receivers.back()->CreateMessageReceiver());
+        msg_recv->setCallback([&, msg_recv]()
+                {
+                    EXPECT_EQ(memcmp(message, msg_recv->data, 11), 0);
+                    if (num_destinations == messages_received.fetch_add(1) + 1)
+                    {
+                        sem.post();
+                    }
+                });
+    }
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, *locator_list.begin()));
+    ASSERT_FALSE(send_resource_list.empty());
+    ASSERT_TRUE(send_resource_list.at(0)->supports_gather_send());
+
+    Locators locators_begin(locator_list.begin());
+    Locators locators_end(locator_list.end());
+    EXPECT_TRUE(send_resource_list.at(0)->send_gather(buffers, 11, 0, &locators_begin, &locators_end,
+            (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+
+    sem.wait();
+    EXPECT_EQ(num_destinations, messages_received.load());
+}
+
+TEST_F(UDPv4Tests, send_and_receive_with_uring_transport)
+{
+    const size_t num_destinations = 4;
+    const size_t num_messages = 50;
+
+    // Works on top of the default UDPv4 behavior when io_uring is not available
+    UDPv4UringTransportDescriptor uring_descriptor;
+    uring_descriptor.receive_ring_buffers = 8;
+
+    UDPv4UringTransport transportUnderTest(uring_descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+
+    LocatorList_t locator_list;
+    std::vector<std::unique_ptr<MockReceiverResource>> receivers;
+    std::atomic<size_t> messages_received(0);
+    Semaphore sem;
+    for (size_t i = 0; i < num_destinations; ++i)
+    {
+        Locator_t unicastLocator;
+        unicastLocator.kind = LOCATOR_KIND_UDPv4;
+        unicastLocator.port = static_cast<uint16_t>(g_default_port + i);
+        IPLocator::setIPv4(unicastLocator, 127, 0, 0, 1);
+        locator_list.push_back(unicastLocator);
+
+        receivers.emplace_back(new MockReceiverResource(transportUnderTest, unicastLocator));
+        MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receivers.back()->CreateMessageReceiver());
+        msg_recv->setCallback([&, msg_recv]()
+                {
+                    EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+                    if (num_destinations * num_messages == messages_received.fetch_add(1) + 1)
+                    {
+                        sem.post();
+                    }
+                });
+    }
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, *locator_list.begin()));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    // Burst bigger than the receive rings, so the buffers are given back to the kernel while receiving
+    for (size_t i = 0; i < num_messages; ++i)
+    {
+        Locators locators_begin(locator_list.begin());
+        Locators locators_end(locator_list.end());
+        EXPECT_TRUE(send_resource_list.at(0)->send(message, 5, &locators_begin, &locators_end,
+                (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    sem.wait();
+    EXPECT_EQ(num_destinations * num_messages, messages_received.load());
+}
+
 // Regression test for redmine issue #19587
 TEST_F(UDPv4Tests, double_binding_fails)
 {
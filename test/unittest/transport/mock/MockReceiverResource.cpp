@@ -30,7 +30,7 @@ MockReceiverResource::MockReceiverResource(TransportInterface& transport, const
     }
 
     // Implementation functions are bound to the right transport parameters
-    Cleanup = [&transport, locator]() { transport.CloseInputChannel(locator); };
+    Cleanup = [&transport, locator, this]() { transport.close_input_channel_shard(locator, this); };
     LocatorMapsToManagedChannel = [&transport, locator](const Locator_t& locatorToCheck) -> bool
     { return transport.DoInputLocatorsMatch(locator, locatorToCheck); };
 }
@@ -73,9 +73,10 @@ void MockMessageReceiver::setCallback(std::function<void()> cb)
     this->callback = cb;
 }
 
-void MockMessageReceiver::processCDRMsg(const Locator_t&, CDRMessage_t*msg)
+void MockMessageReceiver::processCDRMsg(const Locator_t& loc, CDRMessage_t*msg)
 {
     data = msg->buffer;
+    remote_locator = loc;
     if (callback != nullptr)
     {
         callback();
@@ -64,6 +64,7 @@ public:
     void setCallback(
             std::function<void()> cb);
     octet* data;
+    Locator_t remote_locator;
     std::function<void()> callback;
 };
 
@@ -48,7 +48,7 @@ uint32_t MockTCPChannelResource::read(
 size_t MockTCPChannelResource::send(
         const octet*,
         size_t,
-        const octet*,
+        const NetworkBufferSequence&,
         size_t,
         asio::error_code&)
 {
@@ -25,6 +25,7 @@ namespace rtps {
 
 class MockTCPChannelResource;
 
+using NetworkBufferSequence = eprosima::fastdds::rtps::NetworkBufferSequence;
 using TCPChannelResource = eprosima::fastdds::rtps::TCPChannelResource;
 using TCPTransportDescriptor = eprosima::fastdds::rtps::TCPTransportDescriptor;
 using TCPTransportInterface = eprosima::fastdds::rtps::TCPTransportInterface;
@@ -48,11 +49,13 @@ public:
             std::size_t size,
             asio::error_code& ec) override;
 
+    using TCPChannelResource::send;
+
     size_t send(
             const octet* header,
             size_t header_size,
-            const octet* buffer,
-            size_t size,
+            const NetworkBufferSequence& buffers,
+            size_t total_bytes,
             asio::error_code& ec) override;
 
     asio::ip::tcp::endpoint remote_endpoint() const override;
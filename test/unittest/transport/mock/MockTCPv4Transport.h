@@ -40,6 +40,17 @@ public:
         return channel_resources_;
     }
 
+    const std::map<Locator_t, std::vector<std::shared_ptr<TCPChannelResource>>>& get_stream_channel_resources() const
+    {
+        return stream_channel_resources_;
+    }
+
+    const std::map<Locator_t, std::map<std::pair<uint32_t, uint16_t>, std::shared_ptr<TCPChannelResource>>>&
+    get_writer_stream_channel_resources() const
+    {
+        return writer_stream_channel_resources_;
+    }
+
 };
 
 } // namespace rtps
@@ -0,0 +1,104 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <utils/collections/SingleProducerConsumerQueue.hpp>
+
+using namespace eprosima::fastdds;
+
+TEST(SingleProducerConsumerQueueTests, capacity)
+{
+    SingleProducerConsumerQueue<int> uut_1(1);
+    EXPECT_EQ(uut_1.capacity(), 1u);
+
+    SingleProducerConsumerQueue<int> uut_5(5);
+    EXPECT_EQ(uut_5.capacity(), 8u);
+
+    SingleProducerConsumerQueue<int> uut_32(32);
+    EXPECT_EQ(uut_32.capacity(), 32u);
+}
+
+TEST(SingleProducerConsumerQueueTests, limits)
+{
+    SingleProducerConsumerQueue<int> uut(8);
+    int value = 0;
+
+    // Two rounds, so positions wrap around the storage
+    for (int round = 0; round < 2; ++round)
+    {
+        ASSERT_TRUE(uut.empty());
+        ASSERT_FALSE(uut.pop(value));
+
+        for (int i = 0; i < 8; ++i)
+        {
+            ASSERT_TRUE(uut.push(i));
+            ASSERT_EQ(uut.size(), static_cast<size_t>(i + 1));
+        }
+        ASSERT_FALSE(uut.push(8));
+
+        for (int i = 0; i < 8; ++i)
+        {
+            ASSERT_TRUE(uut.pop(value));
+            ASSERT_EQ(value, i);
+        }
+        ASSERT_FALSE(uut.pop(value));
+        ASSERT_TRUE(uut.empty());
+    }
+}
+
+TEST(SingleProducerConsumerQueueTests, concurrent_push_pop)
+{
+    constexpr int num_values = 10000;
+    SingleProducerConsumerQueue<int> uut(64);
+
+    std::thread producer([&uut]()
+            {
+                for (int i = 0; i < num_values; ++i)
+                {
+                    while (!uut.push(i))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+
+    int expected = 0;
+    int value = 0;
+    while (expected < num_values)
+    {
+        if (uut.pop(value))
+        {
+            EXPECT_EQ(value, expected);
+            ++expected;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+    EXPECT_TRUE(uut.empty());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
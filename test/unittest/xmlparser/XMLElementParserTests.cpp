@@ -3469,6 +3469,7 @@ TEST_F(XMLParserTests, getXMLEnum_positive)
  * 7. Correct parsing of a valid <data_sharing> set to AUTO with shared memory directory.
  * 8. Correct parsing of a valid <data_sharing> set to ON with shared memory directory.
  * 9. Correct parsing of a valid <data_sharing> set to OFF with shared memory directory.
+ * 10. Correct parsing of a valid <data_sharing> with spin duration.
  */
 TEST_F(XMLParserTests, getXMLDataSharingQos)
 {
@@ -3612,6 +3613,25 @@ TEST_F(XMLParserTests, getXMLDataSharingQos)
         EXPECT_EQ(datasharing_policy.max_domains(), 0u);
         EXPECT_EQ(datasharing_policy.domain_ids().size(), 0u);
     }
+
+    {
+        const char* xml =
+                "\
+                <data_sharing>\
+                    <kind>ON</kind>\
+                    <spin_duration>\
+                        <sec>0</sec>\
+                        <nanosec>50000</nanosec>\
+                    </spin_duration>\
+                </data_sharing>\
+                ";
+
+        ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(xml));
+        titleElement = xml_doc.RootElement();
+        EXPECT_EQ(XMLP_ret::XML_OK, XMLParserTest::propertiesPolicy_wrapper(titleElement, datasharing_policy, ident));
+        EXPECT_EQ(datasharing_policy.kind(), DataSharingKind::ON);
+        EXPECT_EQ(datasharing_policy.spin_duration(), Duration_t(0, 50000));
+    }
 }
 
 /*
@@ -25,6 +25,7 @@
 #include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/rtps/transport/PortBasedTransportDescriptor.hpp>
 #include <fastdds/rtps/transport/shared_mem/SharedMemTransportDescriptor.h>
+#include <fastdds/rtps/transport/UDPv4UringTransportDescriptor.h>
 #include <fastrtps/transport/TCPv4TransportDescriptor.h>
 #include <fastrtps/transport/TCPv6TransportDescriptor.h>
 #include <fastrtps/transport/UDPv4TransportDescriptor.h>
@@ -860,7 +861,7 @@ TEST_F(XMLParserTests, loadXMLProfiles)
 /*
  * This test checks the return of the parseXMLTransportData method  and the storage of the values in the XMLProfileManager
  * xml is parsed
- * 1. Check the correct parsing of a UDP transport descriptor for both v4 and v6
+ * 1. Check the correct parsing of a UDP transport descriptor for both v4 and v6, and of the io_uring one
  * 2. Check the correct parsing of a TCP transport descriptor for both v4 and v6
  * 3. Check the correct parsing of a SHM transport descriptor
  */
@@ -894,6 +895,13 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                         <address>wlp0s20f3</address>\
                         <address>lo</address>\
                     </interfaceWhiteList>\
+                    <receive_batch_size>16</receive_batch_size>\
+                    <segmentation_offload>true</segmentation_offload>\
+                    <receive_shards>4</receive_shards>\
+                    <zero_copy_send_threshold>16384</zero_copy_send_threshold>\
+                    <busy_poll_budget_us>50</busy_poll_budget_us>\
+                    <receive_timestamps>true</receive_timestamps>\
+                    <max_connected_sockets>8</max_connected_sockets>\
                     <wan_addr>80.80.55.44</wan_addr>\
                     <output_port>5101</output_port>\
                     <keep_alive_frequency_ms>5000</keep_alive_frequency_ms>\
@@ -935,7 +943,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     </reception_threads>\
                 </transport_descriptor>\
                 ";
-        constexpr size_t xml_len {3000};
+        constexpr size_t xml_len {4000};
         char xml[xml_len];
 
         // UDPv4
@@ -957,6 +965,13 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pUDPv4Desc->interfaceWhiteList[2], "wlp0s20f3");
         EXPECT_EQ(pUDPv4Desc->interfaceWhiteList[3], "lo");
         EXPECT_EQ(pUDPv4Desc->m_output_udp_socket, 5101u);
+        EXPECT_EQ(pUDPv4Desc->receive_batch_size, 16u);
+        EXPECT_EQ(pUDPv4Desc->segmentation_offload, true);
+        EXPECT_EQ(pUDPv4Desc->receive_shards, 4u);
+        EXPECT_EQ(pUDPv4Desc->zero_copy_send_threshold, 16384u);
+        EXPECT_EQ(pUDPv4Desc->busy_poll_budget_us, 50u);
+        EXPECT_EQ(pUDPv4Desc->receive_timestamps, true);
+        EXPECT_EQ(pUDPv4Desc->max_connected_sockets, 8u);
         EXPECT_EQ(pUDPv4Desc->default_reception_threads(), modified_thread_settings);
         EXPECT_EQ(pUDPv4Desc->get_thread_config_for_port(12345), modified_thread_settings);
         EXPECT_EQ(pUDPv4Desc->get_thread_config_for_port(12346), modified_thread_settings);
@@ -982,12 +997,52 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pUDPv4Desc->interfaceWhiteList[2], "wlp0s20f3");
         EXPECT_EQ(pUDPv4Desc->interfaceWhiteList[3], "lo");
         EXPECT_EQ(pUDPv6Desc->m_output_udp_socket, 5101u);
+        EXPECT_EQ(pUDPv6Desc->receive_batch_size, 16u);
+        EXPECT_EQ(pUDPv6Desc->segmentation_offload, true);
+        EXPECT_EQ(pUDPv6Desc->receive_shards, 4u);
+        EXPECT_EQ(pUDPv6Desc->zero_copy_send_threshold, 16384u);
+        EXPECT_EQ(pUDPv6Desc->busy_poll_budget_us, 50u);
+        EXPECT_EQ(pUDPv6Desc->receive_timestamps, true);
+        EXPECT_EQ(pUDPv6Desc->max_connected_sockets, 8u);
         EXPECT_EQ(pUDPv6Desc->default_reception_threads(), modified_thread_settings);
         EXPECT_EQ(pUDPv6Desc->get_thread_config_for_port(12345), modified_thread_settings);
         EXPECT_EQ(pUDPv6Desc->get_thread_config_for_port(12346), modified_thread_settings);
         xmlparser::XMLProfileManager::DeleteInstance();
     }
 
+    // Test UDPv4 with io_uring
+    {
+        tinyxml2::XMLDocument xml_doc;
+        tinyxml2::XMLElement* titleElement;
+
+        const char* xml =
+                "\
+                <transport_descriptor>\
+                    <transport_id>TransportId1</transport_id>\
+                    <type>UDPv4_URING</type>\
+                    <sendBufferSize>8192</sendBufferSize>\
+                    <non_blocking_send>true</non_blocking_send>\
+                    <output_port>5101</output_port>\
+                    <send_ring_entries>128</send_ring_entries>\
+                    <receive_ring_buffers>32</receive_ring_buffers>\
+                </transport_descriptor>\
+                ";
+
+        ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(xml));
+        titleElement = xml_doc.RootElement();
+        EXPECT_EQ(XMLP_ret::XML_OK, XMLParserTest::parseXMLTransportData_wrapper(titleElement));
+        std::shared_ptr<eprosima::fastdds::rtps::UDPv4UringTransportDescriptor> pUringDesc =
+                std::dynamic_pointer_cast<eprosima::fastdds::rtps::UDPv4UringTransportDescriptor>(
+            xmlparser::XMLProfileManager::getTransportById("TransportId1"));
+        ASSERT_NE(nullptr, pUringDesc);
+        EXPECT_EQ(pUringDesc->sendBufferSize, 8192u);
+        EXPECT_EQ(pUringDesc->non_blocking_send, true);
+        EXPECT_EQ(pUringDesc->m_output_udp_socket, 5101u);
+        EXPECT_EQ(pUringDesc->send_ring_entries, 128u);
+        EXPECT_EQ(pUringDesc->receive_ring_buffers, 32u);
+        xmlparser::XMLProfileManager::DeleteInstance();
+    }
+
     // Test TCPv4 and TCPv6
     {
         tinyxml2::XMLDocument xml_doc;
@@ -1033,6 +1088,15 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                         <affinity>12</affinity>\
                         <stack_size>12</stack_size>\
                     </accept_thread>\
+                    <reactor_threads>2</reactor_threads>\
+                    <reactor_thread>\
+                        <scheduling_policy>12</scheduling_policy>\
+                        <priority>12</priority>\
+                        <affinity>12</affinity>\
+                        <stack_size>12</stack_size>\
+                    </reactor_thread>\
+                    <send_queue_size>65536</send_queue_size>\
+                    <connection_streams>3</connection_streams>\
                     <default_reception_threads>\
                         <scheduling_policy>12</scheduling_policy>\
                         <priority>12</priority>\
@@ -1055,7 +1119,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     </reception_threads>\
                 </transport_descriptor>\
                 ";
-        constexpr size_t xml_len {3500};
+        constexpr size_t xml_len {4000};
         char xml[xml_len];
 
         // TCPv4
@@ -1087,6 +1151,10 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pTCPv4Desc->listening_ports[1], 5200u);
         EXPECT_EQ(pTCPv4Desc->keep_alive_thread, modified_thread_settings);
         EXPECT_EQ(pTCPv4Desc->accept_thread, modified_thread_settings);
+        EXPECT_EQ(pTCPv4Desc->reactor_threads, 2u);
+        EXPECT_EQ(pTCPv4Desc->reactor_thread, modified_thread_settings);
+        EXPECT_EQ(pTCPv4Desc->send_queue_size, 65536u);
+        EXPECT_EQ(pTCPv4Desc->connection_streams, 3u);
         EXPECT_EQ(pTCPv4Desc->default_reception_threads(), modified_thread_settings);
         EXPECT_EQ(pTCPv4Desc->get_thread_config_for_port(12345), modified_thread_settings);
         EXPECT_EQ(pTCPv4Desc->get_thread_config_for_port(12346), modified_thread_settings);
@@ -1117,6 +1185,10 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pTCPv6Desc->listening_ports[1], 5200u);
         EXPECT_EQ(pTCPv4Desc->keep_alive_thread, modified_thread_settings);
         EXPECT_EQ(pTCPv4Desc->accept_thread, modified_thread_settings);
+        EXPECT_EQ(pTCPv6Desc->reactor_threads, 2u);
+        EXPECT_EQ(pTCPv6Desc->reactor_thread, modified_thread_settings);
+        EXPECT_EQ(pTCPv6Desc->send_queue_size, 65536u);
+        EXPECT_EQ(pTCPv6Desc->connection_streams, 3u);
         EXPECT_EQ(pTCPv6Desc->default_reception_threads(), modified_thread_settings);
         EXPECT_EQ(pTCPv6Desc->get_thread_config_for_port(12345), modified_thread_settings);
         EXPECT_EQ(pTCPv6Desc->get_thread_config_for_port(12346), modified_thread_settings);
@@ -1137,6 +1209,10 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     <port_queue_capacity>512</port_queue_capacity>\
                     <healthy_check_timeout_ms>1000</healthy_check_timeout_ms>\
                     <rtps_dump_file>rtsp_messages.log</rtps_dump_file>\
+                    <busy_poll_budget_us>50</busy_poll_budget_us>\
+                    <huge_pages>true</huge_pages>\
+                    <numa_node>1</numa_node>\
+                    <max_segment_size>1048576</max_segment_size>\
                     <maxMessageSize>16384</maxMessageSize>\
                     <maxInitialPeersRange>100</maxInitialPeersRange>\
                     <default_reception_threads>\
@@ -1178,6 +1254,10 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pSHMDesc->port_queue_capacity(), 512u);
         EXPECT_EQ(pSHMDesc->healthy_check_timeout_ms(), 1000u);
         EXPECT_EQ(pSHMDesc->rtps_dump_file(), "rtsp_messages.log");
+        EXPECT_EQ(pSHMDesc->busy_poll_budget_us(), 50u);
+        EXPECT_EQ(pSHMDesc->huge_pages(), true);
+        EXPECT_EQ(pSHMDesc->numa_node(), 1);
+        EXPECT_EQ(pSHMDesc->max_segment_size(), 1048576u);
         EXPECT_EQ(pSHMDesc->max_message_size(), 16384u);
         EXPECT_EQ(pSHMDesc->max_initial_peers_range(), 100u);
         EXPECT_EQ(pSHMDesc->default_reception_threads(), modified_thread_settings);
@@ -1215,6 +1295,13 @@ TEST_F(XMLParserTests, parseXMLTransportData_NegativeClauses)
         "non_blocking_send",
         "interfaceWhiteList",
         "output_port",
+        "receive_batch_size",
+        "segmentation_offload",
+        "receive_shards",
+        "zero_copy_send_threshold",
+        "busy_poll_budget_us",
+        "receive_timestamps",
+        "max_connected_sockets",
         "default_reception_threads",
         "reception_threads",
         "bad_element"
@@ -1239,6 +1326,10 @@ TEST_F(XMLParserTests, parseXMLTransportData_NegativeClauses)
         "tls",
         "keep_alive_thread",
         "accept_thread",
+        "reactor_threads",
+        "reactor_thread",
+        "send_queue_size",
+        "connection_streams",
         "default_reception_threads",
         "reception_threads",
         "bad_element"
@@ -1252,6 +1343,10 @@ TEST_F(XMLParserTests, parseXMLTransportData_NegativeClauses)
         "port_queue_capacity",
         "healthy_check_timeout_ms",
         "rtps_dump_file",
+        "busy_poll_budget_us",
+        "huge_pages",
+        "numa_node",
+        "max_segment_size",
         "default_reception_threads",
         "reception_threads",
         "dump_thread",